@@ -13,16 +13,21 @@ COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Accept
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Application.h ${CMAKE_SOURCE_DIR}/include/quickfix/Application.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/AtomicCount.h ${CMAKE_SOURCE_DIR}/include/quickfix/AtomicCount.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/config-all.h ${CMAKE_SOURCE_DIR}/include/quickfix/config-all.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/ByteScanner.h ${CMAKE_SOURCE_DIR}/include/quickfix/ByteScanner.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Clock.h ${CMAKE_SOURCE_DIR}/include/quickfix/Clock.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/DatabaseConnectionID.h ${CMAKE_SOURCE_DIR}/include/quickfix/DatabaseConnectionID.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/DatabaseConnectionPool.h ${CMAKE_SOURCE_DIR}/include/quickfix/DatabaseConnectionPool.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/DataDictionary.h ${CMAKE_SOURCE_DIR}/include/quickfix/DataDictionary.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/DataDictionaryProvider.h ${CMAKE_SOURCE_DIR}/include/quickfix/DataDictionaryProvider.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/DecodeProfile.h ${CMAKE_SOURCE_DIR}/include/quickfix/DecodeProfile.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Decimal.h ${CMAKE_SOURCE_DIR}/include/quickfix/Decimal.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Dictionary.h ${CMAKE_SOURCE_DIR}/include/quickfix/Dictionary.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/dirent_windows.h ${CMAKE_SOURCE_DIR}/include/quickfix/dirent_windows.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/DOMDocument.h ${CMAKE_SOURCE_DIR}/include/quickfix/DOMDocument.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Event.h ${CMAKE_SOURCE_DIR}/include/quickfix/Event.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Exceptions.h ${CMAKE_SOURCE_DIR}/include/quickfix/Exceptions.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Field.h ${CMAKE_SOURCE_DIR}/include/quickfix/Field.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/FastCodec.h ${CMAKE_SOURCE_DIR}/include/quickfix/FastCodec.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/FieldConvertors.h ${CMAKE_SOURCE_DIR}/include/quickfix/FieldConvertors.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/FieldMap.h ${CMAKE_SOURCE_DIR}/include/quickfix/FieldMap.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/FieldNumbers.h ${CMAKE_SOURCE_DIR}/include/quickfix/FieldNumbers.h
@@ -35,6 +40,7 @@ COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/FixFie
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/FixValues.h ${CMAKE_SOURCE_DIR}/include/quickfix/FixValues.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/FlexLexer.h ${CMAKE_SOURCE_DIR}/include/quickfix/FlexLexer.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Group.h ${CMAKE_SOURCE_DIR}/include/quickfix/Group.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/HeaderTemplate.h ${CMAKE_SOURCE_DIR}/include/quickfix/HeaderTemplate.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/HtmlBuilder.h ${CMAKE_SOURCE_DIR}/include/quickfix/HtmlBuilder.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/HttpConnection.h ${CMAKE_SOURCE_DIR}/include/quickfix/HttpConnection.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/HttpMessage.h ${CMAKE_SOURCE_DIR}/include/quickfix/HttpMessage.h
@@ -47,6 +53,7 @@ COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Messag
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MessageCracker.h ${CMAKE_SOURCE_DIR}/include/quickfix/MessageCracker.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MessageSorters.h ${CMAKE_SOURCE_DIR}/include/quickfix/MessageSorters.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MessageStore.h ${CMAKE_SOURCE_DIR}/include/quickfix/MessageStore.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MessageView.h ${CMAKE_SOURCE_DIR}/include/quickfix/MessageView.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/Mutex.h ${CMAKE_SOURCE_DIR}/include/quickfix/Mutex.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MySQLConnection.h ${CMAKE_SOURCE_DIR}/include/quickfix/MySQLConnection.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/MySQLLog.h ${CMAKE_SOURCE_DIR}/include/quickfix/MySQLLog.h
@@ -81,6 +88,7 @@ COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/SSLSoc
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/stdafx.h ${CMAKE_SOURCE_DIR}/include/quickfix/stdafx.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/stdint_msvc.h ${CMAKE_SOURCE_DIR}/include/quickfix/stdint_msvc.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/strptime.h ${CMAKE_SOURCE_DIR}/include/quickfix/strptime.h
+COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/TagPrefix.h ${CMAKE_SOURCE_DIR}/include/quickfix/TagPrefix.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/ThreadedSocketAcceptor.h ${CMAKE_SOURCE_DIR}/include/quickfix/ThreadedSocketAcceptor.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/ThreadedSocketConnection.h ${CMAKE_SOURCE_DIR}/include/quickfix/ThreadedSocketConnection.h
 COMMAND ${CMAKE_COMMAND} -E copy_if_different ${CMAKE_SOURCE_DIR}/src/C++/ThreadedSocketInitiator.h ${CMAKE_SOURCE_DIR}/include/quickfix/ThreadedSocketInitiator.h
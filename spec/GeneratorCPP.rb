@@ -87,7 +87,6 @@ class GeneratorCPP
     end
     @f.puts
     @f.puts "Message(const FIX::Message& m) : FIX::Message(m) {}"
-    @f.puts "Message(const Message& m) : FIX::Message(m) {}"
     @f.puts "Header& getHeader() { return (Header&)m_header; }"
     @f.puts "const Header& getHeader() const { return (Header&)m_header; }"
     @f.puts "Trailer& getTrailer() { return (Trailer&)m_trailer; }"
@@ -106,9 +105,26 @@ class GeneratorCPP
     @f.puts "class " + name + ": public FIX::Group"
     @f.puts "{"
     @f.puts "public:"
-    @f.print name + "() : FIX::Group(" + number + "," + delim + "," + "FIX::message_order("
-    order.each { |field| @f.printInline field + "," }
-    @f.putsInline "0)) {}"
+    positions = {}
+    order.each_with_index { |field, i| positions[field.to_i] = i + 1 }
+    @f.puts name + "() : FIX::Group(" + number + "," + delim + "," + "FIX::message_order(fieldOrder()," + positions.size.to_s + ")) {}"
+    groupOrder(positions)
+  end
+
+  # order table in static storage sorted by field, so groups can be
+  # created and copied without allocating their order
+  def groupOrder(positions)
+    @f.puts "static const FIX::message_order::field_position* fieldOrder()"
+    @f.puts "{"
+    @f.indent
+    @f.print "static const FIX::message_order::field_position order[] = {"
+    positions.keys.sort.each_with_index do |field, i|
+      @f.printInline( ( i == 0 ? "" : "," ) + "{" + field.to_s + "," + positions[field].to_s + "}" )
+    end
+    @f.putsInline "};"
+    @f.puts "return order;"
+    @f.dedent
+    @f.puts "}"
   end
 
   def groupEnd
@@ -135,7 +151,6 @@ class GeneratorCPP
     @f.puts name + "() : Message(MsgType()) {}"
     @f.puts name + "(const FIX::Message& m) : Message(m) {}"
     @f.puts name + "(const Message& m) : Message(m) {}"
-    @f.puts name + "(const #{name}& m) : Message(m) {}"
     @f.puts "static FIX::MsgType MsgType() { return FIX::MsgType(" + "\"" + msgtype + "\"); }"
 
     if( required.size > 0 )
@@ -278,6 +293,20 @@ class GeneratorCPP
           f.puts "const char #{name}_#{description} = '#{enum}';"
       end
     }
+    if name == "MsgType"
+      values.each { |description, enum|
+        f.puts "const int MsgTypeId_#{description} = #{msgTypeId(enum)};"
+      }
+    end
+  end
+
+  # Same id as FIX_MSGTYPE_ID in Message.h
+  def msgTypeId(msgtype)
+    chars = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+    if msgtype.length == 1
+      return 1 + chars.index(msgtype[0])
+    end
+    return 63 + chars.index(msgtype[0]) * 62 + chars.index(msgtype[1])
   end
 
   def fixFieldValuesEnd(f)
@@ -104,31 +104,37 @@ public:
   void crack( const Message&amp; message, 
               const FIX::SessionID&amp; sessionID )
   {
-    const std::string&amp; msgTypeValue 
-      = message.getHeader().getField( FIX::FIELD::MsgType );
-    
-    <xsl:for-each select="//fix/messages/message">
-    <xsl:if test="position()!=1">
-    else
-    </xsl:if>if( msgTypeValue == "<xsl:value-of select="@msgtype"/>" )
-      onMessage( (const <xsl:value-of select="@name"/>&amp;)message, sessionID );</xsl:for-each>
-    else onMessage( message, sessionID );
+    switch( FIX::Message::msgTypeId(
+      message.getHeader().getField( FIX::FIELD::MsgType ) ) )
+    {<xsl:for-each select="//fix/messages/message">
+    <xsl:call-template name="case-label"/>
+      onMessage( (const <xsl:value-of select="@name"/>&amp;)message, sessionID ); break;</xsl:for-each>
+    default:
+      onMessage( message, sessionID );
+    }
   }
   
 void crack( Message&amp; message, 
             const FIX::SessionID&amp; sessionID )
   {
-    FIX::MsgType msgType;
-    message.getHeader().getField(msgType);
-    std::string msgTypeValue = msgType.getValue();
-    
-    <xsl:for-each select="//fix/messages/message">
-    <xsl:if test="position()!=1">
-    else
-    </xsl:if>if( msgTypeValue == "<xsl:value-of select="@msgtype"/>" )
-      onMessage( (<xsl:value-of select="@name"/>&amp;)message, sessionID );</xsl:for-each>
-    else onMessage( message, sessionID );
+    switch( FIX::Message::msgTypeId(
+      message.getHeader().getField( FIX::FIELD::MsgType ) ) )
+    {<xsl:for-each select="//fix/messages/message">
+    <xsl:call-template name="case-label"/>
+      onMessage( (<xsl:value-of select="@name"/>&amp;)message, sessionID ); break;</xsl:for-each>
+    default:
+      onMessage( message, sessionID );
+    }
   }
 </xsl:template>
 
+<xsl:template name="case-label">
+<xsl:choose>
+<xsl:when test="string-length(@msgtype)=1">
+    case FIX_MSGTYPE_ID( '<xsl:value-of select="@msgtype"/>', 0 ):</xsl:when>
+<xsl:otherwise>
+    case FIX_MSGTYPE_ID( '<xsl:value-of select="substring(@msgtype,1,1)"/>', '<xsl:value-of select="substring(@msgtype,2,1)"/>' ):</xsl:otherwise>
+</xsl:choose>
+</xsl:template>
+
 </xsl:stylesheet>
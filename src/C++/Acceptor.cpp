@@ -25,6 +25,7 @@
 
 #include "Acceptor.h"
 #include "Utility.h"
+#include "HeaderPeek.h"
 #include "Session.h"
 #include "SessionFactory.h"
 #include "HttpServer.h"
@@ -74,8 +75,15 @@ void Acceptor::initialize() EXCEPT ( ConfigError )
   if ( !sessions.size() )
     throw ConfigError( "No sessions defined" );
 
+  std::string clockSource = "REALTIME";
+  if ( m_settings.get().has( CLOCK_SOURCE ) )
+    clockSource = m_settings.get().getString( CLOCK_SOURCE );
+  m_pClock.reset( Clock::create( clockSource ) );
+  if ( m_pLog )
+    m_pLog->setClock( *m_pClock );
+
   SessionFactory factory( m_application, m_messageStoreFactory,
-                          m_pLogFactory );
+                          m_pLogFactory, m_pClock.get() );
 
   for ( i = sessions.begin(); i != sessions.end(); ++i )
   {
@@ -103,24 +111,17 @@ Acceptor::~Acceptor()
 Session* Acceptor::getSession
 ( const std::string& msg, Responder& responder )
 {
-  Message message;
-  if ( !message.setStringHeader( msg ) )
+  HeaderPeek peek;
+  if ( !peek.peek( msg ) )
     return 0;
 
-  BeginString beginString;
-  SenderCompID clSenderCompID;
-  TargetCompID clTargetCompID;
-  MsgType msgType;
   try
   {
-    message.getHeader().getField( beginString );
-    message.getHeader().getField( clSenderCompID );
-    message.getHeader().getField( clTargetCompID );
-    message.getHeader().getField( msgType );
-    if ( msgType != "A" ) return 0;
-
-    SenderCompID senderCompID( clTargetCompID );
-    TargetCompID targetCompID( clSenderCompID );
+    if ( peek.getMsgTypeId() != MsgTypeId_Logon ) return 0;
+
+    BeginString beginString( peek.getField( FIELD::BeginString ) );
+    SenderCompID senderCompID( peek.getField( FIELD::TargetCompID ) );
+    TargetCompID targetCompID( peek.getField( FIELD::SenderCompID ) );
     SessionID sessionID( beginString, senderCompID, targetCompID );
 
     Sessions::iterator i = m_sessions.find( sessionID );
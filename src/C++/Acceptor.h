@@ -62,6 +62,9 @@ public:
     return &m_nullLog;
   }
 
+  /// Clock shared by the sessions of this acceptor
+  Clock& getClock() { return *m_pClock; }
+
   /// Start acceptor.
   void start() EXCEPT ( ConfigError, RuntimeError );
   /// Block on the acceptor
@@ -120,6 +123,7 @@ private:
   LogFactory* m_pLogFactory;
   Log* m_pLog;
   NullLog m_nullLog;
+  SmartPtr<Clock> m_pClock;
   bool m_firstPoll;
   bool m_stop;
 };
@@ -23,6 +23,7 @@
 #define FIX_APPLICATION_H
 
 #include "Message.h"
+#include "MessageView.h"
 #include "SessionID.h"
 #include "Mutex.h"
 
@@ -61,6 +62,18 @@ public:
   /// Notification of app message being received from target
   virtual void fromApp( const Message&, const SessionID& )
   EXCEPT ( FieldNotFound, IncorrectDataFormat, IncorrectTagValue, UnsupportedMessageType ) = 0;
+  /**
+   * Notification of app message received on a session using message views.
+   * Named apart from fromApp so that overriding one does not hide the
+   * other; by default the view is decoded and passed to fromApp.
+   */
+  virtual void fromAppView( const MessageView& view, const SessionID& sessionID )
+  EXCEPT ( FieldNotFound, IncorrectDataFormat, IncorrectTagValue, UnsupportedMessageType )
+  {
+    Message message;
+    view.toMessage( message );
+    fromApp( message, sessionID );
+  }
 };
 
 /**
@@ -95,6 +108,9 @@ public:
   void fromApp( const Message& message, const SessionID& sessionID )
   EXCEPT ( FieldNotFound, IncorrectDataFormat, IncorrectTagValue, UnsupportedMessageType )
   { Locker l( m_mutex ); app().fromApp( message, sessionID ); }
+  void fromAppView( const MessageView& view, const SessionID& sessionID )
+  EXCEPT ( FieldNotFound, IncorrectDataFormat, IncorrectTagValue, UnsupportedMessageType )
+  { Locker l( m_mutex ); app().fromAppView( view, sessionID ); }
 
   Mutex m_mutex;
 
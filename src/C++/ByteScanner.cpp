@@ -0,0 +1,245 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "ByteScanner.h"
+#include <cstring>
+
+#if ( defined(__GNUC__) || defined(__clang__) ) && ( defined(__x86_64__) || defined(__i386__) ) && defined(__SSE2__)
+#define FIX_SCANNER_GNU_X86
+#include <immintrin.h>
+#define FIX_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && ( defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 ) ) && _MSC_VER >= 1700
+#define FIX_SCANNER_MSC_X86
+#include <immintrin.h>
+#include <intrin.h>
+#define FIX_TARGET_AVX2
+#endif
+
+namespace FIX
+{
+namespace
+{
+const char* findScalar( const char* begin, const char* end, char value )
+{
+  const void* result = memchr( begin, value, end - begin );
+  return result ? (const char*)result : end;
+}
+
+unsigned long sumScalar( const char* begin, const char* end )
+{
+  unsigned long result = 0;
+  for ( ; begin != end; ++begin )
+    result += (unsigned char)*begin;
+  return result;
+}
+
+#if defined(FIX_SCANNER_GNU_X86) || defined(FIX_SCANNER_MSC_X86)
+
+inline int lowestBit( unsigned int mask )
+{
+#ifdef FIX_SCANNER_MSC_X86
+  unsigned long index;
+  _BitScanForward( &index, mask );
+  return (int)index;
+#else
+  return __builtin_ctz( mask );
+#endif
+}
+
+// add the two 64 bit partial sums produced by sad
+inline unsigned long lanes( __m128i total )
+{
+  unsigned long long parts[ 2 ];
+  _mm_storeu_si128( (__m128i*)parts, total );
+  return (unsigned long)( parts[ 0 ] + parts[ 1 ] );
+}
+
+// fields are short, so the tail is cheaper to walk than to hand to memchr
+inline const char* findTail( const char* begin, const char* end, char value )
+{
+  while ( begin != end && *begin != value ) ++begin;
+  return begin;
+}
+
+const char* findSse2( const char* begin, const char* end, char value )
+{
+  const __m128i needle = _mm_set1_epi8( value );
+  for ( ; end - begin >= 16; begin += 16 )
+  {
+    __m128i chunk = _mm_loadu_si128( (const __m128i*)begin );
+    unsigned int mask = (unsigned int)_mm_movemask_epi8( _mm_cmpeq_epi8( chunk, needle ) );
+    if ( mask )
+      return begin + lowestBit( mask );
+  }
+  return findTail( begin, end, value );
+}
+
+unsigned long sumSse2( const char* begin, const char* end )
+{
+  const __m128i zero = _mm_setzero_si128();
+  __m128i total = _mm_setzero_si128();
+  for ( ; end - begin >= 16; begin += 16 )
+  {
+    __m128i chunk = _mm_loadu_si128( (const __m128i*)begin );
+    total = _mm_add_epi64( total, _mm_sad_epu8( chunk, zero ) );
+  }
+  return lanes( total ) + sumScalar( begin, end );
+}
+
+FIX_TARGET_AVX2
+const char* findAvx2( const char* begin, const char* end, char value )
+{
+  // most values end within the first sixteen bytes
+  if ( end - begin >= 16 )
+  {
+    __m128i chunk = _mm_loadu_si128( (const __m128i*)begin );
+    unsigned int mask = (unsigned int)_mm_movemask_epi8( _mm_cmpeq_epi8( chunk, _mm_set1_epi8( value ) ) );
+    if ( mask )
+      return begin + lowestBit( mask );
+    begin += 16;
+  }
+
+  const __m256i needle = _mm256_set1_epi8( value );
+  for ( ; end - begin >= 32; begin += 32 )
+  {
+    __m256i chunk = _mm256_loadu_si256( (const __m256i*)begin );
+    unsigned int mask = (unsigned int)_mm256_movemask_epi8( _mm256_cmpeq_epi8( chunk, needle ) );
+    if ( mask )
+      return begin + lowestBit( mask );
+  }
+  return findSse2( begin, end, value );
+}
+
+FIX_TARGET_AVX2
+unsigned long sumAvx2( const char* begin, const char* end )
+{
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i total = _mm256_setzero_si256();
+  for ( ; end - begin >= 32; begin += 32 )
+  {
+    __m256i chunk = _mm256_loadu_si256( (const __m256i*)begin );
+    total = _mm256_add_epi64( total, _mm256_sad_epu8( chunk, zero ) );
+  }
+  __m128i half = _mm_add_epi64( _mm256_castsi256_si128( total ),
+                                _mm256_extracti128_si256( total, 1 ) );
+  return lanes( half ) + sumSse2( begin, end );
+}
+
+bool supportsAvx2()
+{
+#ifdef FIX_SCANNER_MSC_X86
+  int info[ 4 ];
+  __cpuid( info, 0 );
+  if ( info[ 0 ] < 7 ) return false;
+  __cpuid( info, 1 );
+  // the OS must save the YMM registers
+  if ( ( info[ 2 ] & ( 1 << 27 ) ) == 0 ) return false;
+  if ( ( _xgetbv( 0 ) & 6 ) != 6 ) return false;
+  __cpuidex( info, 7, 0 );
+  return ( info[ 1 ] & ( 1 << 5 ) ) != 0;
+#else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports( "avx2" ) != 0;
+#endif
+}
+
+#define FIX_SCANNER_X86
+#endif
+}
+
+// scalar until the selector below has run
+ByteScanner::find_function ByteScanner::s_find = findScalar;
+ByteScanner::sum_function ByteScanner::s_sum = sumScalar;
+ByteScanner::Kernel ByteScanner::s_kernel = ByteScanner::SCALAR;
+
+namespace
+{
+struct KernelSelector
+{
+  KernelSelector() { ByteScanner::select( ByteScanner::detect() ); }
+};
+
+KernelSelector s_selector;
+}
+
+bool ByteScanner::parseTag( const char* begin, const char* end, int& tag )
+{
+  // tags are at most a handful of digits so a tight scalar loop wins
+  bool isNegative = false;
+  if ( begin != end && *begin == '-' )
+  {
+    // negative tags parse so they can be rejected as invalid tag numbers
+    isNegative = true;
+    ++begin;
+  }
+  if ( begin == end || end - begin > 9 ) return false;
+
+  int result = 0;
+  for ( ; begin != end; ++begin )
+  {
+    unsigned int digit = (unsigned int)( *begin - '0' );
+    if ( digit > 9 ) return false;
+    result = result * 10 + (int)digit;
+  }
+  tag = isNegative ? -result : result;
+  return true;
+}
+
+ByteScanner::Kernel ByteScanner::detect()
+{
+#ifdef FIX_SCANNER_X86
+  return supportsAvx2() ? AVX2 : SSE2;
+#else
+  return SCALAR;
+#endif
+}
+
+bool ByteScanner::select( Kernel kernel )
+{
+  switch ( kernel )
+  {
+  case SCALAR:
+    s_find = findScalar;
+    s_sum = sumScalar;
+    break;
+#ifdef FIX_SCANNER_X86
+  case SSE2:
+    s_find = findSse2;
+    s_sum = sumSse2;
+    break;
+  case AVX2:
+    if ( !supportsAvx2() ) return false;
+    s_find = findAvx2;
+    s_sum = sumAvx2;
+    break;
+#endif
+  default:
+    return false;
+  }
+
+  s_kernel = kernel;
+  return true;
+}
+}
@@ -0,0 +1,87 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_BYTESCANNER_H
+#define FIX_BYTESCANNER_H
+
+#include <cstddef>
+
+namespace FIX
+{
+/**
+ * Byte scanning kernels used when parsing and checksumming raw messages.
+ *
+ * Vectorized SSE2 and AVX2 versions are used when the processor supports
+ * them, otherwise a portable scalar version is used.  The kernel is chosen
+ * once at startup.
+ */
+class ByteScanner
+{
+public:
+  enum Kernel { SCALAR, SSE2, AVX2 };
+
+  /// Find the first occurrence of value in [begin, end), or end
+  static const char* find( const char* begin, const char* end, char value )
+  { return s_find( begin, end, value ); }
+
+  /// Find the first SOH in [begin, end), or end
+  static const char* findSoh( const char* begin, const char* end )
+  { return s_find( begin, end, '\001' ); }
+
+  /// Find a field's '=' and terminating SOH in one call
+  static bool findField( const char* begin, const char* end,
+                         const char*& equalSign, const char*& soh )
+  {
+    equalSign = s_find( begin, end, '=' );
+    if( equalSign == end ) return false;
+    soh = s_find( equalSign + 1, end, '\001' );
+    return soh != end;
+  }
+
+  /// Sum of the unsigned values of the bytes in [begin, end)
+  static unsigned long sum( const char* begin, const char* end )
+  { return s_sum( begin, end ); }
+
+  /// FIX checksum of the bytes in [begin, end)
+  static int checkSum( const char* begin, const char* end )
+  { return (int)( s_sum( begin, end ) % 256 ); }
+
+  /// Parse a run of decimal digits as a tag number
+  static bool parseTag( const char* begin, const char* end, int& tag );
+
+  /// The kernel currently in use
+  static Kernel kernel() { return s_kernel; }
+  /// Best kernel supported by this processor
+  static Kernel detect();
+  /// Switch kernels, for testing and benchmarking only.  Not thread safe.
+  static bool select( Kernel kernel );
+
+private:
+  typedef const char* (*find_function)( const char*, const char*, char );
+  typedef unsigned long (*sum_function)( const char*, const char* );
+
+  static find_function s_find;
+  static sum_function s_sum;
+  static Kernel s_kernel;
+};
+}
+
+#endif //FIX_BYTESCANNER_H
@@ -0,0 +1,213 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "Clock.h"
+#include <time.h>
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define FIX_CLOCK_TSC
+#include <x86intrin.h>
+#include <cpuid.h>
+#define FIX_CLOCK_BARRIER() __asm__ __volatile__( "" ::: "memory" )
+#elif defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+#define FIX_CLOCK_TSC
+#include <intrin.h>
+#define FIX_CLOCK_BARRIER() _ReadWriteBarrier()
+#endif
+
+namespace FIX
+{
+static int64_t realtimeNanos()
+{
+#if defined(CLOCK_REALTIME) && !defined(_MSC_VER)
+  timespec time;
+  clock_gettime( CLOCK_REALTIME, &time );
+  return (int64_t)time.tv_sec * DateTime::NANOS_PER_SEC + time.tv_nsec;
+#else
+  DateTime now = DateTime::nowUtc();
+  return (int64_t)now.getTimeT() * DateTime::NANOS_PER_SEC
+         + now.getNanosecond();
+#endif
+}
+
+UtcTimeStamp Clock::toTimeStamp( int64_t nanos )
+{
+  UtcTimeStamp result( 0, 0, 0, 1, 1, 1970 );
+  result.set( (int)( nanos / DateTime::NANOS_PER_DAY
+                     + DateTime::JULIAN_19700101 ),
+              nanos % DateTime::NANOS_PER_DAY );
+  return result;
+}
+
+Clock* Clock::create( const std::string& source ) EXCEPT ( ConfigError )
+{
+  std::string value = string_toUpper( source );
+  if ( value == "REALTIME" )
+    return new RealtimeClock;
+  if ( value == "COARSE" )
+    return new CoarseClock;
+  if ( value == "TSC" )
+    return new TscClock;
+  throw ConfigError( "ClockSource must be REALTIME, COARSE or TSC" );
+}
+
+Clock& Clock::realtime()
+{
+  static RealtimeClock clock;
+  return clock;
+}
+
+int64_t RealtimeClock::nanos()
+{
+  return realtimeNanos();
+}
+
+int64_t CoarseClock::nanos()
+{
+#ifdef CLOCK_REALTIME_COARSE
+  timespec time;
+  clock_gettime( CLOCK_REALTIME_COARSE, &time );
+  return (int64_t)time.tv_sec * DateTime::NANOS_PER_SEC + time.tv_nsec;
+#else
+  return realtimeNanos();
+#endif
+}
+
+TscClock::TscClock( double refreshInterval )
+: m_sequence( 0 ),
+  m_calibrationNanos( 0 ),
+  m_calibrationTicks( 0 ),
+  m_refreshInterval( refreshInterval ),
+  m_stop( false ),
+  m_supported( isSupported() ),
+  m_thread( 0 )
+{
+  m_anchor.nanos = 0;
+  m_anchor.ticks = 0;
+  m_anchor.nanosPerTick = 0;
+  if ( !m_supported ) return;
+
+  // take a first estimate of the tick rate over a short interval, later
+  // refreshes improve it as the distance from the calibration point grows
+  sample( m_calibrationNanos, m_calibrationTicks );
+  process_sleep( 0.01 );
+  refresh();
+
+  if ( !thread_spawn( &refreshThread, this, m_thread ) )
+    m_supported = false;
+}
+
+TscClock::~TscClock()
+{
+  if ( !m_thread ) return;
+  m_stop = true;
+  thread_join( m_thread );
+}
+
+bool TscClock::isSupported()
+{
+#if defined(FIX_CLOCK_TSC) && defined(__GNUC__)
+  unsigned int eax, ebx, ecx, edx;
+  if ( !__get_cpuid( 0x80000007, &eax, &ebx, &ecx, &edx ) )
+    return false;
+  return ( edx & ( 1 << 8 ) ) != 0;
+#elif defined(FIX_CLOCK_TSC)
+  int registers[ 4 ];
+  __cpuid( registers, 0x80000000 );
+  if ( (unsigned)registers[ 0 ] < 0x80000007 )
+    return false;
+  __cpuid( registers, 0x80000007 );
+  return ( registers[ 3 ] & ( 1 << 8 ) ) != 0;
+#else
+  return false;
+#endif
+}
+
+int64_t TscClock::nanos()
+{
+#ifdef FIX_CLOCK_TSC
+  if ( m_supported )
+  {
+    Anchor anchor;
+    unsigned sequence;
+    do
+    {
+      sequence = m_sequence;
+      FIX_CLOCK_BARRIER();
+      anchor = m_anchor;
+      FIX_CLOCK_BARRIER();
+    } while ( ( sequence & 1 ) || sequence != m_sequence );
+
+    int64_t elapsed = (int64_t)( __rdtsc() - anchor.ticks );
+    return anchor.nanos + (int64_t)( elapsed * anchor.nanosPerTick );
+  }
+#endif
+  return realtimeNanos();
+}
+
+void TscClock::sample( int64_t& nanos, uint64_t& ticks )
+{
+#ifdef FIX_CLOCK_TSC
+  // pair the realtime reading with the middle of the counter readings
+  // taken around it
+  uint64_t before = __rdtsc();
+  nanos = realtimeNanos();
+  uint64_t after = __rdtsc();
+  ticks = before + ( after - before ) / 2;
+#else
+  nanos = realtimeNanos();
+  ticks = 0;
+#endif
+}
+
+void TscClock::refresh()
+{
+  Anchor anchor;
+  sample( anchor.nanos, anchor.ticks );
+  if ( anchor.ticks == m_calibrationTicks ) return;
+  anchor.nanosPerTick = (double)( anchor.nanos - m_calibrationNanos )
+                        / (double)( anchor.ticks - m_calibrationTicks );
+
+#ifdef FIX_CLOCK_TSC
+  // readers retry while the sequence is odd or has moved on
+  ++m_sequence;
+  FIX_CLOCK_BARRIER();
+  m_anchor = anchor;
+  FIX_CLOCK_BARRIER();
+  ++m_sequence;
+#endif
+}
+
+THREAD_PROC TscClock::refreshThread( void* p )
+{
+  TscClock* pClock = static_cast < TscClock* > ( p );
+  while ( !pClock->m_stop )
+  {
+    process_sleep( pClock->m_refreshInterval );
+    pClock->refresh();
+  }
+  return 0;
+}
+}
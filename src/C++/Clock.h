@@ -0,0 +1,123 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_CLOCK_H
+#define FIX_CLOCK_H
+
+#include "FieldTypes.h"
+#include "Exceptions.h"
+#include "Utility.h"
+#include <string>
+
+namespace FIX
+{
+/**
+ * Source of the current time for an engine.
+ *
+ * Sessions, logs and connections read the time through their engine's
+ * clock instead of constructing UtcTimeStamp, so the cost of a reading
+ * can be traded against its resolution with the ClockSource setting.
+ */
+class Clock
+{
+public:
+  virtual ~Clock() {}
+
+  /// Nanoseconds since the epoch
+  virtual int64_t nanos() = 0;
+
+  UtcTimeStamp now()
+  { return toTimeStamp( nanos() ); }
+
+  static UtcTimeStamp toTimeStamp( int64_t nanos );
+
+  /// Create the clock named by a ClockSource setting
+  static Clock* create( const std::string& source ) EXCEPT ( ConfigError );
+
+  /// Shared realtime clock used when no other clock was configured
+  static Clock& realtime();
+};
+
+/// Reads the system realtime clock on every call.
+class RealtimeClock : public Clock
+{
+public:
+  int64_t nanos();
+};
+
+/**
+ * Reads CLOCK_REALTIME_COARSE where it is available.
+ *
+ * The coarse clock is served from the last timer tick without touching
+ * the hardware, so readings are cheap but only as fine as the kernel
+ * tick.  Falls back to the realtime clock on other platforms.
+ */
+class CoarseClock : public Clock
+{
+public:
+  int64_t nanos();
+};
+
+/**
+ * Extrapolates the time from the CPU timestamp counter.
+ *
+ * The counter is calibrated against the realtime clock when the clock is
+ * created, and a background thread re-anchors it to the realtime clock
+ * every refresh interval so it follows adjustments to the system time.
+ * Readers never block; they retry if the anchor changed while they read
+ * it.  Falls back to the realtime clock when the processor has no
+ * invariant timestamp counter.
+ */
+class TscClock : public Clock
+{
+public:
+  TscClock( double refreshInterval = 0.01 );
+  ~TscClock();
+
+  int64_t nanos();
+
+  /// True when the processor has an invariant timestamp counter
+  static bool isSupported();
+
+private:
+  struct Anchor
+  {
+    int64_t nanos;
+    uint64_t ticks;
+    double nanosPerTick;
+  };
+
+  static THREAD_PROC refreshThread( void* p );
+  void sample( int64_t& nanos, uint64_t& ticks );
+  void refresh();
+
+  Anchor m_anchor;
+  volatile unsigned m_sequence;
+  int64_t m_calibrationNanos;
+  uint64_t m_calibrationTicks;
+  double m_refreshInterval;
+  volatile bool m_stop;
+  bool m_supported;
+  thread_id m_thread;
+};
+}
+
+#endif //FIX_CLOCK_H
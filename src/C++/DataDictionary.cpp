@@ -25,8 +25,10 @@
 
 #include "DataDictionary.h"
 #include "Message.h"
+#include "MessageView.h"
 #include <fstream>
 #include <memory>
+#include <algorithm>
 
 #include "PUGIXML_DOMDocument.h"
 
@@ -40,13 +42,15 @@ namespace FIX
 {
 DataDictionary::DataDictionary()
 : m_hasVersion( false ), m_checkFieldsOutOfOrder( true ),
-  m_checkFieldsHaveValues( true ), m_checkUserDefinedFields( true ), m_allowUnknownMessageFields( false ), m_storeMsgFieldsOrder(false)
+  m_checkFieldsHaveValues( true ), m_checkUserDefinedFields( true ), m_allowUnknownMessageFields( false ), m_storeMsgFieldsOrder(false),
+  m_compiled( false )
 {}
 
 DataDictionary::DataDictionary( std::istream& stream, bool preserveMsgFldsOrder )
 EXCEPT ( ConfigError )
 : m_hasVersion( false ), m_checkFieldsOutOfOrder( true ),
-  m_checkFieldsHaveValues( true ), m_checkUserDefinedFields( true ), m_allowUnknownMessageFields( false ), m_storeMsgFieldsOrder(preserveMsgFldsOrder)
+  m_checkFieldsHaveValues( true ), m_checkUserDefinedFields( true ), m_allowUnknownMessageFields( false ), m_storeMsgFieldsOrder(preserveMsgFldsOrder),
+  m_compiled( false )
 {
   readFromStream( stream );
 }
@@ -54,7 +58,8 @@ EXCEPT ( ConfigError )
 DataDictionary::DataDictionary( const std::string& url, bool preserveMsgFldsOrder )
 EXCEPT ( ConfigError )
 : m_hasVersion( false ), m_checkFieldsOutOfOrder( true ),
-  m_checkFieldsHaveValues( true ), m_checkUserDefinedFields( true ), m_allowUnknownMessageFields( false ), m_storeMsgFieldsOrder(preserveMsgFldsOrder), m_orderedFieldsArray(0)
+  m_checkFieldsHaveValues( true ), m_checkUserDefinedFields( true ), m_allowUnknownMessageFields( false ), m_storeMsgFieldsOrder(preserveMsgFldsOrder),
+  m_compiled( false ), m_orderedFieldsArray(0)
 {
   readFromURL( url );
 }
@@ -117,9 +122,131 @@ DataDictionary& DataDictionary::operator=( const DataDictionary& rhs )
       addGroup( iter->first, i->first, iter->second.first, *iter->second.second );
   }
   }
+
+  // groups copied above compiled themselves if their originals were
+  m_compiled = false;
+  if ( rhs.m_compiled )
+    compileTables();
   return *this;
 }
 
+void DataDictionary::compile()
+{
+  FieldToGroup::const_iterator i;
+  for ( i = m_groups.begin(); i != m_groups.end(); ++i )
+  {
+    const FieldPresenceMap& presenceMap = i->second;
+
+    FieldPresenceMap::const_iterator iter = presenceMap.begin();
+    for ( ; iter != presenceMap.end(); ++iter )
+      iter->second.second->compile();
+  }
+
+  compileTables();
+}
+
+void DataDictionary::compileTables()
+{
+  int largest = 0;
+  Fields::const_iterator iF;
+  for ( iF = m_fields.begin(); iF != m_fields.end(); ++iF )
+    largest = std::max( largest, *iF );
+  NonBodyFields::const_iterator iNBF;
+  for ( iNBF = m_headerFields.begin(); iNBF != m_headerFields.end(); ++iNBF )
+    largest = std::max( largest, iNBF->first );
+  for ( iNBF = m_trailerFields.begin(); iNBF != m_trailerFields.end(); ++iNBF )
+    largest = std::max( largest, iNBF->first );
+  FieldTypes::const_iterator iT;
+  for ( iT = m_fieldTypes.begin(); iT != m_fieldTypes.end(); ++iT )
+    largest = std::max( largest, iT->first );
+  FieldToValue::const_iterator iV;
+  for ( iV = m_fieldValues.begin(); iV != m_fieldValues.end(); ++iV )
+    largest = std::max( largest, iV->first );
+  FieldToGroup::const_iterator iG;
+  for ( iG = m_groups.begin(); iG != m_groups.end(); ++iG )
+    largest = std::max( largest, iG->first );
+
+  // dictionaries of groups only hold their fields, so the type and
+  // value tables are only as large as the tags they describe
+  m_tagFlags.assign( largest + 1, 0 );
+  m_tagTypes.assign( m_fieldTypes.empty() ? 0 : largest + 1, TYPE::Unknown );
+  m_tagValues.assign( m_fieldValues.empty() ? 0 : largest + 1, (const ValueSet*)0 );
+  m_valueSets.assign( m_fieldValues.size(), ValueSet() );
+  m_requiredHeaderFields.clear();
+  m_requiredTrailerFields.clear();
+
+  for ( iF = m_fields.begin(); iF != m_fields.end(); ++iF )
+    if ( *iF >= 0 ) m_tagFlags[ *iF ] |= TAG_FIELD;
+  for ( iNBF = m_headerFields.begin(); iNBF != m_headerFields.end(); ++iNBF )
+  {
+    if ( iNBF->first < 0 ) continue;
+    m_tagFlags[ iNBF->first ] |= TAG_HEADER;
+    if ( iNBF->second ) m_requiredHeaderFields.push_back( iNBF->first );
+  }
+  for ( iNBF = m_trailerFields.begin(); iNBF != m_trailerFields.end(); ++iNBF )
+  {
+    if ( iNBF->first < 0 ) continue;
+    m_tagFlags[ iNBF->first ] |= TAG_TRAILER;
+    if ( iNBF->second ) m_requiredTrailerFields.push_back( iNBF->first );
+  }
+  for ( iT = m_fieldTypes.begin(); iT != m_fieldTypes.end(); ++iT )
+  {
+    if ( iT->first < 0 ) continue;
+    m_tagFlags[ iT->first ] |= TAG_TYPED;
+    m_tagTypes[ iT->first ] = (unsigned char)iT->second;
+    if ( iT->second == TYPE::MultipleValueString
+         || iT->second == TYPE::MultipleCharValue
+         || iT->second == TYPE::MultipleStringValue )
+      m_tagFlags[ iT->first ] |= TAG_MULTIPLE_VALUE;
+  }
+  for ( iF = m_dataFields.begin(); iF != m_dataFields.end(); ++iF )
+    if ( *iF >= 0 && *iF <= largest ) m_tagFlags[ *iF ] |= TAG_DATA;
+  ValueSets::iterator iVS = m_valueSets.begin();
+  for ( iV = m_fieldValues.begin(); iV != m_fieldValues.end(); ++iV, ++iVS )
+  {
+    if ( iV->first < 0 ) continue;
+    iVS->compile( iV->second );
+    m_tagFlags[ iV->first ] |= TAG_VALUES;
+    m_tagValues[ iV->first ] = &*iVS;
+  }
+  for ( iG = m_groups.begin(); iG != m_groups.end(); ++iG )
+    if ( iG->first >= 0 ) m_tagFlags[ iG->first ] |= TAG_GROUP;
+
+  // message types get ids in the order of their names, each with a bit
+  // per tag defined for it and the list of tags it requires
+  m_msgTypeIds.clear();
+  MsgTypeToField::const_iterator iM;
+  for ( iM = m_messageFields.begin(); iM != m_messageFields.end(); ++iM )
+    m_msgTypeIds.insert( std::make_pair( iM->first, 0 ) );
+  for ( iM = m_requiredFields.begin(); iM != m_requiredFields.end(); ++iM )
+    m_msgTypeIds.insert( std::make_pair( iM->first, 0 ) );
+
+  int id = 0;
+  MsgTypeIds::iterator iId;
+  for ( iId = m_msgTypeIds.begin(); iId != m_msgTypeIds.end(); ++iId )
+    iId->second = id++;
+
+  m_compiledMessages.assign( m_msgTypeIds.size(), CompiledMessage() );
+  for ( iM = m_messageFields.begin(); iM != m_messageFields.end(); ++iM )
+  {
+    std::vector < unsigned char >& fields
+      = m_compiledMessages[ m_msgTypeIds[ iM->first ] ].fields;
+    if ( iM->second.empty() ) continue;
+    int last = *iM->second.rbegin();
+    if ( last < 0 ) continue;
+    fields.assign( ( last >> 3 ) + 1, 0 );
+    for ( iF = iM->second.begin(); iF != iM->second.end(); ++iF )
+      if ( *iF >= 0 ) fields[ *iF >> 3 ] |= (unsigned char)( 1 << ( *iF & 7 ) );
+  }
+  for ( iM = m_requiredFields.begin(); iM != m_requiredFields.end(); ++iM )
+  {
+    m_compiledMessages[ m_msgTypeIds[ iM->first ] ].required.assign
+      ( iM->second.begin(), iM->second.end() );
+  }
+
+  m_compiled = true;
+}
+
 void DataDictionary::validate( const Message& message,
                                const DataDictionary* const pSessionDD,
                                const DataDictionary* const pAppDD )
@@ -155,7 +282,8 @@ EXCEPT ( FIX::Exception )
   if ( pAppDD != 0 && pAppDD->m_hasVersion )
   {
     pAppDD->checkMsgType( msgType );
-    pAppDD->checkHasRequired( message.getHeader(), message, message.getTrailer(), msgType );
+    pAppDD->checkHasRequired( message.getHeader(), message, message.getTrailer(),
+                              msgType, &message.getSkippedFields() );
   }
 
   if( pSessionDD != 0 )
@@ -170,9 +298,81 @@ EXCEPT ( FIX::Exception )
   }
 }
 
+bool DataDictionary::canValidate( const MessageView& view ) const
+{
+  if ( !m_hasVersion )
+    return true;
+  if ( !m_compiled )
+    return false;
+
+  const char* value = 0;
+  std::size_t length = 0;
+  if ( !view.getHeader().getValue( FIELD::MsgType, value, length ) )
+    return true;
+  std::string msgType( value, length );
+
+  FieldMapView::iterator i;
+  for ( i = view.begin(); i != view.end(); ++i )
+  {
+    if ( isGroup( msgType, i->tag ) )
+      return false;
+  }
+  return true;
+}
+
+void DataDictionary::validate( const MessageView& view,
+                               const DataDictionary* const pSessionDD,
+                               const DataDictionary* const pAppDD )
+EXCEPT ( FIX::Exception )
+{
+  const FieldMapView& header = view.getHeader();
+  BeginString beginString;
+  MsgType msgType;
+  header.getField( beginString );
+  header.getField( msgType );
+
+  if ( pSessionDD != 0 && pSessionDD->m_hasVersion )
+  {
+    if( pSessionDD->getVersion() != beginString )
+    {
+      throw UnsupportedVersion();
+    }
+  }
+
+  int field = 0;
+  if( (pSessionDD !=0 && pSessionDD->m_checkFieldsOutOfOrder) || 
+      (pAppDD != 0 && pAppDD->m_checkFieldsOutOfOrder) )
+  {
+    if ( !view.hasValidStructure(field) )
+      throw TagOutOfOrder(field);
+  }
+
+  if ( pAppDD != 0 && pAppDD->m_hasVersion )
+  {
+    pAppDD->checkMsgType( msgType );
+    pAppDD->checkHasRequired( header, pAppDD->m_requiredHeaderFields );
+    pAppDD->checkHasRequired( view.getTrailer(), pAppDD->m_requiredTrailerFields );
+    int msgTypeId = pAppDD->getMsgTypeId( msgType.getString() );
+    if ( msgTypeId >= 0 )
+      pAppDD->checkHasRequired( view, pAppDD->m_compiledMessages[ msgTypeId ].required );
+  }
+
+  if( pSessionDD != 0 )
+  {
+    pSessionDD->iterate( header, msgType );
+    pSessionDD->iterate( view.getTrailer(), msgType );
+  }
+
+  if( pAppDD != 0 )
+  {
+    pAppDD->iterate( view, msgType );
+  }
+}
+
 void DataDictionary::iterate( const FieldMap& map, const MsgType& msgType ) const
 {
   int lastField = 0;
+  int msgTypeId = m_compiled ? getMsgTypeId( msgType.getString() ) : -1;
 
   FieldMap::const_iterator i;
   for ( i = map.begin(); i != map.end(); ++i )
@@ -180,25 +380,62 @@ void DataDictionary::iterate( const FieldMap& map, const MsgType& msgType ) cons
     const FieldBase& field = (*i);
     if( i != map.begin() && (field.getTag() == lastField) )
       throw RepeatedTag( lastField );
-    checkHasValue( field );
+    checkField( field, msgType, msgTypeId );
 
-    if ( m_hasVersion )
-    {
-      checkValidFormat( field );
-      checkValue( field );
-    }
+    if ( m_beginString.getValue().length() && shouldCheckTag(field)
+         && !Message::isHeaderField( field, this )
+         && !Message::isTrailerField( field, this ) )
+      checkGroupCount( field, map, msgType );
+    lastField = field.getTag();
+  }
+}
+
+void DataDictionary::iterate( const FieldMapView& map, const MsgType& msgType ) const
+{
+  int msgTypeId = m_compiled ? getMsgTypeId( msgType.getString() ) : -1;
+
+  // fields of a view are in wire order, so repeats need not be adjacent
+  std::vector < int > tags;
+  tags.reserve( map.totalFields() );
+
+  FieldBase field( 0, std::string() );
+  std::string value;
+  FieldMapView::iterator i;
+  for ( i = map.begin(); i != map.end(); ++i )
+  {
+    value.assign( map.valueOf( *i ), i->length );
+    field.setTag( i->tag );
+    field.setString( value );
+    checkField( field, msgType, msgTypeId );
+    tags.push_back( i->tag );
+  }
+
+  std::sort( tags.begin(), tags.end() );
+  std::vector < int >::iterator repeated
+    = std::adjacent_find( tags.begin(), tags.end() );
+  if ( repeated != tags.end() )
+    throw RepeatedTag( *repeated );
+}
+
+void DataDictionary::checkField( const FieldBase& field, const MsgType& msgType,
+                                 int msgTypeId ) const
+{
+  checkHasValue( field );
+
+  if ( m_hasVersion )
+  {
+    checkValidFormat( field );
+    checkValue( field );
+  }
 
-    if ( m_beginString.getValue().length() && shouldCheckTag(field) )
+  if ( m_beginString.getValue().length() && shouldCheckTag(field) )
+  {
+    checkValidTagNumber( field );
+    if ( !Message::isHeaderField( field, this )
+         && !Message::isTrailerField( field, this ) )
     {
-      checkValidTagNumber( field );
-      if ( !Message::isHeaderField( field, this )
-           && !Message::isTrailerField( field, this ) )
-      {
-        checkIsInMessage( field, msgType );
-        checkGroupCount( field, map, msgType );
-      }
+      checkIsInMessage( field, msgType, msgTypeId );
     }
-    lastField = field.getTag();
   }
 }
 
@@ -436,6 +673,8 @@ EXCEPT ( ConfigError )
     }
     RESET_AUTO_PTR(pMessageNode, pMessageNode->getNextSiblingNode());
   }
+
+  compile();
 }
 
 message_order const& DataDictionary::getOrderedFields() const
@@ -678,4 +917,97 @@ TYPE::Type DataDictionary::XMLTypeToType( const std::string& type ) const
   if ( type == "TIME" ) return TYPE::UtcTimeStamp;
   return TYPE::Unknown;
 }
+
+DataDictionary::ValueSet::ValueSet()
+: m_hasEmpty( false ), m_bucketMask( 0 ), m_mask( 0 )
+{
+  memset( m_chars, 0, sizeof( m_chars ) );
+}
+
+void DataDictionary::ValueSet::compile( const Values& values )
+{
+  memset( m_chars, 0, sizeof( m_chars ) );
+  m_hasEmpty = false;
+  m_bucketMask = 0;
+  m_mask = 0;
+  m_seeds.clear();
+  m_slots.clear();
+
+  std::vector < const std::string* > strings;
+  Values::const_iterator i;
+  for ( i = values.begin(); i != values.end(); ++i )
+  {
+    if ( i->size() == 1 )
+    {
+      unsigned char c = (unsigned char)( *i )[ 0 ];
+      m_chars[ c >> 3 ] |= (unsigned char)( 1 << ( c & 7 ) );
+    }
+    else if ( i->empty() )
+      m_hasEmpty = true;
+    else
+      strings.push_back( &*i );
+  }
+  if ( strings.empty() ) return;
+
+  // hash and displace: the values are first split into buckets, then
+  // each bucket, largest first, is given the first seed that sends all of
+  // its values to free slots.  With the table at twice the number of
+  // values a seed is found after a few tries, so it only grows if a
+  // bucket cannot be placed at all.
+  std::size_t buckets = 1;
+  while ( buckets * 2 < strings.size() ) buckets <<= 1;
+  std::vector < std::vector < const std::string* > > bucketed( buckets );
+  std::vector < const std::string* >::const_iterator j;
+  for ( j = strings.begin(); j != strings.end(); ++j )
+    bucketed[ hash( 0, ( *j )->data(), ( *j )->size() ) & ( buckets - 1 ) ].push_back( *j );
+
+  std::vector < std::pair < std::size_t, std::size_t > > order;
+  for ( std::size_t b = 0; b < buckets; ++b )
+    if ( !bucketed[ b ].empty() )
+      order.push_back( std::make_pair( bucketed[ b ].size(), b ) );
+  std::sort( order.rbegin(), order.rend() );
+
+  std::size_t size = 1;
+  while ( size < strings.size() * 2 ) size <<= 1;
+  for ( ;; size <<= 1 )
+  {
+    std::vector < std::string > slots( size );
+    std::vector < bool > used( size, false );
+    std::vector < unsigned > seeds( buckets, 1 );
+    std::vector < std::size_t > placed;
+
+    std::size_t k;
+    for ( k = 0; k < order.size(); ++k )
+    {
+      const std::vector < const std::string* >& bucket = bucketed[ order[ k ].second ];
+      unsigned seed;
+      for ( seed = 1; seed < 1024; ++seed )
+      {
+        placed.clear();
+        for ( j = bucket.begin(); j != bucket.end(); ++j )
+        {
+          std::size_t slot = hash( seed, ( *j )->data(), ( *j )->size() ) & ( size - 1 );
+          if ( used[ slot ] ) break;
+          used[ slot ] = true;
+          placed.push_back( slot );
+        }
+        if ( j == bucket.end() ) break;
+        for ( std::size_t p = 0; p < placed.size(); ++p )
+          used[ placed[ p ] ] = false;
+      }
+      if ( seed == 1024 ) break;
+
+      seeds[ order[ k ].second ] = seed;
+      for ( std::size_t p = 0; p < placed.size(); ++p )
+        slots[ placed[ p ] ] = *bucket[ p ];
+    }
+    if ( k != order.size() ) continue;
+
+    m_bucketMask = (unsigned)( buckets - 1 );
+    m_mask = (unsigned)( size - 1 );
+    m_seeds.swap( seeds );
+    m_slots.swap( slots );
+    return;
+  }
+}
 }
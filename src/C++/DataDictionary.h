@@ -32,12 +32,15 @@
 #include "Exceptions.h"
 #include <set>
 #include <map>
+#include <algorithm>
 #include <string.h>
 
 namespace FIX
 {
 class FieldMap;
 class Message;
+class FieldMapView;
+class MessageView;
 
 /**
  * Represents a data dictionary for a version of %FIX.
@@ -109,6 +112,79 @@ class DataDictionary
   typedef std::map < std::string, std::pair < int, DataDictionary* > > FieldPresenceMap;
   typedef std::map < int, FieldPresenceMap > FieldToGroup;
 
+  // flat tables built by compile(), indexed by tag or message type id
+  enum TagFlag
+  {
+    TAG_FIELD = 0x01,
+    TAG_HEADER = 0x02,
+    TAG_TRAILER = 0x04,
+    TAG_TYPED = 0x08,
+    TAG_DATA = 0x10,
+    TAG_MULTIPLE_VALUE = 0x20,
+    TAG_VALUES = 0x40,
+    TAG_GROUP = 0x80
+  };
+  typedef std::vector < unsigned char > TagFlags;
+  typedef std::vector < unsigned char > TagTypes;
+
+  /**
+   * Enumerated values of a field compiled for lookups without allocation.
+   *
+   * Single character values are kept in a bitmap indexed by the character.
+   * Longer values are placed in a table of about twice their number.  The
+   * values are split into buckets and each bucket gets a hash seed chosen
+   * when the set is compiled so that no two values share a slot, so a
+   * lookup hashes the value twice and compares it with one entry.
+   */
+  class ValueSet
+  {
+  public:
+    ValueSet();
+    void compile( const Values& values );
+
+    bool contains( const char* value, size_t length ) const
+    {
+      if ( length == 1 )
+      {
+        unsigned char c = (unsigned char)*value;
+        return ( m_chars[ c >> 3 ] >> ( c & 7 ) ) & 1;
+      }
+      if ( length == 0 ) return m_hasEmpty;
+      if ( m_slots.empty() ) return false;
+      unsigned seed = m_seeds[ hash( 0, value, length ) & m_bucketMask ];
+      const std::string& slot = m_slots[ hash( seed, value, length ) & m_mask ];
+      return slot.size() == length && memcmp( slot.data(), value, length ) == 0;
+    }
+
+  private:
+    static unsigned hash( unsigned seed, const char* value, size_t length )
+    {
+      unsigned result = 2166136261u ^ seed;
+      for ( size_t i = 0; i < length; ++i )
+        result = ( result ^ (unsigned char)value[ i ] ) * 16777619u;
+      return result ^ ( result >> 15 );
+    }
+
+    unsigned char m_chars[ 32 ];
+    bool m_hasEmpty;
+    unsigned m_bucketMask;
+    unsigned m_mask;
+    std::vector < unsigned > m_seeds;
+    std::vector < std::string > m_slots;
+  };
+  typedef std::vector < ValueSet > ValueSets;
+  typedef std::vector < const ValueSet* > TagValues;
+  typedef std::vector < int > RequiredFields;
+  typedef std::map < std::string, int > MsgTypeIds;
+
+  struct CompiledMessage
+  {
+    // bit per tag defined for the message type
+    std::vector < unsigned char > fields;
+    RequiredFields required;
+  };
+  typedef std::vector < CompiledMessage > CompiledMessages;
+
 public:
   DataDictionary();
   DataDictionary( const DataDictionary& copy );
@@ -125,6 +201,12 @@ public:
   message_order const& getTrailerOrderedFields() const EXCEPT ( ConfigError );
   message_order const& getMessageOrderedFields(const std::string & msgType) const EXCEPT ( ConfigError );
 
+  /// Build the flat lookup tables used for validation and parsing.
+  /// Done by readFromDocument, dictionaries built with the add
+  /// functions are looked up through their maps until compiled.
+  void compile();
+  bool isCompiled() const { return m_compiled; }
+
   // storage functions
   void setVersion( const std::string& beginString )
   {
@@ -138,6 +220,7 @@ public:
 
   void addField( int field )
   {
+    m_compiled = false;
     m_fields.insert( field );
     m_orderedFields.push_back( field );
   }
@@ -180,11 +263,13 @@ public:
 
   bool isField( int field ) const
   {
+    if ( m_compiled ) return hasTagFlag( field, TAG_FIELD );
     return m_fields.find( field ) != m_fields.end();
   }
 
   void addMsgType( const std::string& msgType )
   {
+    m_compiled = false;
     m_messages.insert( msgType );
   }
 
@@ -195,6 +280,7 @@ public:
 
   void addMsgField( const std::string& msgType, int field )
   {
+    m_compiled = false;
     if (m_storeMsgFieldsOrder)
     {
       m_messageOrderedFields[ msgType ].push_back(field);
@@ -205,6 +291,7 @@ public:
 
   bool isMsgField( const std::string& msgType, int field ) const
   {
+    if ( m_compiled ) return hasMsgField( getMsgTypeId( msgType ), field );
     MsgTypeToField::const_iterator i = m_messageFields.find( msgType );
     if ( i == m_messageFields.end() ) return false;
     return i->second.find( field ) != i->second.end();
@@ -212,6 +299,7 @@ public:
 
   void addHeaderField( int field, bool required )
   {
+    m_compiled = false;
     if (m_storeMsgFieldsOrder)
     {
       m_headerOrderedFields.push_back(field);
@@ -222,11 +310,13 @@ public:
 
   bool isHeaderField( int field ) const
   {
+    if ( m_compiled ) return hasTagFlag( field, TAG_HEADER );
     return m_headerFields.find( field ) != m_headerFields.end();
   }
 
   void addTrailerField( int field, bool required )
   {
+    m_compiled = false;
     if (m_storeMsgFieldsOrder)
     {
       m_trailerOrderedFields.push_back(field);
@@ -237,11 +327,13 @@ public:
 
   bool isTrailerField( int field ) const
   {
+    if ( m_compiled ) return hasTagFlag( field, TAG_TRAILER );
     return m_trailerFields.find( field ) != m_trailerFields.end();
   }
 
   void addFieldType( int field, FIX::TYPE::Type type )
   {
+    m_compiled = false;
     m_fieldTypes[ field ] = type;
 
     if( type == FIX::TYPE::Data )
@@ -250,6 +342,12 @@ public:
 
   bool getFieldType( int field, FIX::TYPE::Type& type ) const
   {
+    if ( m_compiled )
+    {
+      if ( !hasTagFlag( field, TAG_TYPED ) ) return false;
+      type = (TYPE::Type)m_tagTypes[ field ];
+      return true;
+    }
     FieldTypes::const_iterator i = m_fieldTypes.find( field );
     if ( i == m_fieldTypes.end() ) return false;
     type = i->second;
@@ -258,6 +356,7 @@ public:
 
   void addRequiredField( const std::string& msgType, int field )
   {
+    m_compiled = false;
     m_requiredFields[ msgType ].insert( field );
   }
 
@@ -270,17 +369,22 @@ public:
 
   void addFieldValue( int field, const std::string& value )
   {
+    m_compiled = false;
     m_fieldValues[ field ].insert( value );
   }
 
   bool hasFieldValue( int field ) const
   {
+    if ( m_compiled ) return hasTagFlag( field, TAG_VALUES );
     FieldToValue::const_iterator i = m_fieldValues.find( field );
     return i != m_fieldValues.end();
   }
 
   bool isFieldValue( int field, const std::string& value ) const
   {
+    if ( m_compiled )
+      return isFieldValue( field, value.data(), value.size() );
+
     FieldToValue::const_iterator i = m_fieldValues.find( field );
     if ( i == m_fieldValues.end() )
       return false;
@@ -302,9 +406,33 @@ public:
     return true;
   }
 
+  bool isFieldValue( int field, const char* value, size_t length ) const
+  {
+    if ( !m_compiled )
+      return isFieldValue( field, std::string( value, length ) );
+    if ( !hasTagFlag( field, TAG_VALUES ) ) return false;
+
+    const ValueSet& values = *m_tagValues[ field ];
+    if( !hasTagFlag( field, TAG_MULTIPLE_VALUE ) )
+      return values.contains( value, length );
+
+    // MultipleValue
+    const char* end = value + length;
+    for ( const char* start = value; ; )
+    {
+      const char* space = (const char*)memchr( start, ' ', end - start );
+      const char* stop = space ? space : end;
+      if ( !values.contains( start, stop - start ) )
+        return false;
+      if ( !space ) return true;
+      start = space + 1;
+    }
+  }
+
   void addGroup( const std::string& msg, int field, int delim,
                  const DataDictionary& dataDictionary )
   {
+    m_compiled = false;
     DataDictionary * pDD = new DataDictionary( dataDictionary );
     pDD->setVersion( getVersion() );
 
@@ -314,6 +442,7 @@ public:
 
   bool isGroup( const std::string& msg, int field ) const
   {
+    if ( m_compiled && !hasTagFlag( field, TAG_GROUP ) ) return false;
     FieldToGroup::const_iterator i = m_groups.find( field );
     if ( i == m_groups.end() ) return false;
 
@@ -326,6 +455,7 @@ public:
   bool getGroup( const std::string& msg, int field, int& delim,
                  const DataDictionary*& pDataDictionary ) const
   {
+    if ( m_compiled && !hasTagFlag( field, TAG_GROUP ) ) return false;
     FieldToGroup::const_iterator i = m_groups.find( field );
     if ( i == m_groups.end() ) return false;
 
@@ -342,12 +472,14 @@ public:
 
   bool isDataField( int field ) const
   {
+    if ( m_compiled ) return hasTagFlag( field, TAG_DATA );
     MsgFields::const_iterator iter = m_dataFields.find( field );
     return iter != m_dataFields.end();
   }
 
   bool isMultipleValueField( int field ) const
   {
+    if ( m_compiled ) return hasTagFlag( field, TAG_MULTIPLE_VALUE );
     FieldTypes::const_iterator i = m_fieldTypes.find( field );
     return i != m_fieldTypes.end() 
       && (i->second == TYPE::MultipleValueString 
@@ -378,11 +510,53 @@ public:
   void validate( const Message& message, bool bodyOnly ) const EXCEPT ( FIX::Exception )
   { validate( message, bodyOnly ? (DataDictionary*)0 : this, this ); }
 
+  /**
+   * Check if a view can be validated without decoding it.  Bodies with
+   * repeating groups, and dictionaries that were not compiled, can only
+   * be validated as a Message.
+   */
+  bool canValidate( const MessageView& view ) const;
+
+  /// Validate a message view, canValidate must be true for pAppDD.
+  static void validate( const MessageView& view,
+                        const DataDictionary* const pSessionDD,
+                        const DataDictionary* const pAppDD ) EXCEPT ( FIX::Exception );
+
   DataDictionary& operator=( const DataDictionary& rhs );
 
 private:
   /// Iterate through fields while applying checks.
   void iterate( const FieldMap& map, const MsgType& msgType ) const;
+  /// Iterate through the fields of a view without groups.
+  void iterate( const FieldMapView& map, const MsgType& msgType ) const;
+  /// Apply the checks that depend on one field only.
+  void checkField( const FieldBase& field, const MsgType& msgType, int msgTypeId ) const;
+
+  /// Build the tables of this dictionary, not of its groups.
+  void compileTables();
+
+  bool hasTagFlag( int field, unsigned char flag ) const
+  {
+    return (std::size_t)field < m_tagFlags.size()
+           && ( m_tagFlags[ field ] & flag ) != 0;
+  }
+
+  /// Id of a message type in the compiled tables, -1 if not defined.
+  int getMsgTypeId( const std::string& msgType ) const
+  {
+    MsgTypeIds::const_iterator i = m_msgTypeIds.find( msgType );
+    return i == m_msgTypeIds.end() ? -1 : i->second;
+  }
+
+  bool hasMsgField( int msgTypeId, int field ) const
+  {
+    if ( msgTypeId < 0 ) return false;
+    const std::vector < unsigned char >& fields
+      = m_compiledMessages[ msgTypeId ].fields;
+    std::size_t byte = (std::size_t)field >> 3;
+    return byte < fields.size()
+           && ( fields[ byte ] & ( 1 << ( field & 7 ) ) ) != 0;
+  }
 
   /// Check if message type is defined in spec.
   void checkMsgType( const MsgType& msgType ) const
@@ -406,7 +580,7 @@ private:
   void checkValidTagNumber( const FieldBase& field ) const
   EXCEPT ( InvalidTagNumber )
   {
-    if( m_fields.find( field.getTag() ) == m_fields.end() )
+    if( !isField( field.getTag() ) )
       throw InvalidTagNumber( field.getTag() );
   }
 
@@ -492,7 +666,7 @@ private:
     if ( !hasFieldValue( field.getTag() ) ) return ;
 
     const std::string& value = field.getString();
-    if ( !isFieldValue( field.getTag(), value ) )
+    if ( !isFieldValue( field.getTag(), value.data(), value.size() ) )
       throw IncorrectTagValue( field.getTag() );
   }
 
@@ -506,10 +680,11 @@ private:
 
   /// Check if a field is in this message type.
   void checkIsInMessage
-  ( const FieldBase& field, const MsgType& msgType ) const
+  ( const FieldBase& field, const MsgType& msgType, int msgTypeId ) const
   EXCEPT ( TagNotDefinedForMessage )
   {
-    if ( !isMsgField( msgType, field.getTag() ) )
+    if ( m_compiled ? !hasMsgField( msgTypeId, field.getTag() )
+                    : !isMsgField( msgType, field.getTag() ) )
       throw TagNotDefinedForMessage( field.getTag() );
   }
 
@@ -527,37 +702,57 @@ private:
     }
   }
 
-  /// Check if a message has all required fields.
+  /**
+   * Check if a message has all required fields.
+   *
+   * Body tags in the sorted pSkipped were left out while decoding and
+   * count as present.
+   */
   void checkHasRequired
   ( const FieldMap& header, const FieldMap& body, const FieldMap& trailer,
-    const MsgType& msgType ) const
+    const MsgType& msgType, const std::vector < int >* pSkipped = 0 ) const
   EXCEPT ( RequiredTagMissing )
   {
-    NonBodyFields::const_iterator iNBF;
-    for( iNBF = m_headerFields.begin(); iNBF != m_headerFields.end(); ++iNBF )
+    if ( m_compiled )
     {
-      if( iNBF->second == true && !header.isSetField(iNBF->first) )
-        throw RequiredTagMissing( iNBF->first );
+      checkHasRequired( header, m_requiredHeaderFields );
+      checkHasRequired( trailer, m_requiredTrailerFields );
+      int msgTypeId = getMsgTypeId( msgType.getString() );
+      if ( msgTypeId < 0 ) return ;
+      checkHasRequired( body, m_compiledMessages[ msgTypeId ].required, pSkipped );
+      if ( m_groups.empty() ) return ;
     }
-
-    for( iNBF = m_trailerFields.begin(); iNBF != m_trailerFields.end(); ++iNBF )
+    else
     {
-      if( iNBF->second == true && !trailer.isSetField(iNBF->first) )
-        throw RequiredTagMissing( iNBF->first );
-    }
+      NonBodyFields::const_iterator iNBF;
+      for( iNBF = m_headerFields.begin(); iNBF != m_headerFields.end(); ++iNBF )
+      {
+        if( iNBF->second == true && !header.isSetField(iNBF->first) )
+          throw RequiredTagMissing( iNBF->first );
+      }
+
+      for( iNBF = m_trailerFields.begin(); iNBF != m_trailerFields.end(); ++iNBF )
+      {
+        if( iNBF->second == true && !trailer.isSetField(iNBF->first) )
+          throw RequiredTagMissing( iNBF->first );
+      }
 
-    MsgTypeToField::const_iterator iM
-      = m_requiredFields.find( msgType.getString() );
-    if ( iM == m_requiredFields.end() ) return ;
+      MsgTypeToField::const_iterator iM
+        = m_requiredFields.find( msgType.getString() );
+      if ( iM == m_requiredFields.end() ) return ;
 
-    const MsgFields& fields = iM->second;
-    MsgFields::const_iterator iF;
-    for( iF = fields.begin(); iF != fields.end(); ++iF )
-    {
-      if( !body.isSetField(*iF) )
-        throw RequiredTagMissing( *iF );
+      const MsgFields& fields = iM->second;
+      MsgFields::const_iterator iF;
+      for( iF = fields.begin(); iF != fields.end(); ++iF )
+      {
+        if( !body.isSetField(*iF) && !isSkipped( *iF, pSkipped ) )
+          throw RequiredTagMissing( *iF );
+      }
     }
 
+    // groups left for lazy decoding are not built just to be checked
+    if( body.hasDeferredGroups() ) return ;
+
     FieldMap::g_const_iterator groups;
     for( groups = body.g_begin(); groups != body.g_end(); ++groups )
     {
@@ -573,6 +768,25 @@ private:
     }
   }
 
+  template < typename Map >
+  void checkHasRequired( const Map& map, const RequiredFields& fields,
+                         const std::vector < int >* pSkipped = 0 ) const
+  EXCEPT ( RequiredTagMissing )
+  {
+    RequiredFields::const_iterator i;
+    for( i = fields.begin(); i != fields.end(); ++i )
+    {
+      if( !map.isSetField(*i) && !isSkipped( *i, pSkipped ) )
+        throw RequiredTagMissing( *i );
+    }
+  }
+
+  static bool isSkipped( int field, const std::vector < int >* pSkipped )
+  {
+    return pSkipped
+      && std::binary_search( pSkipped->begin(), pSkipped->end(), field );
+  }
+
   int lookupXMLFieldNumber( DOMDocument*, DOMNode* ) const;
   int lookupXMLFieldNumber( DOMDocument*, const std::string& name ) const;
   int addXMLComponentFields( DOMDocument*, DOMNode*, const std::string& msgtype, DataDictionary&, bool );
@@ -585,6 +799,7 @@ private:
   bool m_checkUserDefinedFields;
   bool m_allowUnknownMessageFields;
   bool m_storeMsgFieldsOrder;
+  bool m_compiled;
   
   BeginString m_beginString;
   MsgTypeToField m_messageFields;
@@ -607,6 +822,15 @@ private:
   OrderedFields m_trailerOrderedFields;
   mutable OrderedFieldsArray m_trailerOrder;
   MsgTypeToOrderedFields m_messageOrderedFields;
+
+  TagFlags m_tagFlags;
+  TagTypes m_tagTypes;
+  ValueSets m_valueSets;
+  TagValues m_tagValues;
+  RequiredFields m_requiredHeaderFields;
+  RequiredFields m_requiredTrailerFields;
+  MsgTypeIds m_msgTypeIds;
+  CompiledMessages m_compiledMessages;
 };
 }
 
@@ -0,0 +1,306 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "Decimal.h"
+#include <cstring>
+
+// Eight digit conversions load and store digits as one little-endian word
+#if ( defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ) \
+    || defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM64)
+#define FIX_DECIMAL_SWAR
+#endif
+
+namespace FIX
+{
+namespace
+{
+const uint64_t POWERS_OF_TEN[] =
+{
+  1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+  10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+  100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+  100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+  100000000000000000ULL, 1000000000000000000ULL,
+  10000000000000000000ULL
+};
+
+inline bool isDigit( char c )
+{ return (unsigned char)( c - '0' ) < 10; }
+
+#ifdef FIX_DECIMAL_SWAR
+/// True if all eight bytes of word are ASCII digits
+inline bool isEightDigits( uint64_t word )
+{
+  return ( ( word & 0xF0F0F0F0F0F0F0F0ULL )
+         | ( ( ( word + 0x0606060606060606ULL ) & 0xF0F0F0F0F0F0F0F0ULL ) >> 4 ) )
+         == 0x3333333333333333ULL;
+}
+
+/// Value of eight ASCII digits, the first in the lowest byte
+inline uint32_t parseEightDigits( uint64_t word )
+{
+  word = ( ( word & 0x0F0F0F0F0F0F0F0FULL ) * 2561 ) >> 8;
+  word = ( ( word & 0x00FF00FF00FF00FFULL ) * 6553601 ) >> 16;
+  return (uint32_t)( ( ( word & 0x0000FFFF0000FFFFULL ) * 42949672960001ULL ) >> 32 );
+}
+
+/// Eight ASCII digits of value < 10^8, the first in the lowest byte
+inline uint64_t formatEightDigits( uint32_t value )
+{
+  // split into 4, then 2, then 1 digit lanes with the leading part lowest
+  uint64_t high = value / 10000;
+  uint64_t word = high | ( (uint64_t)( value - high * 10000 ) << 32 );
+  uint64_t quotient = ( ( word * 10486 ) >> 20 ) & 0x0000007F0000007FULL;
+  word = quotient | ( ( word - quotient * 100 ) << 16 );
+  quotient = ( ( word * 103 ) >> 10 ) & 0x000F000F000F000FULL;
+  word = quotient | ( ( word - quotient * 10 ) << 8 );
+  return word | 0x3030303030303030ULL;
+}
+#endif
+
+/// Accumulate a run of digits into mantissa, counting significant digits
+bool parseDigits( const char*& p, const char* end, uint64_t& mantissa, int& digits )
+{
+#ifdef FIX_DECIMAL_SWAR
+  while ( end - p >= 8 )
+  {
+    uint64_t word;
+    memcpy( &word, p, 8 );
+    if ( !isEightDigits( word ) )
+      break;
+
+    uint32_t value = parseEightDigits( word );
+    if ( mantissa )
+      digits += 8;
+    else if ( value )
+    {
+      digits = 8;
+      for ( const char* q = p; *q == '0'; ++q )
+        --digits;
+    }
+    if ( digits > Decimal::MAX_DIGITS )
+      return false;
+
+    mantissa = mantissa * 100000000ULL + value;
+    p += 8;
+  }
+#endif
+
+  for ( ; p != end && isDigit( *p ); ++p )
+  {
+    if ( ( mantissa || *p != '0' ) && ++digits > Decimal::MAX_DIGITS )
+      return false;
+    mantissa = mantissa * 10 + ( *p - '0' );
+  }
+  return true;
+}
+
+/// Write the digits of value, returning how many were written
+std::size_t formatDigits( char* buffer, uint64_t value )
+{
+  char digits[ 24 ];
+  char* p = digits + sizeof( digits );
+
+#ifdef FIX_DECIMAL_SWAR
+  while ( value >= 100000000ULL )
+  {
+    uint64_t word = formatEightDigits( (uint32_t)( value % 100000000ULL ) );
+    p -= 8;
+    memcpy( p, &word, 8 );
+    value /= 100000000ULL;
+  }
+#endif
+
+  do
+  {
+    *--p = (char)( '0' + value % 10 );
+    value /= 10;
+  } while ( value );
+
+  std::size_t length = digits + sizeof( digits ) - p;
+  memcpy( buffer, p, length );
+  return length;
+}
+}
+
+Decimal::Decimal( const std::string& value )
+EXCEPT ( FieldConvertError )
+: m_mantissa( 0 ), m_exponent( 0 )
+{
+  if ( !parse( value.data(), value.data() + value.size(), *this ) )
+    throw FieldConvertError( value );
+}
+
+bool Decimal::parse( const char* begin, const char* end, Decimal& result )
+{
+  // same grammar as DoubleConvertor: -?d*(.d*)? with at least one digit
+  const char* p = begin;
+  bool isNegative = false;
+  if ( p != end && *p == '-' )
+  {
+    isNegative = true;
+    ++p;
+  }
+
+  uint64_t mantissa = 0;
+  int digits = 0;
+  const char* integerStart = p;
+  if ( !parseDigits( p, end, mantissa, digits ) )
+    return false;
+  bool haveDigit = p != integerStart;
+
+  int exponent = 0;
+  if ( p != end && *p == '.' )
+  {
+    const char* fractionStart = ++p;
+    if ( !parseDigits( p, end, mantissa, digits ) )
+      return false;
+    exponent = -(int)( p - fractionStart );
+    haveDigit = haveDigit || p != fractionStart;
+  }
+
+  if ( p != end || !haveDigit || exponent < -MAX_EXPONENT )
+    return false;
+
+  result.m_mantissa = isNegative ? -(int64_t)mantissa : (int64_t)mantissa;
+  result.m_exponent = exponent;
+  return true;
+}
+
+std::size_t Decimal::format( char* buffer ) const
+{
+  if ( m_exponent > MAX_EXPONENT || m_exponent < -MAX_EXPONENT )
+    return 0;
+
+  char* p = buffer;
+  uint64_t magnitude = m_mantissa < 0
+    ? (uint64_t)0 - (uint64_t)m_mantissa : (uint64_t)m_mantissa;
+  if ( m_mantissa < 0 )
+    *p++ = '-';
+
+  if ( m_exponent >= 0 )
+  {
+    p += formatDigits( p, magnitude );
+    if ( magnitude )
+    {
+      memset( p, '0', m_exponent );
+      p += m_exponent;
+    }
+    return p - buffer;
+  }
+
+  char digits[ 24 ];
+  std::size_t length = formatDigits( digits, magnitude );
+  std::size_t scale = -m_exponent;
+  if ( length > scale )
+  {
+    std::size_t integer = length - scale;
+    memcpy( p, digits, integer );
+    p += integer;
+    *p++ = '.';
+    memcpy( p, digits + integer, scale );
+    p += scale;
+  }
+  else
+  {
+    *p++ = '0';
+    *p++ = '.';
+    memset( p, '0', scale - length );
+    p += scale - length;
+    memcpy( p, digits, length );
+    p += length;
+  }
+  return p - buffer;
+}
+
+std::string Decimal::toString() const
+{
+  char buffer[ BUFFER_SIZE ];
+  std::size_t length = format( buffer );
+  if ( length )
+    return std::string( buffer, length );
+
+  // exponents past MAX_EXPONENT are only reachable through the
+  // constructor, render them through a normalized copy
+  Decimal normalized( m_mantissa, m_exponent > 0 ? MAX_EXPONENT : -MAX_EXPONENT );
+  if ( m_exponent > 0 )
+    return normalized.toString() + std::string( m_exponent - MAX_EXPONENT, '0' );
+
+  // drop digits below the smallest representable place
+  int shift = -MAX_EXPONENT - m_exponent;
+  int64_t mantissa = m_mantissa;
+  for ( ; shift > 0 && mantissa; --shift )
+    mantissa /= 10;
+  return Decimal( mantissa, -MAX_EXPONENT ).toString();
+}
+
+double Decimal::toDouble() const
+{
+  // exact when the mantissa fits a double and the power of ten is exact
+  double result = (double)m_mantissa;
+  int exponent = m_exponent;
+  for ( ; exponent > 19; exponent -= 19 )
+    result *= 1e19;
+  for ( ; exponent < -19; exponent += 19 )
+    result /= 1e19;
+  if ( exponent >= 0 )
+    return result * (double)POWERS_OF_TEN[ exponent ];
+  return result / (double)POWERS_OF_TEN[ -exponent ];
+}
+
+int Decimal::compare( const Decimal& rhs ) const
+{
+  const int sign = ( m_mantissa > 0 ) - ( m_mantissa < 0 );
+  const int rhsSign = ( rhs.m_mantissa > 0 ) - ( rhs.m_mantissa < 0 );
+  if ( sign != rhsSign || sign == 0 )
+    return sign < rhsSign ? -1 : ( sign > rhsSign ? 1 : 0 );
+
+  // same sign, compare magnitudes after scaling the one with the
+  // larger exponent down to the smaller exponent
+  uint64_t lhs = sign < 0 ? (uint64_t)0 - (uint64_t)m_mantissa : (uint64_t)m_mantissa;
+  uint64_t other = sign < 0 ? (uint64_t)0 - (uint64_t)rhs.m_mantissa : (uint64_t)rhs.m_mantissa;
+
+  int result = 0;
+  if ( m_exponent == rhs.m_exponent )
+    result = lhs < other ? -1 : ( lhs > other ? 1 : 0 );
+  else
+  {
+    const bool lhsLarger = m_exponent > rhs.m_exponent;
+    uint64_t larger = lhsLarger ? lhs : other;
+    uint64_t smaller = lhsLarger ? other : lhs;
+    int difference = lhsLarger ? m_exponent - rhs.m_exponent : rhs.m_exponent - m_exponent;
+
+    // if scaling overflows the larger exponent side wins outright
+    int magnitude = 1;
+    if ( difference <= 19 && larger <= ~(uint64_t)0 / POWERS_OF_TEN[ difference ] )
+    {
+      larger *= POWERS_OF_TEN[ difference ];
+      magnitude = larger < smaller ? -1 : ( larger > smaller ? 1 : 0 );
+    }
+    result = lhsLarger ? magnitude : -magnitude;
+  }
+  return sign < 0 ? -result : result;
+}
+}
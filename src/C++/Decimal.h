@@ -0,0 +1,123 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifndef FIX_DECIMAL_H
+#define FIX_DECIMAL_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#if defined(_MSC_VER) && (_MSC_VER < 1600)
+ #include "stdint_msvc.h"
+#else
+ #include <stdint.h>
+#endif
+
+#include "Exceptions.h"
+#include <string>
+
+namespace FIX
+{
+/*! \addtogroup user
+ *  @{
+ */
+
+/**
+ * Fixed-point decimal number stored as a 64-bit mantissa and a power of
+ * ten exponent, so value = mantissa * 10^exponent.
+ *
+ * Prices, quantities and amounts parse into and format from a Decimal
+ * without going through a binary double, so the digits received are
+ * exactly the digits sent back out, trailing zeros included.  Up to 18
+ * significant digits are supported.
+ */
+class Decimal
+{
+public:
+  /// Most significant digits a Decimal holds
+  static const int MAX_DIGITS = 18;
+  /// Largest exponent magnitude accepted
+  static const int MAX_EXPONENT = 64;
+  /// Buffer size that fits any formatted Decimal
+  static const int BUFFER_SIZE = 2 * MAX_EXPONENT + 24;
+
+  Decimal()
+  : m_mantissa( 0 ), m_exponent( 0 ) {}
+
+  Decimal( int64_t mantissa, int exponent )
+  : m_mantissa( mantissa ), m_exponent( exponent ) {}
+
+  /// Parse a FIX float, e.g. "-123.450"
+  explicit Decimal( const std::string& value )
+  EXCEPT ( FieldConvertError );
+
+  int64_t getMantissa() const { return m_mantissa; }
+  int getExponent() const { return m_exponent; }
+
+  /// Nearest double to this value
+  double toDouble() const;
+
+  /// Format as a FIX float, returning the text
+  std::string toString() const;
+
+  /**
+   * Parse a FIX float in [begin, end).  Eight digits are converted at
+   * a time where possible.
+   *
+   * @return false if the text is not a FIX float or has more than
+   *         MAX_DIGITS significant digits
+   */
+  static bool parse( const char* begin, const char* end, Decimal& result );
+
+  /**
+   * Format into buffer, which must hold at least BUFFER_SIZE bytes.
+   *
+   * @return the number of characters written
+   */
+  std::size_t format( char* buffer ) const;
+
+  /// Compare values, so 1.5 and 1.50 are equal
+  int compare( const Decimal& rhs ) const;
+
+private:
+  int64_t m_mantissa;
+  int m_exponent;
+};
+
+inline bool operator==( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) == 0; }
+inline bool operator!=( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) != 0; }
+inline bool operator<( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) < 0; }
+inline bool operator>( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) > 0; }
+inline bool operator<=( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) <= 0; }
+inline bool operator>=( const Decimal& lhs, const Decimal& rhs )
+{ return lhs.compare( rhs ) >= 0; }
+
+/*! @} */
+}
+
+#endif //FIX_DECIMAL_H
@@ -0,0 +1,79 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "DecodeProfile.h"
+#include "FieldConvertors.h"
+#include "Utility.h"
+
+namespace FIX
+{
+void DecodeProfile::addField( const std::string& msgType, int field )
+{
+  Fields& fields = m_fields[ msgType ];
+  if ( field < 0 ) return;
+  if ( (std::size_t)field >= fields.size() )
+    fields.resize( field + 1, 0 );
+  fields[ field ] = 1;
+}
+
+void DecodeProfile::read( const std::string& setting )
+EXCEPT ( ConfigError )
+{
+  std::string::size_type start = 0;
+  while ( start < setting.size() )
+  {
+    std::string::size_type end = setting.find( ';', start );
+    if ( end == std::string::npos ) end = setting.size();
+    std::string entry = string_strip( setting.substr( start, end - start ) );
+    start = end + 1;
+    if ( entry.empty() ) continue;
+
+    std::string::size_type colon = entry.find( ':' );
+    if ( colon == std::string::npos )
+      throw ConfigError( "DecodeProfile entry " + entry + " has no field list" );
+    std::string msgType = string_strip( entry.substr( 0, colon ) );
+    if ( msgType.empty() )
+      throw ConfigError( "DecodeProfile entry " + entry + " has no message type" );
+
+    // an empty list still names the type, so only its header is decoded
+    m_fields[ msgType ];
+
+    std::string::size_type tagStart = colon + 1;
+    while ( tagStart < entry.size() )
+    {
+      std::string::size_type tagEnd = entry.find( ',', tagStart );
+      if ( tagEnd == std::string::npos ) tagEnd = entry.size();
+      std::string tag = string_strip( entry.substr( tagStart, tagEnd - tagStart ) );
+      tagStart = tagEnd + 1;
+      if ( tag.empty() ) continue;
+
+      int field = 0;
+      if ( !IntConvertor::convert( tag, field ) || field <= 0 )
+        throw ConfigError( "DecodeProfile field " + tag + " is not a valid tag" );
+      addField( msgType, field );
+    }
+  }
+}
+}
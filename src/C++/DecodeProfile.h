@@ -0,0 +1,82 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_DECODEPROFILE_H
+#define FIX_DECODEPROFILE_H
+
+#ifdef _MSC_VER
+#pragma warning( disable: 4786 )
+#endif
+
+#include "Exceptions.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace FIX
+{
+/**
+ * Body fields to decode for each message type.
+ *
+ * Messages of a type named in the profile only decode the body fields
+ * and groups listed for it.  The remaining body fields are scanned over
+ * so that BodyLength and CheckSum can still be checked.  Header and
+ * trailer fields, admin messages and message types the profile does not
+ * name are always fully decoded.
+ */
+class DecodeProfile
+{
+public:
+  /// Flags indexed by tag, set for the fields to decode
+  typedef std::vector < unsigned char > Fields;
+
+  /// Decode field of msgType, naming a group count field decodes the group
+  void addField( const std::string& msgType, int field );
+
+  /// Fields to decode for msgType, null if every field is decoded
+  const Fields* getFields( const std::string& msgType ) const
+  {
+    if ( m_fields.empty() ) return 0;
+    MsgTypeToFields::const_iterator i = m_fields.find( msgType );
+    return i == m_fields.end() ? 0 : &i->second;
+  }
+
+  static bool contains( const Fields& fields, int field )
+  { return field >= 0 && (std::size_t)field < fields.size() && fields[ field ]; }
+
+  bool empty() const { return m_fields.empty(); }
+
+  /**
+   * Add the fields of a DecodeProfile setting.
+   *
+   * The setting lists message types separated by semicolons, each
+   * followed by a colon and a comma separated list of tags, for example
+   * "8:11,14,37,39,54,55,150,151;D:11,38,54,55".
+   */
+  void read( const std::string& setting ) EXCEPT ( ConfigError );
+
+private:
+  typedef std::map < std::string, Fields > MsgTypeToFields;
+  MsgTypeToFields m_fields;
+};
+}
+
+#endif //FIX_DECODEPROFILE_H
@@ -0,0 +1,1235 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "FastCodec.h"
+#include "PUGIXML_DOMDocument.h"
+#include "Decimal.h"
+#include "FieldConvertors.h"
+#include <algorithm>
+
+#ifdef _MSC_VER
+#define RESET_AUTO_PTR(OLD, NEW) OLD = NEW;
+#else
+#define RESET_AUTO_PTR(OLD, NEW) OLD.reset( NEW.release() );
+#endif
+
+namespace FIX
+{
+namespace
+{
+const unsigned char STOP_BIT = 0x80;
+const unsigned char SIGN_BIT = 0x40;
+/// Most bytes a stop bit encoded 64 bit integer takes
+const int MAX_INTEGER_BYTES = 10;
+/// Largest decimal exponent magnitude FAST allows
+const int MAX_EXPONENT = 63;
+const int64_t MAX_INT64 = 0x7FFFFFFFFFFFFFFFLL;
+
+uint64_t readUnsigned( const unsigned char*& pos, const unsigned char* end )
+{
+  uint64_t value = 0;
+  for ( int i = 0; i < MAX_INTEGER_BYTES; ++i )
+  {
+    if ( pos == end ) throw InvalidMessage( "FAST message is truncated" );
+    unsigned char byte = *pos++;
+    value = ( value << 7 ) | ( byte & 0x7F );
+    if ( byte & STOP_BIT ) return value;
+  }
+  throw InvalidMessage( "FAST integer is too long" );
+}
+
+int64_t readSigned( const unsigned char*& pos, const unsigned char* end )
+{
+  if ( pos == end ) throw InvalidMessage( "FAST message is truncated" );
+  uint64_t value = ( *pos & SIGN_BIT ) ? ~uint64_t( 0 ) : 0;
+  for ( int i = 0; i < MAX_INTEGER_BYTES; ++i )
+  {
+    if ( pos == end ) throw InvalidMessage( "FAST message is truncated" );
+    unsigned char byte = *pos++;
+    value = ( value << 7 ) | ( byte & 0x7F );
+    if ( byte & STOP_BIT ) return (int64_t)value;
+  }
+  throw InvalidMessage( "FAST integer is too long" );
+}
+
+/// Read a signed integer, returning false if it is null
+bool readSigned( const unsigned char*& pos, const unsigned char* end,
+                 bool nullable, int64_t& value )
+{
+  value = readSigned( pos, end );
+  if ( !nullable ) return true;
+  if ( value == 0 ) return false;
+  if ( value > 0 ) --value;
+  return true;
+}
+
+/// Read the bytes of an ascii string, without the stop bit
+void readAscii( const unsigned char*& pos, const unsigned char* end,
+                std::string& value )
+{
+  const unsigned char* start = pos;
+  do
+  {
+    if ( pos == end ) throw InvalidMessage( "FAST message is truncated" );
+  } while ( !( *pos++ & STOP_BIT ) );
+  value.assign( (const char*)start, pos - start );
+  value[ value.size() - 1 ] &= 0x7F;
+}
+
+void writeUnsigned( std::string& out, uint64_t value )
+{
+  unsigned char bytes[ MAX_INTEGER_BYTES ];
+  int size = 0;
+  do
+  {
+    bytes[ size++ ] = (unsigned char)( value & 0x7F );
+    value >>= 7;
+  } while ( value );
+  bytes[ 0 ] |= STOP_BIT;
+  while ( size ) out += (char)bytes[ --size ];
+}
+
+void writeSigned( std::string& out, int64_t value )
+{
+  unsigned char bytes[ MAX_INTEGER_BYTES ];
+  int size = 0;
+  for ( ;; )
+  {
+    unsigned char byte = (unsigned char)( value & 0x7F );
+    bytes[ size++ ] = byte;
+    value >>= 7;
+    if ( ( value == 0 && !( byte & SIGN_BIT ) )
+         || ( value == -1 && ( byte & SIGN_BIT ) ) )
+      break;
+  }
+  bytes[ 0 ] |= STOP_BIT;
+  while ( size ) out += (char)bytes[ --size ];
+}
+
+void writeSigned( std::string& out, int64_t value, bool nullable )
+{
+  writeSigned( out, nullable && value >= 0 ? value + 1 : value );
+}
+
+void writeAscii( std::string& out, const std::string& value, bool nullable )
+{
+  if ( value.empty() )
+  {
+    if ( nullable ) out += '\0';
+    out += (char)STOP_BIT;
+    return;
+  }
+  out += value;
+  out[ out.size() - 1 ] |= (char)STOP_BIT;
+}
+
+void writeNull( std::string& out )
+{
+  out += (char)STOP_BIT;
+}
+
+bool parseInteger( const std::string& text, int64_t& result )
+{
+  const char* pos = text.data();
+  const char* end = pos + text.size();
+  bool negative = pos != end && *pos == '-';
+  if ( negative ) ++pos;
+  if ( pos == end ) return false;
+
+  uint64_t magnitude = 0;
+  for ( ; pos != end; ++pos )
+  {
+    unsigned int digit = (unsigned char)( *pos - '0' );
+    if ( digit > 9 ) return false;
+    if ( magnitude > ( ~uint64_t( 0 ) - digit ) / 10 ) return false;
+    magnitude = magnitude * 10 + digit;
+  }
+
+  if ( magnitude > (uint64_t)MAX_INT64 + ( negative ? 1 : 0 ) ) return false;
+  result = negative ? (int64_t)( 0 - magnitude ) : (int64_t)magnitude;
+  return true;
+}
+
+/// Format value into buffer, which must hold at least 20 characters
+std::size_t formatInteger( int64_t value, char* buffer )
+{
+  char digits[ 20 ];
+  int size = 0;
+  uint64_t magnitude = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+  do
+  {
+    digits[ size++ ] = (char)( '0' + magnitude % 10 );
+    magnitude /= 10;
+  } while ( magnitude );
+
+  char* pos = buffer;
+  if ( value < 0 ) *pos++ = '-';
+  while ( size ) *pos++ = digits[ --size ];
+  return pos - buffer;
+}
+
+bool inRange( FastInstruction::Type type, int64_t value )
+{
+  switch ( type )
+  {
+    case FastInstruction::INT32:
+    return value >= -2147483647LL - 1 && value <= 2147483647LL;
+    case FastInstruction::UINT32:
+    case FastInstruction::SEQUENCE:
+    return value >= 0 && value <= 4294967295LL;
+    case FastInstruction::UINT64:
+    return value >= 0;
+    default:
+    return true;
+  }
+}
+
+/// True if value equals other, plus step for integers
+bool equals( const FastInstruction& instruction, const FastValue& value,
+             const FastValue& other, int64_t step = 0 )
+{
+  switch ( instruction.type )
+  {
+    case FastInstruction::ASCII:
+    return value.string == other.string;
+    case FastInstruction::DECIMAL:
+    return value.integer == other.integer && value.exponent == other.exponent;
+    default:
+    return (uint64_t)value.integer == (uint64_t)other.integer + step;
+  }
+}
+
+bool typeFromName( const std::string& name, FastInstruction::Type& type )
+{
+  if ( name == "int32" ) type = FastInstruction::INT32;
+  else if ( name == "uInt32" ) type = FastInstruction::UINT32;
+  else if ( name == "int64" ) type = FastInstruction::INT64;
+  else if ( name == "uInt64" ) type = FastInstruction::UINT64;
+  else if ( name == "decimal" ) type = FastInstruction::DECIMAL;
+  else if ( name == "string" ) type = FastInstruction::ASCII;
+  else if ( name == "sequence" ) type = FastInstruction::SEQUENCE;
+  else return false;
+  return true;
+}
+
+/// Header, trailer or body of a message a top level field belongs to
+FieldMap& fieldMapFor( Message* pMessage, FieldMap& map, int tag,
+                       const DataDictionary& dataDictionary )
+{
+  if ( !pMessage ) return map;
+  if ( Message::isHeaderField( tag, &dataDictionary ) )
+    return pMessage->getHeader();
+  if ( Message::isTrailerField( tag, &dataDictionary ) )
+    return pMessage->getTrailer();
+  return map;
+}
+
+const FieldMap& fieldMapFor( const Message* pMessage, const FieldMap& map,
+                             int tag, const DataDictionary& dataDictionary )
+{
+  if ( !pMessage ) return map;
+  if ( Message::isHeaderField( tag, &dataDictionary ) )
+    return pMessage->getHeader();
+  if ( Message::isTrailerField( tag, &dataDictionary ) )
+    return pMessage->getTrailer();
+  return map;
+}
+}
+
+FastTemplates::FastTemplates( const DataDictionary& dataDictionary )
+: m_dataDictionary( dataDictionary ) {}
+
+FastTemplates::FastTemplates( const DataDictionary& dataDictionary,
+                              const std::string& url )
+EXCEPT ( ConfigError )
+: m_dataDictionary( dataDictionary )
+{
+  readFromURL( url );
+}
+
+void FastTemplates::readFromURL( const std::string& url )
+EXCEPT ( ConfigError )
+{
+  DOMDocumentPtr pDoc( new PUGIXML_DOMDocument() );
+
+  if( !pDoc->load( url ) )
+    throw ConfigError( url + ": Could not parse FAST template file" );
+
+  try
+  {
+    readFromDocument( pDoc );
+  }
+  catch( ConfigError& e )
+  {
+    throw ConfigError( url + ": " + e.detail );
+  }
+}
+
+void FastTemplates::readFromStream( std::istream& stream )
+EXCEPT ( ConfigError )
+{
+  DOMDocumentPtr pDoc( new PUGIXML_DOMDocument() );
+
+  if( !pDoc->load( stream ) )
+    throw ConfigError( "Could not parse FAST template stream" );
+
+  readFromDocument( pDoc );
+}
+
+void FastTemplates::readFromDocument( const DOMDocumentPtr& pDoc )
+EXCEPT ( ConfigError )
+{
+  DOMNodePtr pTemplatesNode = pDoc->getNode( "/templates" );
+  if( !pTemplatesNode.get() )
+    throw ConfigError( "No <templates> node found at root" );
+
+  DOMNodePtr pNode = pTemplatesNode->getFirstChildNode();
+  while( pNode.get() )
+  {
+    if( pNode->getName() == "template" )
+      readTemplate( pNode.get() );
+    RESET_AUTO_PTR( pNode, pNode->getNextSiblingNode() );
+  }
+}
+
+void FastTemplates::readTemplate( DOMNode* pNode )
+EXCEPT ( ConfigError )
+{
+  DOMAttributesPtr attrs = pNode->getAttributes();
+  FastTemplate fastTemplate;
+  if( !attrs->get( "name", fastTemplate.name ) )
+    throw ConfigError( "<template> does not have a name attribute" );
+  std::string context = "<template> " + fastTemplate.name;
+
+  std::string id;
+  if( !attrs->get( "id", id ) )
+    throw ConfigError( context + " does not have an id attribute" );
+  int64_t templateId = 0;
+  if( !parseInteger( id, templateId ) || !inRange( FastInstruction::UINT32, templateId ) )
+    throw ConfigError( context + " has an invalid id " + id );
+  fastTemplate.id = (int)templateId;
+  if( m_templates.find( fastTemplate.id ) != m_templates.end() )
+    throw ConfigError( context + " reuses template id " + id );
+
+  std::string dictionary;
+  if( attrs->get( "dictionary", dictionary ) && dictionary != "global" )
+    throw ConfigError( context + " uses the unsupported " + dictionary + " dictionary" );
+
+  try
+  {
+    readInstructions( pNode, fastTemplate.instructions, 0 );
+
+    FastInstructions::const_iterator i;
+    for( i = fastTemplate.instructions.begin(); i != fastTemplate.instructions.end(); ++i )
+    {
+      if( i->tag == FIELD::MsgType && i->type == FastInstruction::ASCII
+          && i->op == FastInstruction::CONSTANT && !i->optional )
+        fastTemplate.msgType = i->initial.string;
+    }
+    if( fastTemplate.msgType.empty() )
+      throw ConfigError( "has no constant MsgType field" );
+
+    resolveGroups( fastTemplate.instructions, fastTemplate.msgType, m_dataDictionary );
+  }
+  catch( ConfigError& e )
+  {
+    throw ConfigError( context + ": " + e.detail );
+  }
+
+  m_msgTypes.insert( std::make_pair( fastTemplate.msgType, fastTemplate.id ) );
+  m_templates[ fastTemplate.id ] = fastTemplate;
+}
+
+void FastTemplates::readInstructions( DOMNode* pNode,
+                                      FastInstructions& instructions,
+                                      FastInstruction* pSequence )
+EXCEPT ( ConfigError )
+{
+  DOMNodePtr pChild = pNode->getFirstChildNode();
+  while( pChild.get() )
+  {
+    readInstruction( pChild.get(), instructions, pSequence );
+    RESET_AUTO_PTR( pChild, pChild->getNextSiblingNode() );
+  }
+}
+
+void FastTemplates::readInstruction( DOMNode* pNode,
+                                     FastInstructions& instructions,
+                                     FastInstruction* pSequence )
+EXCEPT ( ConfigError )
+{
+  std::string name = pNode->getName();
+  if( name.empty() || name == "typeRef" ) return;
+
+  if( name == "length" )
+  {
+    if( !pSequence )
+      throw ConfigError( "<length> found outside of a <sequence>" );
+    readField( pNode, *pSequence );
+    return;
+  }
+
+  FastInstruction instruction;
+  if( !typeFromName( name, instruction.type ) )
+    throw ConfigError( "<" + name + "> is not supported" );
+
+  DOMAttributesPtr attrs = pNode->getAttributes();
+  attrs->get( "name", instruction.name );
+  std::string presence;
+  if( attrs->get( "presence", presence ) )
+  {
+    if( presence != "mandatory" && presence != "optional" )
+      throw ConfigError( "<" + name + "> " + instruction.name
+                         + " has invalid presence " + presence );
+    instruction.optional = presence == "optional";
+  }
+
+  if( instruction.type == FastInstruction::SEQUENCE )
+  {
+    readInstructions( pNode, instruction.instructions, &instruction );
+    if( !instruction.tag )
+      throw ConfigError( "<sequence> " + instruction.name
+                         + " does not have a <length> with an id" );
+
+    FastInstructions::const_iterator i;
+    for( i = instruction.instructions.begin(); i != instruction.instructions.end(); ++i )
+    {
+      if( i->usesPresenceBit() ) instruction.hasPresenceMap = true;
+      if( i->alwaysReads() ) instruction.elementReadsInput = true;
+    }
+    if( instruction.hasPresenceMap ) instruction.elementReadsInput = true;
+  }
+  else
+  {
+    std::string charset;
+    if( instruction.type == FastInstruction::ASCII
+        && attrs->get( "charset", charset ) && charset != "ascii" )
+      throw ConfigError( "<string> " + instruction.name
+                         + " uses the unsupported " + charset + " charset" );
+    readField( pNode, instruction );
+  }
+
+  instructions.push_back( instruction );
+}
+
+void FastTemplates::readField( DOMNode* pNode, FastInstruction& instruction )
+EXCEPT ( ConfigError )
+{
+  DOMAttributesPtr attrs = pNode->getAttributes();
+  attrs->get( "name", instruction.name );
+  std::string context = "<" + pNode->getName() + "> " + instruction.name;
+
+  std::string id;
+  if( !attrs->get( "id", id ) )
+    throw ConfigError( context + " does not have an id attribute" );
+  instruction.tag = atoi( id.c_str() );
+  if( instruction.tag <= 0 )
+    throw ConfigError( context + " has an invalid id " + id );
+  checkField( instruction );
+
+  DOMNodePtr pChild = pNode->getFirstChildNode();
+  while( pChild.get() )
+  {
+    if( !pChild->getName().empty() )
+    {
+      if( instruction.op != FastInstruction::NONE )
+        throw ConfigError( context + " has more than one operator" );
+      readOperator( pChild.get(), instruction );
+    }
+    RESET_AUTO_PTR( pChild, pChild->getNextSiblingNode() );
+  }
+}
+
+void FastTemplates::readOperator( DOMNode* pNode, FastInstruction& instruction )
+EXCEPT ( ConfigError )
+{
+  std::string name = pNode->getName();
+  std::string context = "<" + name + "> of " + instruction.name;
+
+  if( name == "constant" ) instruction.op = FastInstruction::CONSTANT;
+  else if( name == "default" ) instruction.op = FastInstruction::DEFAULT;
+  else if( name == "copy" ) instruction.op = FastInstruction::COPY;
+  else if( name == "increment" ) instruction.op = FastInstruction::INCREMENT;
+  else if( name == "delta" ) instruction.op = FastInstruction::DELTA;
+  else throw ConfigError( "<" + name + "> is not supported" );
+
+  DOMAttributesPtr attrs = pNode->getAttributes();
+  std::string value;
+  if( attrs->get( "value", value ) )
+  {
+    FastValue& initial = instruction.initial;
+    if( instruction.type == FastInstruction::ASCII )
+      initial.string = value;
+    else if( instruction.type == FastInstruction::DECIMAL )
+    {
+      Decimal decimal;
+      if( !Decimal::parse( value.data(), value.data() + value.size(), decimal )
+          || decimal.getExponent() < -MAX_EXPONENT
+          || decimal.getExponent() > MAX_EXPONENT )
+        throw ConfigError( context + " has an invalid value " + value );
+      initial.integer = decimal.getMantissa();
+      initial.exponent = decimal.getExponent();
+    }
+    else if( !parseInteger( value, initial.integer )
+             || !inRange( instruction.type, initial.integer ) )
+      throw ConfigError( context + " has an invalid value " + value );
+    initial.state = FastValue::ASSIGNED;
+  }
+
+  bool hasInitial = instruction.initial.state == FastValue::ASSIGNED;
+  if( instruction.op == FastInstruction::CONSTANT && !hasInitial )
+    throw ConfigError( context + " does not have a value" );
+  if( instruction.op == FastInstruction::DEFAULT && !hasInitial && !instruction.optional )
+    throw ConfigError( context + " does not have a value" );
+  if( instruction.op == FastInstruction::INCREMENT && !instruction.isInteger() )
+    throw ConfigError( context + " is not an integer" );
+
+  std::string dictionary;
+  if( attrs->get( "dictionary", dictionary ) && dictionary != "global" )
+    throw ConfigError( context + " uses the unsupported " + dictionary + " dictionary" );
+
+  if( instruction.op == FastInstruction::COPY
+      || instruction.op == FastInstruction::INCREMENT
+      || instruction.op == FastInstruction::DELTA )
+  {
+    std::string key;
+    if( !attrs->get( "key", key ) )
+      key = instruction.name.empty() ? "id:" + IntConvertor::convert( instruction.tag )
+                                     : instruction.name;
+    instruction.slot = getSlot( key, instruction.type );
+  }
+}
+
+void FastTemplates::checkField( const FastInstruction& instruction ) const
+EXCEPT ( ConfigError )
+{
+  std::string field = IntConvertor::convert( instruction.tag );
+  if( !m_dataDictionary.isField( instruction.tag ) )
+    throw ConfigError( "Field " + field + " is not defined in the data dictionary" );
+
+  TYPE::Type type;
+  if( !m_dataDictionary.getFieldType( instruction.tag, type ) ) return;
+
+  if( instruction.type == FastInstruction::DECIMAL )
+  {
+    switch( type )
+    {
+      case TYPE::Price: case TYPE::Amt: case TYPE::Qty: case TYPE::Float:
+      case TYPE::PriceOffset: case TYPE::Percentage: case TYPE::Unknown:
+      return;
+      default:
+      throw ConfigError( "Field " + field + " is not a decimal field" );
+    }
+  }
+  else if( instruction.isInteger() )
+  {
+    switch( type )
+    {
+      case TYPE::Int: case TYPE::Length: case TYPE::NumInGroup:
+      case TYPE::SeqNum: case TYPE::DayOfMonth: case TYPE::LocalMktDate:
+      case TYPE::UtcDate: case TYPE::MonthYear: case TYPE::Unknown:
+      return;
+      default:
+      throw ConfigError( "Field " + field + " is not an integer field" );
+    }
+  }
+}
+
+void FastTemplates::resolveGroups( FastInstructions& instructions,
+                                   const std::string& msgType,
+                                   const DataDictionary& dataDictionary ) const
+EXCEPT ( ConfigError )
+{
+  FastInstructions::iterator i;
+  for( i = instructions.begin(); i != instructions.end(); ++i )
+  {
+    if( i->type != FastInstruction::SEQUENCE ) continue;
+
+    std::string field = IntConvertor::convert( i->tag );
+    const DataDictionary* pGroupDD = 0;
+    if( !dataDictionary.getGroup( msgType, i->tag, i->delim, pGroupDD ) )
+      throw ConfigError( "Field " + field + " is not a repeating group of "
+                         + msgType );
+    i->order = pGroupDD->getOrderedFields();
+
+    bool hasDelimiter = false;
+    FastInstructions::const_iterator j;
+    for( j = i->instructions.begin(); j != i->instructions.end(); ++j )
+      if( j->tag == i->delim ) hasDelimiter = true;
+    if( !hasDelimiter )
+      throw ConfigError( "<sequence> " + i->name + " does not contain the group delimiter "
+                         + IntConvertor::convert( i->delim ) );
+
+    resolveGroups( i->instructions, msgType, *pGroupDD );
+  }
+}
+
+int FastTemplates::getSlot( const std::string& key, FastInstruction::Type type )
+EXCEPT ( ConfigError )
+{
+  if( type == FastInstruction::SEQUENCE ) type = FastInstruction::UINT32;
+
+  KeyToSlot::const_iterator i = m_slots.find( key );
+  if( i != m_slots.end() )
+  {
+    if( m_slotTypes[ i->second ] != type )
+      throw ConfigError( "Dictionary key " + key + " is used with different types" );
+    return i->second;
+  }
+
+  int slot = (int)m_slotTypes.size();
+  m_slots[ key ] = slot;
+  m_slotTypes.push_back( type );
+  return slot;
+}
+
+/// Presence map of a message or sequence element being decoded
+struct FastDecoder::PresenceMap
+{
+  PresenceMap() : bytes( 0 ), size( 0 ), bit( 0 ) {}
+
+  void read( const unsigned char*& pos, const unsigned char* end )
+  {
+    bytes = pos;
+    do
+    {
+      if( pos == end ) throw InvalidMessage( "FAST message is truncated" );
+    } while( !( *pos++ & STOP_BIT ) );
+    size = pos - bytes;
+    bit = 0;
+  }
+
+  /// Next bit, bits past the end of the map are clear
+  bool next()
+  {
+    std::size_t byte = bit / 7;
+    unsigned char mask = (unsigned char)( SIGN_BIT >> ( bit % 7 ) );
+    ++bit;
+    return byte < size && ( bytes[ byte ] & mask );
+  }
+
+  const unsigned char* bytes;
+  std::size_t size;
+  std::size_t bit;
+};
+
+FastDecoder::FastDecoder( const FastTemplates& templates )
+: m_templates( templates ), m_templateId( -1 ), m_pArena( 0 ),
+  m_pos( 0 ), m_end( 0 ), m_emptyElements( 0 )
+{
+  reset();
+}
+
+void FastDecoder::reset()
+{
+  m_dictionary.assign( m_templates.getSlotCount(), FastValue() );
+  m_templateId = -1;
+}
+
+std::size_t FastDecoder::decode( const char* begin, const char* end,
+                                 Message& message )
+EXCEPT ( InvalidMessage )
+{
+  if( m_dictionary.size() < (std::size_t)m_templates.getSlotCount() )
+    m_dictionary.resize( m_templates.getSlotCount() );
+
+  m_pos = (const unsigned char*)begin;
+  m_end = (const unsigned char*)end;
+  // groups come from the arena of the message, released by clear()
+  message.clear();
+  m_pArena = &message.m_groupArena;
+  m_emptyElements = MAX_EMPTY_ELEMENTS;
+
+  PresenceMap pmap;
+  pmap.read( m_pos, m_end );
+  if( pmap.next() )
+  {
+    uint64_t templateId = readUnsigned( m_pos, m_end );
+    if( templateId > 0xFFFFFFFFULL )
+      throw InvalidMessage( "FAST template id is out of range" );
+    m_templateId = (int)templateId;
+  }
+  else if( m_templateId < 0 )
+    throw InvalidMessage( "FAST message does not have a template id" );
+
+  const FastTemplate* pTemplate = m_templates.getTemplate( m_templateId );
+  if( !pTemplate )
+    throw InvalidMessage( "Unknown FAST template id "
+                          + IntConvertor::convert( m_templateId ) );
+
+  std::string beginString = m_templates.getDataDictionary().getVersion();
+  if( !beginString.empty() )
+    message.getHeader().setField( BeginString( beginString ) );
+
+  decodeInstructions( pTemplate->instructions, pmap, &message, message );
+  return (const char*)m_pos - begin;
+}
+
+void FastDecoder::decodeInstructions( const FastInstructions& instructions,
+                                      PresenceMap& pmap, Message* pMessage,
+                                      FieldMap& map )
+{
+  const DataDictionary& dataDictionary = m_templates.getDataDictionary();
+
+  FastInstructions::const_iterator i;
+  for( i = instructions.begin(); i != instructions.end(); ++i )
+  {
+    if( !decodeValue( *i, pmap, m_value ) ) continue;
+    if( i->type != FastInstruction::SEQUENCE )
+    {
+      setField( *i, m_value, pMessage, map );
+      continue;
+    }
+
+    // elements that take a byte each cannot outnumber the bytes left,
+    // the others share a fixed allowance per message
+    int64_t count = m_value.integer;
+    if( i->elementReadsInput )
+    {
+      if( count > m_end - m_pos )
+        throw InvalidMessage( "FAST sequence is longer than the message" );
+    }
+    else
+    {
+      if( count > m_emptyElements )
+        throw InvalidMessage( "FAST sequence has too many empty elements" );
+      m_emptyElements -= count;
+    }
+
+    FieldMap& target = fieldMapFor( pMessage, map, i->tag, dataDictionary );
+    setField( *i, m_value, 0, target );
+    for( int64_t num = 0; num < count; ++num )
+    {
+      PresenceMap elementPmap;
+      if( i->hasPresenceMap ) elementPmap.read( m_pos, m_end );
+
+      FieldMap* pGroup = m_pArena->allocate( i->order );
+      target.addGroupPtr( i->tag, pGroup, false );
+      decodeInstructions( i->instructions, elementPmap, 0, *pGroup );
+    }
+  }
+}
+
+bool FastDecoder::decodeValue( const FastInstruction& instruction,
+                               PresenceMap& pmap, FastValue& value )
+{
+  FastValue* pPrevious = instruction.slot < 0 ? 0 : &m_dictionary[ instruction.slot ];
+
+  switch( instruction.op )
+  {
+    case FastInstruction::NONE:
+    readValue( instruction, instruction.optional, value );
+    break;
+
+    case FastInstruction::CONSTANT:
+    if( instruction.optional && !pmap.next() ) return false;
+    value = instruction.initial;
+    break;
+
+    case FastInstruction::DEFAULT:
+    if( pmap.next() ) readValue( instruction, instruction.optional, value );
+    else value = instruction.initial;
+    break;
+
+    case FastInstruction::COPY:
+    case FastInstruction::INCREMENT:
+    if( pmap.next() )
+    {
+      readValue( instruction, instruction.optional, value );
+      *pPrevious = value;
+      break;
+    }
+
+    if( pPrevious->state == FastValue::UNDEFINED )
+    {
+      *pPrevious = instruction.initial;
+      if( pPrevious->state != FastValue::ASSIGNED )
+        pPrevious->state = FastValue::EMPTY;
+    }
+    else if( pPrevious->state == FastValue::ASSIGNED
+             && instruction.op == FastInstruction::INCREMENT )
+    {
+      pPrevious->integer = (int64_t)( (uint64_t)pPrevious->integer + 1 );
+      if( !inRange( instruction.type, pPrevious->integer ) )
+        throw InvalidMessage( "FAST increment of field "
+                              + IntConvertor::convert( instruction.tag )
+                              + " is out of range" );
+    }
+
+    if( pPrevious->state != FastValue::ASSIGNED && !instruction.optional )
+      throw InvalidMessage( "FAST field " + IntConvertor::convert( instruction.tag )
+                            + " does not have a previous value" );
+    value = *pPrevious;
+    break;
+
+    case FastInstruction::DELTA:
+    {
+      const FastValue& base = pPrevious->state == FastValue::ASSIGNED
+                              ? *pPrevious : instruction.initial;
+      int64_t delta = 0;
+      if( instruction.type == FastInstruction::ASCII )
+      {
+        if( !readSigned( m_pos, m_end, instruction.optional, delta ) )
+          return false;
+        readAscii( m_pos, m_end, m_delta );
+        if( m_delta.size() == 1 && m_delta[ 0 ] == 0 ) m_delta.clear();
+
+        uint64_t length = base.string.size();
+        if( delta >= 0 )
+        {
+          if( (uint64_t)delta > length )
+            throw InvalidMessage( "FAST string delta is longer than its base" );
+          value.string.assign( base.string, 0, (std::size_t)( length - delta ) );
+          value.string += m_delta;
+        }
+        else
+        {
+          if( (uint64_t)( -( delta + 1 ) ) > length )
+            throw InvalidMessage( "FAST string delta is longer than its base" );
+          value.string = m_delta;
+          value.string.append( base.string, (std::size_t)( -( delta + 1 ) ),
+                               std::string::npos );
+        }
+      }
+      else if( instruction.type == FastInstruction::DECIMAL )
+      {
+        if( !readSigned( m_pos, m_end, instruction.optional, delta ) )
+          return false;
+        value.exponent = (int)( base.exponent + delta );
+        if( delta < -2 * MAX_EXPONENT || delta > 2 * MAX_EXPONENT
+            || value.exponent < -MAX_EXPONENT || value.exponent > MAX_EXPONENT )
+          throw InvalidMessage( "FAST decimal exponent is out of range" );
+        value.integer = (int64_t)( (uint64_t)base.integer
+                                   + (uint64_t)readSigned( m_pos, m_end ) );
+      }
+      else
+      {
+        if( !readSigned( m_pos, m_end, instruction.optional, delta ) )
+          return false;
+        value.integer = (int64_t)( (uint64_t)base.integer + (uint64_t)delta );
+        if( !inRange( instruction.type, value.integer ) )
+          throw InvalidMessage( "FAST delta of field "
+                                + IntConvertor::convert( instruction.tag )
+                                + " is out of range" );
+      }
+      value.state = FastValue::ASSIGNED;
+      *pPrevious = value;
+    }
+    break;
+  }
+
+  return value.state == FastValue::ASSIGNED;
+}
+
+void FastDecoder::readValue( const FastInstruction& instruction, bool nullable,
+                             FastValue& value )
+{
+  value.state = FastValue::ASSIGNED;
+
+  switch( instruction.type )
+  {
+    case FastInstruction::ASCII:
+    readAscii( m_pos, m_end, value.string );
+    if( value.string.size() == 1 && value.string[ 0 ] == 0 )
+    {
+      if( nullable ) value.state = FastValue::EMPTY;
+      value.string.clear();
+    }
+    else if( nullable && value.string.size() == 2
+             && value.string[ 0 ] == 0 && value.string[ 1 ] == 0 )
+      value.string.clear();
+    break;
+
+    case FastInstruction::DECIMAL:
+    {
+      int64_t exponent = 0;
+      if( !readSigned( m_pos, m_end, nullable, exponent ) )
+      {
+        value.state = FastValue::EMPTY;
+        break;
+      }
+      if( exponent < -MAX_EXPONENT || exponent > MAX_EXPONENT )
+        throw InvalidMessage( "FAST decimal exponent is out of range" );
+      value.exponent = (int)exponent;
+      value.integer = readSigned( m_pos, m_end );
+    }
+    break;
+
+    case FastInstruction::INT32:
+    case FastInstruction::INT64:
+    if( !readSigned( m_pos, m_end, nullable, value.integer ) )
+      value.state = FastValue::EMPTY;
+    else if( !inRange( instruction.type, value.integer ) )
+      throw InvalidMessage( "FAST field " + IntConvertor::convert( instruction.tag )
+                            + " is out of range" );
+    break;
+
+    default:
+    {
+      uint64_t integer = readUnsigned( m_pos, m_end );
+      if( nullable && integer-- == 0 )
+      {
+        value.state = FastValue::EMPTY;
+        break;
+      }
+      value.integer = (int64_t)integer;
+      if( integer > (uint64_t)MAX_INT64 || !inRange( instruction.type, value.integer ) )
+        throw InvalidMessage( "FAST field " + IntConvertor::convert( instruction.tag )
+                              + " is out of range" );
+    }
+    break;
+  }
+}
+
+void FastDecoder::setField( const FastInstruction& instruction,
+                            const FastValue& value, Message* pMessage,
+                            FieldMap& map )
+{
+  FieldMap& target = fieldMapFor( pMessage, map, instruction.tag,
+                                  m_templates.getDataDictionary() );
+  if( instruction.type == FastInstruction::ASCII )
+  {
+    target.setField( FieldBase( instruction.tag, value.string ) );
+    return;
+  }
+
+  // formatted the way the field classes format values set on them
+  if( instruction.type == FastInstruction::DECIMAL )
+  {
+    target.setField( DoubleField( instruction.tag,
+                                  Decimal( value.integer, value.exponent ) ) );
+    return;
+  }
+  if( value.integer >= std::numeric_limits < int >::min()
+      && value.integer <= std::numeric_limits < int >::max() )
+  {
+    target.setField( IntField( instruction.tag, (int)value.integer ) );
+    return;
+  }
+
+  char buffer[ Decimal::BUFFER_SIZE ];
+  std::size_t size = formatInteger( value.integer, buffer );
+  target.setField( FieldBase( instruction.tag, std::string( buffer, size ) ) );
+}
+
+FastEncoder::FastEncoder( const FastTemplates& templates )
+: m_templates( templates ), m_templateId( -1 )
+{
+  reset();
+}
+
+void FastEncoder::reset()
+{
+  m_dictionary.assign( m_templates.getSlotCount(), FastValue() );
+  m_templateId = -1;
+}
+
+void FastEncoder::encode( const Message& message, std::string& result )
+EXCEPT ( FieldNotFound, IncorrectDataFormat )
+{
+  const std::string& msgType = message.getHeader().getField( FIELD::MsgType );
+  const FastTemplate* pTemplate = m_templates.getTemplate( msgType );
+  if( !pTemplate )
+    throw IncorrectDataFormat( FIELD::MsgType,
+                               "No FAST template for message type " + msgType );
+  encode( *pTemplate, message, result );
+}
+
+void FastEncoder::encode( int templateId, const Message& message,
+                          std::string& result )
+EXCEPT ( FieldNotFound, IncorrectDataFormat )
+{
+  const FastTemplate* pTemplate = m_templates.getTemplate( templateId );
+  if( !pTemplate )
+    throw IncorrectDataFormat( 0, "No FAST template with id "
+                               + IntConvertor::convert( templateId ) );
+  encode( *pTemplate, message, result );
+}
+
+void FastEncoder::encode( const FastTemplate& fastTemplate,
+                          const Message& message, std::string& result )
+{
+  if( m_dictionary.size() < (std::size_t)m_templates.getSlotCount() )
+    m_dictionary.resize( m_templates.getSlotCount() );
+
+  Buffer& buffer = getBuffer( 0 );
+  bool newTemplate = fastTemplate.id != m_templateId;
+  setBit( buffer, newTemplate );
+  if( newTemplate ) writeUnsigned( buffer.body, fastTemplate.id );
+  m_templateId = fastTemplate.id;
+
+  encodeInstructions( fastTemplate.instructions, &message, message, 0 );
+  append( buffer, true, result );
+}
+
+void FastEncoder::encodeInstructions( const FastInstructions& instructions,
+                                      const Message* pMessage,
+                                      const FieldMap& map, std::size_t depth )
+{
+  const DataDictionary& dataDictionary = m_templates.getDataDictionary();
+  Buffer& buffer = m_buffers[ depth ];
+
+  FastInstructions::const_iterator i;
+  for( i = instructions.begin(); i != instructions.end(); ++i )
+  {
+    if( i->type != FastInstruction::SEQUENCE )
+    {
+      bool present = getValue( *i, pMessage, map, m_value );
+      if( !present && !i->optional && i->op != FastInstruction::CONSTANT )
+        throw FieldNotFound( i->tag );
+      encodeValue( *i, present, m_value, buffer );
+      continue;
+    }
+
+    const FieldMap& source = fieldMapFor( pMessage, map, i->tag, dataDictionary );
+    std::size_t count = source.groupCount( i->tag );
+    bool present = count || !i->optional || source.isSetField( i->tag );
+    m_value.state = FastValue::ASSIGNED;
+    m_value.integer = count;
+    encodeValue( *i, present, m_value, buffer );
+
+    for( std::size_t num = 1; num <= count; ++num )
+    {
+      Buffer& element = getBuffer( depth + 1 );
+      encodeInstructions( i->instructions, 0,
+                          source.getGroupRef( (int)num, i->tag ), depth + 1 );
+      append( element, i->hasPresenceMap, buffer.body );
+    }
+  }
+}
+
+bool FastEncoder::getValue( const FastInstruction& instruction,
+                            const Message* pMessage, const FieldMap& map,
+                            FastValue& value ) const
+{
+  const FieldMap& source = fieldMapFor( pMessage, map, instruction.tag,
+                                        m_templates.getDataDictionary() );
+  if( !source.isSetField( instruction.tag ) ) return false;
+  const std::string& text = source.getField( instruction.tag );
+  value.state = FastValue::ASSIGNED;
+
+  switch( instruction.type )
+  {
+    case FastInstruction::ASCII:
+    for( std::string::const_iterator c = text.begin(); c != text.end(); ++c )
+    {
+      if( *c == 0 || ( *c & STOP_BIT ) )
+        throw IncorrectDataFormat( instruction.tag, "FAST strings must be ascii" );
+    }
+    value.string = text;
+    break;
+
+    case FastInstruction::DECIMAL:
+    {
+      Decimal decimal;
+      if( !Decimal::parse( text.data(), text.data() + text.size(), decimal )
+          || decimal.getExponent() < -MAX_EXPONENT
+          || decimal.getExponent() > MAX_EXPONENT )
+        throw IncorrectDataFormat( instruction.tag, text );
+      value.integer = decimal.getMantissa();
+      value.exponent = decimal.getExponent();
+    }
+    break;
+
+    default:
+    if( !parseInteger( text, value.integer )
+        || !inRange( instruction.type, value.integer ) )
+      throw IncorrectDataFormat( instruction.tag, text );
+    break;
+  }
+  return true;
+}
+
+void FastEncoder::encodeValue( const FastInstruction& instruction, bool present,
+                               const FastValue& value, Buffer& buffer )
+{
+  FastValue* pPrevious = instruction.slot < 0 ? 0 : &m_dictionary[ instruction.slot ];
+
+  switch( instruction.op )
+  {
+    case FastInstruction::NONE:
+    writeValue( instruction, instruction.optional, present, value, buffer.body );
+    break;
+
+    case FastInstruction::CONSTANT:
+    if( present && !equals( instruction, value, instruction.initial ) )
+      throw IncorrectDataFormat( instruction.tag, "Value differs from the FAST constant" );
+    if( instruction.optional ) setBit( buffer, present );
+    break;
+
+    case FastInstruction::DEFAULT:
+    {
+      bool implied = present
+        ? instruction.initial.state == FastValue::ASSIGNED
+          && equals( instruction, value, instruction.initial )
+        : instruction.initial.state != FastValue::ASSIGNED;
+      setBit( buffer, !implied );
+      if( !implied )
+        writeValue( instruction, instruction.optional, present, value, buffer.body );
+    }
+    break;
+
+    case FastInstruction::COPY:
+    case FastInstruction::INCREMENT:
+    {
+      // the value the decoder infers when the presence bit is clear
+      const FastValue& implied = pPrevious->state == FastValue::UNDEFINED
+                                 ? instruction.initial : *pPrevious;
+      int64_t step = instruction.op == FastInstruction::INCREMENT
+                     && pPrevious->state == FastValue::ASSIGNED ? 1 : 0;
+      bool same = implied.state == FastValue::ASSIGNED
+                  ? present && equals( instruction, value, implied, step )
+                  : !present;
+      setBit( buffer, !same );
+      if( !same )
+        writeValue( instruction, instruction.optional, present, value, buffer.body );
+      if( present ) *pPrevious = value;
+      else pPrevious->state = FastValue::EMPTY;
+    }
+    break;
+
+    case FastInstruction::DELTA:
+    {
+      if( !present )
+      {
+        writeNull( buffer.body );
+        break;
+      }
+
+      const FastValue& base = pPrevious->state == FastValue::ASSIGNED
+                              ? *pPrevious : instruction.initial;
+      if( instruction.type == FastInstruction::ASCII )
+      {
+        const std::string& from = base.string;
+        const std::string& to = value.string;
+        std::size_t shortest = std::min( from.size(), to.size() );
+        std::size_t prefix = 0;
+        while( prefix < shortest && from[ prefix ] == to[ prefix ] ) ++prefix;
+        std::size_t suffix = 0;
+        while( suffix < shortest
+               && from[ from.size() - suffix - 1 ] == to[ to.size() - suffix - 1 ] )
+          ++suffix;
+
+        if( suffix > prefix )
+        {
+          writeSigned( buffer.body, -(int64_t)( from.size() - suffix ) - 1,
+                       instruction.optional );
+          m_delta.assign( to, 0, to.size() - suffix );
+        }
+        else
+        {
+          writeSigned( buffer.body, (int64_t)( from.size() - prefix ),
+                       instruction.optional );
+          m_delta.assign( to, prefix, std::string::npos );
+        }
+        writeAscii( buffer.body, m_delta, false );
+      }
+      else if( instruction.type == FastInstruction::DECIMAL )
+      {
+        writeSigned( buffer.body, (int64_t)value.exponent - base.exponent,
+                     instruction.optional );
+        writeSigned( buffer.body,
+                     (int64_t)( (uint64_t)value.integer - (uint64_t)base.integer ) );
+      }
+      else
+      {
+        writeSigned( buffer.body,
+                     (int64_t)( (uint64_t)value.integer - (uint64_t)base.integer ),
+                     instruction.optional );
+      }
+      *pPrevious = value;
+    }
+    break;
+  }
+}
+
+void FastEncoder::writeValue( const FastInstruction& instruction, bool nullable,
+                              bool present, const FastValue& value,
+                              std::string& body )
+{
+  if( !present )
+  {
+    writeNull( body );
+    return;
+  }
+
+  switch( instruction.type )
+  {
+    case FastInstruction::ASCII:
+    writeAscii( body, value.string, nullable );
+    break;
+
+    case FastInstruction::DECIMAL:
+    writeSigned( body, value.exponent, nullable );
+    writeSigned( body, value.integer );
+    break;
+
+    case FastInstruction::INT32:
+    case FastInstruction::INT64:
+    writeSigned( body, value.integer, nullable );
+    break;
+
+    default:
+    writeUnsigned( body, (uint64_t)value.integer + ( nullable ? 1 : 0 ) );
+    break;
+  }
+}
+
+FastEncoder::Buffer& FastEncoder::getBuffer( std::size_t depth )
+{
+  // a deque keeps the buffers of outer sequences in place as it grows
+  if( depth >= m_buffers.size() ) m_buffers.resize( depth + 1 );
+  Buffer& buffer = m_buffers[ depth ];
+  buffer.pmap.clear();
+  buffer.bits = 0;
+  buffer.body.clear();
+  return buffer;
+}
+
+void FastEncoder::setBit( Buffer& buffer, bool set )
+{
+  int bit = buffer.bits++ % 7;
+  if( bit == 0 ) buffer.pmap += '\0';
+  if( set ) buffer.pmap[ buffer.pmap.size() - 1 ] |= (char)( SIGN_BIT >> bit );
+}
+
+void FastEncoder::append( const Buffer& buffer, bool hasPresenceMap,
+                          std::string& result )
+{
+  if( hasPresenceMap )
+  {
+    // trailing clear bits are implied, so only the first byte is required
+    std::size_t size = buffer.pmap.size();
+    while( size > 1 && buffer.pmap[ size - 1 ] == 0 ) --size;
+    if( size == 0 ) result += (char)STOP_BIT;
+    else
+    {
+      result.append( buffer.pmap, 0, size );
+      result[ result.size() - 1 ] |= (char)STOP_BIT;
+    }
+  }
+  result += buffer.body;
+}
+}
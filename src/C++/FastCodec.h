@@ -0,0 +1,302 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_FASTCODEC_H
+#define FIX_FASTCODEC_H
+
+#ifdef _MSC_VER
+#pragma warning( disable: 4786 )
+#endif
+
+#include "Message.h"
+#include "DataDictionary.h"
+#include "DOMDocument.h"
+#include "Exceptions.h"
+#include <deque>
+#include <istream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace FIX
+{
+/// Value of a FAST field or of an entry in the operator dictionary
+struct FastValue
+{
+  enum State { UNDEFINED, ASSIGNED, EMPTY };
+
+  FastValue() : state( UNDEFINED ), integer( 0 ), exponent( 0 ) {}
+
+  State state;
+  /// Integer value, or the mantissa of a decimal
+  int64_t integer;
+  int exponent;
+  std::string string;
+};
+
+/// A field or sequence of a FAST template
+struct FastInstruction
+{
+  enum Type { INT32, UINT32, INT64, UINT64, DECIMAL, ASCII, SEQUENCE };
+  enum Operator { NONE, CONSTANT, DEFAULT, COPY, INCREMENT, DELTA };
+
+  FastInstruction()
+  : type( ASCII ), op( NONE ), tag( 0 ), optional( false ), slot( -1 ),
+    delim( 0 ), hasPresenceMap( false ), elementReadsInput( false ) {}
+
+  /// True if the operator takes a bit of the presence map
+  bool usesPresenceBit() const
+  {
+    if ( op == CONSTANT ) return optional;
+    return op == DEFAULT || op == COPY || op == INCREMENT;
+  }
+
+  /// True if the operator reads the stream whenever it is decoded
+  bool alwaysReads() const { return op == NONE || op == DELTA; }
+
+  bool isInteger() const { return type != DECIMAL && type != ASCII; }
+  bool isSigned() const { return type == INT32 || type == INT64; }
+
+  std::string name;
+  Type type;
+  Operator op;
+  /// FIX tag the field maps to, the count field for a sequence
+  int tag;
+  bool optional;
+  FastValue initial;
+  /// Operator dictionary entry, -1 if the operator uses none
+  int slot;
+
+  /// Delimiter, order and fields of a sequence
+  int delim;
+  message_order order;
+  std::vector < FastInstruction > instructions;
+  /// True if sequence elements start with a presence map
+  bool hasPresenceMap;
+  /// True if every sequence element takes at least one byte
+  bool elementReadsInput;
+};
+
+typedef std::vector < FastInstruction > FastInstructions;
+
+/// A FAST template describing one FIX message type
+struct FastTemplate
+{
+  FastTemplate() : id( 0 ) {}
+
+  int id;
+  std::string name;
+  std::string msgType;
+  FastInstructions instructions;
+};
+
+/**
+ * FAST 1.1 templates for FIX messages, read from an XML template file.
+ *
+ * Each template describes one message type and must contain MsgType as
+ * a constant string field.  Field ids are FIX tags and each field must
+ * be defined by the DataDictionary with a compatible type.  A sequence
+ * maps to the repeating group whose count field is the id of its length.
+ *
+ * The integer, decimal and ascii string types are supported, with the
+ * constant, default, copy, increment and delta operators.  All operators
+ * share the global dictionary.  Unicode strings, byte vectors, static
+ * groups, template references, the tail operator and individual
+ * operators on decimal exponents and mantissas are rejected.
+ */
+class FastTemplates
+{
+public:
+  /// The DataDictionary must outlive the templates
+  FastTemplates( const DataDictionary& dataDictionary );
+  FastTemplates( const DataDictionary& dataDictionary,
+                 const std::string& url ) EXCEPT ( ConfigError );
+
+  void readFromURL( const std::string& url ) EXCEPT ( ConfigError );
+  void readFromStream( std::istream& stream ) EXCEPT ( ConfigError );
+  void readFromDocument( const DOMDocumentPtr& pDoc ) EXCEPT ( ConfigError );
+
+  /// Template with id, null if there is none
+  const FastTemplate* getTemplate( int id ) const
+  {
+    Templates::const_iterator i = m_templates.find( id );
+    return i == m_templates.end() ? 0 : &i->second;
+  }
+
+  /// Template for msgType, null if there is none
+  const FastTemplate* getTemplate( const std::string& msgType ) const
+  {
+    MsgTypeToId::const_iterator i = m_msgTypes.find( msgType );
+    return i == m_msgTypes.end() ? 0 : getTemplate( i->second );
+  }
+
+  const DataDictionary& getDataDictionary() const
+  { return m_dataDictionary; }
+
+  /// Number of entries in the operator dictionary
+  int getSlotCount() const { return (int)m_slotTypes.size(); }
+
+private:
+  typedef std::map < int, FastTemplate > Templates;
+  typedef std::map < std::string, int > MsgTypeToId;
+  typedef std::map < std::string, int > KeyToSlot;
+
+  void readTemplate( DOMNode* pNode ) EXCEPT ( ConfigError );
+  void readInstructions( DOMNode* pNode, FastInstructions& instructions,
+                         FastInstruction* pSequence )
+  EXCEPT ( ConfigError );
+  void readInstruction( DOMNode* pNode, FastInstructions& instructions,
+                        FastInstruction* pSequence )
+  EXCEPT ( ConfigError );
+  void readField( DOMNode* pNode, FastInstruction& instruction )
+  EXCEPT ( ConfigError );
+  void readOperator( DOMNode* pNode, FastInstruction& instruction )
+  EXCEPT ( ConfigError );
+  void checkField( const FastInstruction& instruction ) const
+  EXCEPT ( ConfigError );
+  void resolveGroups( FastInstructions& instructions,
+                      const std::string& msgType,
+                      const DataDictionary& dataDictionary ) const
+  EXCEPT ( ConfigError );
+  int getSlot( const std::string& key, FastInstruction::Type type )
+  EXCEPT ( ConfigError );
+
+  const DataDictionary& m_dataDictionary;
+  Templates m_templates;
+  MsgTypeToId m_msgTypes;
+  KeyToSlot m_slots;
+  std::vector < FastInstruction::Type > m_slotTypes;
+};
+
+/**
+ * Decodes FAST encoded messages into FIX messages.
+ *
+ * The decoder keeps the operator dictionary between messages, so a
+ * stream must be decoded in order by one decoder.  Call reset() where
+ * the encoder was reset.
+ */
+class FastDecoder
+{
+public:
+  FastDecoder( const FastTemplates& templates );
+
+  /**
+   * Decode one message starting at begin into message, which is
+   * cleared first.
+   *
+   * @return the number of bytes the message took
+   */
+  std::size_t decode( const char* begin, const char* end, Message& message )
+  EXCEPT ( InvalidMessage );
+
+  std::size_t decode( const std::string& data, Message& message )
+  EXCEPT ( InvalidMessage )
+  { return decode( data.data(), data.data() + data.size(), message ); }
+
+  /// Return the operator dictionary to its initial state
+  void reset();
+
+private:
+  struct PresenceMap;
+
+  /// Elements a message may hold in sequences whose elements can be empty
+  enum { MAX_EMPTY_ELEMENTS = 65536 };
+
+  void decodeInstructions( const FastInstructions& instructions,
+                           PresenceMap& pmap, Message* pMessage,
+                           FieldMap& map );
+  bool decodeValue( const FastInstruction& instruction, PresenceMap& pmap,
+                    FastValue& value );
+  void readValue( const FastInstruction& instruction, bool nullable,
+                  FastValue& value );
+  void setField( const FastInstruction& instruction, const FastValue& value,
+                 Message* pMessage, FieldMap& map );
+
+  const FastTemplates& m_templates;
+  std::vector < FastValue > m_dictionary;
+  int m_templateId;
+  GroupArena* m_pArena;
+  const unsigned char* m_pos;
+  const unsigned char* m_end;
+  // elements still allowed in sequences whose elements can be empty
+  int64_t m_emptyElements;
+  FastValue m_value;
+  std::string m_delta;
+};
+
+/**
+ * Encodes FIX messages as FAST.
+ *
+ * The encoder keeps the operator dictionary between messages, so its
+ * output must be decoded in order by one decoder.
+ */
+class FastEncoder
+{
+public:
+  FastEncoder( const FastTemplates& templates );
+
+  /// Append message encoded with the template for its MsgType
+  void encode( const Message& message, std::string& result )
+  EXCEPT ( FieldNotFound, IncorrectDataFormat );
+  /// Append message encoded with the template with templateId
+  void encode( int templateId, const Message& message, std::string& result )
+  EXCEPT ( FieldNotFound, IncorrectDataFormat );
+
+  /// Return the operator dictionary to its initial state
+  void reset();
+
+private:
+  /// Presence map and fields of a message or sequence element
+  struct Buffer
+  {
+    Buffer() : bits( 0 ) {}
+
+    std::string pmap;
+    int bits;
+    std::string body;
+  };
+
+  void encode( const FastTemplate& fastTemplate, const Message& message,
+               std::string& result );
+  void encodeInstructions( const FastInstructions& instructions,
+                           const Message* pMessage, const FieldMap& map,
+                           std::size_t depth );
+  bool getValue( const FastInstruction& instruction, const Message* pMessage,
+                 const FieldMap& map, FastValue& value ) const;
+  void encodeValue( const FastInstruction& instruction, bool present,
+                    const FastValue& value, Buffer& buffer );
+  void writeValue( const FastInstruction& instruction, bool nullable,
+                   bool present, const FastValue& value, std::string& body );
+  Buffer& getBuffer( std::size_t depth );
+  static void setBit( Buffer& buffer, bool set );
+  static void append( const Buffer& buffer, bool hasPresenceMap,
+                      std::string& result );
+
+  const FastTemplates& m_templates;
+  std::vector < FastValue > m_dictionary;
+  int m_templateId;
+  std::deque < Buffer > m_buffers;
+  FastValue m_value;
+  std::string m_delta;
+};
+}
+
+#endif //FIX_FASTCODEC_H
@@ -31,6 +31,8 @@
 #include "FieldNumbers.h"
 #include "FieldConvertors.h"
 #include "FieldTypes.h"
+#include "ByteScanner.h"
+#include "TagPrefix.h"
 #include "Utility.h"
 
 #if defined(__SUNPRO_CC)
@@ -44,7 +46,10 @@ namespace FIX
  *
  * This base class is the lowest common denominator of all fields.  It
  * keeps all fields in its most generic string representation with its
- * integer tag.
+ * integer tag.  It has no virtual functions so that fields can be stored
+ * by value compactly; the wire form ( tag=value[SOH] ) is derived on
+ * demand rather than cached.  Short values fit in the string's inline
+ * buffer.
  */
 class FieldBase
 {
@@ -55,7 +60,7 @@ class FieldBase
   public:
 
     field_metrics( const size_t length, const int checksum )
-      : m_length( length )
+      : m_length( (int)length )
       , m_checksum( checksum )
     {}
 
@@ -70,7 +75,7 @@ class FieldBase
 
   private:
 
-    size_t m_length;
+    int m_length;
     int m_checksum;
   };
 
@@ -78,26 +83,31 @@ class FieldBase
 
   /// Constructor which also calculates field metrics
   FieldBase( int tag, 
-             std::string::const_iterator valueStart, 
-             std::string::const_iterator valueEnd,
-             std::string::const_iterator tagStart, 
-             std::string::const_iterator tagEnd )
+             const char* valueStart, 
+             const char* valueEnd,
+             const char* tagStart, 
+             const char* tagEnd )
     : m_tag( tag )
-    , m_string( valueStart, valueEnd )
     , m_metrics( calculateMetrics( tagStart, tagEnd ) )
+    , m_string( valueStart, valueEnd )
   {}
 
 public:
   FieldBase( int tag, const std::string& string )
-    : m_tag( tag ), m_string(string), m_metrics( no_metrics() )
+    : m_tag( tag ), m_metrics( no_metrics() ), m_string(string)
   {}
 
-  virtual ~FieldBase() {}
+#ifdef HAVE_RVALUE_REFERENCES
+  FieldBase( int tag, std::string&& string )
+    : m_tag( tag ), m_metrics( no_metrics() )
+    , m_string( std::move( string ) )
+  {}
+#endif
 
   FieldBase( const FieldBase& rhs )
   : m_tag( rhs.getTag() )
-  , m_string( rhs.m_string )
   , m_metrics( rhs.m_metrics )
+  , m_string( rhs.m_string )
   {
 
   }
@@ -107,24 +117,40 @@ public:
     m_tag = rhs.getTag();
     m_string = rhs.m_string;
     m_metrics = rhs.m_metrics;
-    m_data.clear();
 
     return *this;
   }
 
+#ifdef HAVE_RVALUE_REFERENCES
+  FieldBase( FieldBase&& rhs ) NOEXCEPT
+  : m_tag( rhs.m_tag )
+  , m_metrics( rhs.m_metrics )
+  , m_string( std::move( rhs.m_string ) )
+  {
+
+  }
+
+  FieldBase& operator=( FieldBase&& rhs ) NOEXCEPT
+  {
+    m_tag = rhs.m_tag;
+    m_string = std::move( rhs.m_string );
+    m_metrics = rhs.m_metrics;
+
+    return *this;
+  }
+#endif
+
   void swap( FieldBase& rhs )
   {
     std::swap( m_tag, rhs.m_tag );
     std::swap( m_metrics, rhs.m_metrics );
     m_string.swap( rhs.m_string );
-    m_data.swap( rhs.m_data );
   }
 
   void setTag( int tag )
   {
     m_tag = tag;
     m_metrics = no_metrics();
-    m_data.clear();
   }
 
   /// @deprecated Use setTag
@@ -137,9 +163,16 @@ public:
   {
     m_string = string;
     m_metrics = no_metrics();
-    m_data.clear();
   }
 
+#ifdef HAVE_RVALUE_REFERENCES
+  void setString( std::string&& string )
+  {
+    m_string = std::move( string );
+    m_metrics = no_metrics();
+  }
+#endif
+
   /// Get the fields integer tag.
   int getTag() const
   { return m_tag; }
@@ -153,12 +186,26 @@ public:
   { return m_string; }
 
   /// Get the string representation of the Field (i.e.) 55=MSFT[SOH]
-  const std::string& getFixString() const
+  std::string getFixString() const
+  {
+    std::string result;
+    appendTo( result );
+    return result;
+  }
+
+  /// Append the string representation of the Field to a string
+  void appendTo( std::string& result ) const
   {
-    if( m_data.empty() )
-      encodeTo( m_data );
+    size_t prefixLength = TagPrefix::length( m_tag );
+    size_t start = result.length();
+
+    result.resize( start + prefixLength + m_string.length() + 1 );
 
-    return m_data;
+    char * buf = &result[ start ];
+    TagPrefix::write( buf, m_tag );
+
+    memcpy( buf + prefixLength, m_string.data(), m_string.length() );
+    buf[prefixLength + m_string.length()] = '\001';
   }
 
   /// Get the length of the fields string representation
@@ -185,23 +232,10 @@ private:
   {
     if( m_metrics.isValid() ) return;
 
-    m_metrics = calculateMetrics( getFixString() );
-  }
-
-  /// Serializes string representation of the Field to input string
-  void encodeTo( std::string& result ) const
-  {
-    size_t tagLength = FIX::number_of_symbols_in( m_tag );
-    size_t totalLength = tagLength + m_string.length() + 2;
-
-    result.resize( totalLength );
+    int checksum = TagPrefix::total( m_tag ) + '\001';
+    checksum += (int)FIX::ByteScanner::sum( m_string.data(), m_string.data() + m_string.length() );
 
-    char * buf = (char*)result.c_str();
-    FIX::integer_to_string( buf, tagLength, m_tag );
-
-    buf[tagLength] = '=';
-    memcpy( buf + tagLength + 1, m_string.data(), m_string.length() );
-    buf[totalLength - 1] = '\001';
+    m_metrics = field_metrics( TagPrefix::length( m_tag ) + m_string.length() + 1, checksum );
   }
 
   static field_metrics no_metrics()
@@ -210,32 +244,15 @@ private:
   }
 
   /// Calculate metrics for any input string
-  static field_metrics calculateMetrics( 
-    std::string::const_iterator const start,
-    std::string::const_iterator const end )
+  static field_metrics calculateMetrics( const char* const start,
+                                         const char* const end )
   {
-    int checksum = 0;
-    for ( std::string::const_iterator str = start; str != end; ++str )
-      checksum += (unsigned char)( *str );
-
-#if defined(__SUNPRO_CC)
-    std::ptrdiff_t d;
-    std::distance(start, end, d);
-    return field_metrics( d, checksum );
-#else
-    return field_metrics( std::distance( start, end ), checksum );
-#endif
-  }
-
-  static field_metrics calculateMetrics( const std::string& field )
-  {
-    return calculateMetrics( field.begin(), field.end() );
+    return field_metrics( end - start, (int)FIX::ByteScanner::sum( start, end ) );
   }
 
   int m_tag;
-  std::string m_string;
-  mutable std::string m_data;
   mutable field_metrics m_metrics;
+  std::string m_string;
 };
 /*! @} */
 
@@ -262,9 +279,17 @@ public:
 : FieldBase( field, data ) {}
   StringField( int field )
 : FieldBase( field, "" ) {}
+#ifdef HAVE_RVALUE_REFERENCES
+  StringField( int field, std::string&& data )
+: FieldBase( field, std::move( data ) ) {}
+#endif
 
   void setValue( const std::string& value )
     { setString( value ); }
+#ifdef HAVE_RVALUE_REFERENCES
+  void setValue( std::string&& value )
+    { setString( std::move( value ) ); }
+#endif
   const std::string& getValue() const
     { return getString(); }
   operator const std::string&() const
@@ -379,15 +404,26 @@ public:
     { return getValue(); }
 };
 
-/// Field that contains a double value
+/// Field that contains a double value, also readable as a fixed-point Decimal
 class DoubleField : public FieldBase
 {
 public:
   explicit DoubleField( int field, double data, int padding = 0 )
 : FieldBase( field, DoubleConvertor::convert( data, padding ) ) {}
+  explicit DoubleField( int field, const Decimal& data )
+: FieldBase( field, DecimalConvertor::convert( data ) ) {}
   DoubleField( int field )
 : FieldBase( field, "" ) {}
 
+  void setValue( const Decimal& value )
+    { setString( DecimalConvertor::convert( value ) ); }
+  /// Get the value exactly as written, without a double round trip
+  Decimal getDecimal() const EXCEPT ( IncorrectDataFormat )
+    { Decimal result;
+      if( !DecimalConvertor::convert( getString(), result ) )
+        throw IncorrectDataFormat( getTag(), getString() );
+      return result; }
+
   void setValue( double value, int padding = 0 )
     { setString( DoubleConvertor::convert( value, padding ) ); }
   double getValue() const EXCEPT ( IncorrectDataFormat )
@@ -574,6 +610,16 @@ NAME(const TYPE& value) : TOK##Field(NUM, value) {} \
 #define DEFINE_FIELD_CLASS( NAME, TOK, TYPE ) \
 DEFINE_FIELD_CLASS_NUM(NAME, TOK, TYPE, FIELD::NAME)
 
+#define DEFINE_FIELD_DECIMALCLASS_NUM( NAME, TOK, TYPE, NUM ) \
+class NAME : public TOK##Field { public: \
+NAME() : TOK##Field(NUM) {} \
+NAME(const TYPE& value) : TOK##Field(NUM, value) {} \
+NAME(const FIX::Decimal& value) : TOK##Field(NUM, value) {} \
+}
+
+#define DEFINE_FIELD_DECIMALCLASS( NAME, TOK, TYPE ) \
+DEFINE_FIELD_DECIMALCLASS_NUM(NAME, TOK, TYPE, FIELD::NAME)
+
 #define DEFINE_DEPRECATED_FIELD_CLASS( NAME, TOK, TYPE ) \
 DEFINE_FIELD_CLASS_NUM(NAME, TOK, TYPE, DEPRECATED_FIELD::NAME)
 
@@ -598,13 +644,13 @@ DEFINE_FIELD_TIMECLASS_NUM(NAME, TOK, TYPE, DEPRECATED_FIELD::NAME)
 #define DEFINE_CHAR( NAME ) \
   DEFINE_FIELD_CLASS(NAME, Char, FIX::CHAR)
 #define DEFINE_PRICE( NAME ) \
-  DEFINE_FIELD_CLASS(NAME, Price, FIX::PRICE)
+  DEFINE_FIELD_DECIMALCLASS(NAME, Price, FIX::PRICE)
 #define DEFINE_INT( NAME ) \
   DEFINE_FIELD_CLASS(NAME, Int, FIX::INT)
 #define DEFINE_AMT( NAME ) \
-  DEFINE_FIELD_CLASS(NAME, Amt, FIX::AMT)
+  DEFINE_FIELD_DECIMALCLASS(NAME, Amt, FIX::AMT)
 #define DEFINE_QTY( NAME ) \
-  DEFINE_FIELD_CLASS(NAME, Qty, FIX::QTY)
+  DEFINE_FIELD_DECIMALCLASS(NAME, Qty, FIX::QTY)
 #define DEFINE_CURRENCY( NAME ) \
   DEFINE_FIELD_CLASS(NAME, Currency, FIX::CURRENCY)
 #define DEFINE_MULTIPLEVALUESTRING( NAME ) \
@@ -661,13 +707,13 @@ DEFINE_FIELD_TIMECLASS_NUM(NAME, TOK, TYPE, DEPRECATED_FIELD::NAME)
 #define USER_DEFINE_CHAR( NAME, NUM ) \
   DEFINE_FIELD_CLASS_NUM(NAME, Char, FIX::CHAR, NUM)
 #define USER_DEFINE_PRICE( NAME, NUM ) \
-  DEFINE_FIELD_CLASS_NUM(NAME, Price, FIX::PRICE, NUM)
+  DEFINE_FIELD_DECIMALCLASS_NUM(NAME, Price, FIX::PRICE, NUM)
 #define USER_DEFINE_INT( NAME, NUM ) \
   DEFINE_FIELD_CLASS_NUM(NAME, Int, FIX::INT, NUM)
 #define USER_DEFINE_AMT( NAME, NUM ) \
-  DEFINE_FIELD_CLASS_NUM(NAME, Amt, FIX::AMT, NUM)
+  DEFINE_FIELD_DECIMALCLASS_NUM(NAME, Amt, FIX::AMT, NUM)
 #define USER_DEFINE_QTY( NAME, NUM ) \
-  DEFINE_FIELD_CLASS_NUM(NAME, Qty, FIX::QTY, NUM)
+  DEFINE_FIELD_DECIMALCLASS_NUM(NAME, Qty, FIX::QTY, NUM)
 #define USER_DEFINE_CURRENCY( NAME, NUM ) \
   DEFINE_FIELD_CLASS_NUM(NAME, Currency, FIX::CURRENCY, NUM)
 #define USER_DEFINE_MULTIPLEVALUESTRING( NAME, NUM ) \
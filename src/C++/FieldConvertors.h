@@ -27,6 +27,7 @@
 #endif
 
 #include "FieldTypes.h"
+#include "Decimal.h"
 #include "Exceptions.h"
 #include "Utility.h"
 #include "config-all.h"
@@ -34,6 +35,7 @@
 #include <sstream>
 #include <iomanip>
 #include <cstdio>
+#include <cstring>
 #include <limits>
 #include <iterator>
 
@@ -160,10 +162,8 @@ struct IntConvertor
     return std::string( start, buffer + sizeof (buffer) - start );
   }
 
-  static bool convert(     
-    std::string::const_iterator str, 
-    std::string::const_iterator end, 
-    signed_int& result )
+  template< typename Iterator >
+  static bool convert( Iterator str, Iterator end, signed_int& result )
   {
     bool isNegative = false;
     signed_int x = 0;
@@ -358,6 +358,29 @@ static bool convert( const std::string& value, double& result )
   }
 };
 
+/// Converts fixed-point decimal to/from a string
+struct DecimalConvertor
+{
+  static std::string convert( const Decimal& value )
+  {
+    return value.toString();
+  }
+
+  static bool convert( const std::string& value, Decimal& result )
+  {
+    return Decimal::parse( value.data(), value.data() + value.size(), result );
+  }
+
+  static Decimal convert( const std::string& value )
+  EXCEPT ( FieldConvertError )
+  {
+    Decimal result;
+    if( !convert( value, result ) )
+      throw FieldConvertError(value);
+    return result;
+  }
+};
+
 /// Converts character to/from a string
 struct CharConvertor
 {
@@ -421,111 +444,156 @@ struct BoolConvertor
 /// Converts a UtcTimeStamp to/from a string
 struct UtcTimeStampConvertor
 {
-  static std::string convert( const UtcTimeStamp& value,
-                              int precision = 0 )
-  EXCEPT ( FieldConvertError )
+  /// Longest formatted timestamp, with nanoseconds
+  static const int MAX_LENGTH = 17 + 1 + 9;
+
+  /**
+   * Write "YYYYMMDD-HH:MM:SS[.fraction]" to buffer, which must hold
+   * MAX_LENGTH characters, and return the length written.
+   */
+  static std::size_t format( char* buffer, const DateTime& value, int precision = 0 )
   {
-    char result[ 17+10 ]; // Maximum
     int year, month, day, hour, minute, second, fraction;
 
     value.getYMD( year, month, day );
-    value.getHMS( hour, minute, second, fraction, precision );
-
-    integer_to_string_padded( result, 4, year);
-    integer_to_string_padded( result + 4, 2, month );
-    integer_to_string_padded( result + 6, 2, day );
-    result[8]  = '-';
-    integer_to_string_padded( result + 9, 2, hour);
-    result[11] = ':';
-    integer_to_string_padded( result + 12, 2, minute);
-    result[14] = ':';
-    integer_to_string_padded( result + 15, 2, second);
-
-    if( precision )
-    {
-      result[17] = '.';
-      integer_to_string_padded ( result + 18, precision, fraction );
-    }
+    value.getHMS( hour, minute, second, fraction, 0 );
+
+    integer_to_string_padded( buffer, 4, year);
+    integer_to_string_padded( buffer + 4, 2, month );
+    integer_to_string_padded( buffer + 6, 2, day );
+    buffer[8]  = '-';
+    integer_to_string_padded( buffer + 9, 2, hour);
+    buffer[11] = ':';
+    integer_to_string_padded( buffer + 12, 2, minute);
+    buffer[14] = ':';
+    integer_to_string_padded( buffer + 15, 2, second);
+
+    return 17 + formatFraction( buffer + 17, value, precision );
+  }
 
-    return std::string(result, precision ? (17 + 1 + precision) : 17);
+  /// Write ".fraction" for precision digits, or nothing when precision is 0
+  static std::size_t formatFraction( char* buffer, const DateTime& value, int precision )
+  {
+    if( precision <= 0 )
+      return 0;
+    if( precision > 9 )
+      precision = 9;
+    buffer[0] = '.';
+    integer_to_string_padded( buffer + 1, precision, value.getFraction( precision ) );
+    return 1 + precision;
   }
 
-  static UtcTimeStamp convert( const std::string& value )
+  static std::string convert( const UtcTimeStamp& value,
+                              int precision = 0 )
   EXCEPT ( FieldConvertError )
   {
-    size_t len = value.size();
-    if (len < 17 || len > 27) throw FieldConvertError(value);
-
-    size_t i = 0;
-    int c = 0;
-    for( c = 0; c < 8; ++c )
-      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError(value);
-    if (value[i++] != '-') throw FieldConvertError(value);
-    for( c = 0; c < 2; ++c )
-      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError(value);
-    if( value[i++] != ':' ) throw FieldConvertError(value);
-    for( c = 0; c < 2; ++c )
-      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError(value);
-    if( value[i++] != ':' ) throw FieldConvertError(value);
-    for( c = 0; c < 2; ++c )
-      if( !IS_DIGIT(value[i++]) ) throw FieldConvertError(value);
-
-    int year, mon, mday, hour, min, sec;
-
-    i = 0;
-
-    year = value[i++] - '0';
-    year = 10 * year + value[i++] - '0';
-    year = 10 * year + value[i++] - '0';
-    year = 10 * year + value[i++] - '0';
+    char result[ MAX_LENGTH ];
+    return std::string( result, format( result, value, precision ) );
+  }
 
-    mon = value[i++] - '0';
-    mon = 10 * mon + value[i++] - '0';
-    if( mon < 1 || 12 < mon ) throw FieldConvertError(value);
+  /**
+   * Parse the fixed "YYYYMMDD-HH:MM:SS[.fraction]" layout.  Every
+   * position is checked at once instead of bailing out at the first
+   * bad character, since almost all input is well formed.
+   */
+  static bool parse( const char* value, std::size_t len, UtcTimeStamp& result )
+  {
+    if( len < 17 || len > 27 )
+      return false;
 
-    mday = value[i++] - '0';
-    mday = 10 * mday + value[i++] - '0';
-    if( mday < 1 || 31 < mday ) throw FieldConvertError(value);
+    unsigned int d[ 17 ];
+    for( int i = 0; i < 17; ++i )
+      d[i] = (unsigned char)( value[i] - '0' );
 
-    ++i; // skip '-'
+    // a digit plus 6 stays below 16, anything else does not
+    unsigned int invalid = ( ( d[0] + 6 ) | ( d[1] + 6 ) | ( d[2] + 6 ) | ( d[3] + 6 )
+              | ( d[4] + 6 ) | ( d[5] + 6 ) | ( d[6] + 6 ) | ( d[7] + 6 )
+              | ( d[9] + 6 ) | ( d[10] + 6 ) | ( d[12] + 6 ) | ( d[13] + 6 )
+              | ( d[15] + 6 ) | ( d[16] + 6 ) ) & ~0xFu;
+    if( invalid | ( value[8] != '-' ) | ( value[11] != ':' ) | ( value[14] != ':' ) )
+      return false;
 
-    hour = value[i++] - '0';
-    hour = 10 * hour + value[i++] - '0';
-    // No check for >= 0 as no '-' are converted here
-    if( 23 < hour ) throw FieldConvertError(value);
+    int year = d[0] * 1000 + d[1] * 100 + d[2] * 10 + d[3];
+    int mon = d[4] * 10 + d[5];
+    int mday = d[6] * 10 + d[7];
+    int hour = d[9] * 10 + d[10];
+    int min = d[12] * 10 + d[13];
+    int sec = d[15] * 10 + d[16];
 
-    ++i; // skip ':'
+    if( ( mon < 1 ) | ( 12 < mon ) | ( mday < 1 ) | ( 31 < mday )
+        | ( 23 < hour ) | ( 59 < min ) | ( 60 < sec ) )
+      return false;
 
-    min = value[i++] - '0';
-    min = 10 * min + value[i++] - '0';
-    // No check for >= 0 as no '-' are converted here
-    if( 59 < min ) throw FieldConvertError(value);
+    if( len == 17 )
+    {
+      result = UtcTimeStamp( hour, min, sec, 0, mday, mon, year );
+      return true;
+    }
 
-    ++i; // skip ':'
+    if( value[17] != '.' )
+      return false;
 
-    sec = value[i++] - '0';
-    sec = 10 * sec + value[i++] - '0';
+    int fraction = 0;
+    for( std::size_t i = 18; i < len; ++i )
+    {
+      unsigned int digit = (unsigned char)( value[i] - '0' );
+      if( digit > 9 )
+        return false;
+      fraction = fraction * 10 + digit;
+    }
 
-    // No check for >= 0 as no '-' are converted here
-    if( 60 < sec ) throw FieldConvertError(value);
+    result = UtcTimeStamp( hour, min, sec, fraction,
+                           mday, mon, year, (int)len - 17 - 1 );
+    return true;
+  }
 
-    if (len == 17)
-      return UtcTimeStamp (hour, min, sec, 0,
-                           mday, mon, year);
+  static UtcTimeStamp convert( const std::string& value )
+  EXCEPT ( FieldConvertError )
+  {
+    UtcTimeStamp result( 0, 0, 0, 1, 1, 1970 );
+    if( !parse( value.data(), value.size(), result ) )
+      throw FieldConvertError(value);
+    return result;
+  }
+};
 
-    if( value[i++] != '.' ) throw FieldConvertError(value);
+/**
+ * Formats UtcTimeStamps for a single user such as a session or a log.
+ *
+ * The "YYYYMMDD-HH:MM:SS" part is only rendered again when the second
+ * changes; otherwise it is copied and just the fraction is written.
+ * Not thread safe, each user keeps its own.
+ */
+class UtcTimeStampCache
+{
+public:
+  UtcTimeStampCache() : m_date( -1 ), m_second( -1 ) {}
 
-    int fraction = 0;
-    for (; i < len; ++i)
+  /// Same as UtcTimeStampConvertor::format
+  std::size_t format( char* buffer, const DateTime& value, int precision = 0 )
+  {
+    int64_t second = value.m_time / DateTime::NANOS_PER_SEC;
+    if( value.m_date != m_date || second != m_second )
     {
-      char ch = value[i];
-      if( !IS_DIGIT(ch)) throw FieldConvertError(value);
-      fraction = (fraction * 10) + ch - '0';
+      DateTime whole( value.m_date, second * DateTime::NANOS_PER_SEC );
+      UtcTimeStampConvertor::format( m_prefix, whole );
+      m_date = value.m_date;
+      m_second = second;
     }
+    memcpy( buffer, m_prefix, 17 );
+    return 17 + UtcTimeStampConvertor::formatFraction( buffer + 17, value, precision );
+  }
 
-    return UtcTimeStamp (hour, min, sec, fraction,
-                         mday, mon, year, len - 17 - 1);
+  std::string convert( const DateTime& value, int precision = 0 )
+  {
+    char result[ UtcTimeStampConvertor::MAX_LENGTH ];
+    return std::string( result, format( result, value, precision ) );
   }
+
+private:
+  int m_date;
+  int64_t m_second;
+  char m_prefix[ 17 ];
 };
 
 /// Converts a UtcTimeOnly to/from a string
@@ -32,26 +32,33 @@ namespace FIX
 {
 
 FieldMap::FieldMap( const message_order& order, int size )
-: m_order(order)
+: m_order(order), m_pooled(false), m_pDecoder(0)
 {
   m_fields.reserve(size);
 }
 
 FieldMap::FieldMap( const message_order& order /*= message_order(message_order::normal)*/)
-: m_order(order)
+: m_order(order), m_pooled(false), m_pDecoder(0)
 {
   m_fields.reserve(DEFAULT_SIZE);
 }
 
 FieldMap::FieldMap( const int order[] )
-: m_order(message_order(order))
+: m_order(message_order(order)), m_pooled(false), m_pDecoder(0)
 {
   m_fields.reserve(DEFAULT_SIZE);
 }
 
 FieldMap::FieldMap( const FieldMap& copy )
+: m_pooled(false), m_pDecoder(0)
 {
-  *this = copy;
+  assign( copy, false );
+}
+
+FieldMap::FieldMap( const FieldMap& copy, bool copyDeferred )
+: m_pooled(false), m_pDecoder(0)
+{
+  assign( copy, copyDeferred );
 }
 
 FieldMap::~FieldMap()
@@ -60,10 +67,19 @@ FieldMap::~FieldMap()
 }
 
 FieldMap& FieldMap::operator=( const FieldMap& rhs )
+{
+  if ( this == &rhs ) return *this;
+
+  assign( rhs, false );
+  return *this;
+}
+
+void FieldMap::assign( const FieldMap& rhs, bool copyDeferred )
 {
   clear();
 
   m_fields = rhs.m_fields;
+  m_index = rhs.m_index;
   m_order = rhs.m_order;
 
   Groups::const_iterator i;
@@ -77,9 +93,76 @@ FieldMap& FieldMap::operator=( const FieldMap& rhs )
     }
   }
 
+  if ( copyDeferred )
+  {
+    m_deferred = rhs.m_deferred;
+    m_pDecoder = rhs.m_pDecoder;
+    return;
+  }
+
+  // copies never refer to the source of deferred groups, which is only
+  // read to build them here
+  DeferredGroups::const_iterator d;
+  for ( d = rhs.m_deferred.begin(); d != rhs.m_deferred.end(); ++d )
+    rhs.m_pDecoder->decodeGroup( *this, d->tag, d->begin, d->context );
+}
+
+#ifdef HAVE_RVALUE_REFERENCES
+FieldMap::FieldMap( FieldMap&& rhs )
+: m_order( rhs.m_order ), m_pooled( false ), m_pDecoder( 0 )
+{
+  take( rhs, false );
+}
+
+FieldMap::FieldMap( FieldMap&& rhs, bool movePooled )
+: m_order( rhs.m_order ), m_pooled( false ), m_pDecoder( 0 )
+{
+  take( rhs, movePooled );
+}
+
+FieldMap& FieldMap::operator=( FieldMap&& rhs )
+{
+  if ( this == &rhs ) return *this;
+
+  clear();
+  take( rhs, false );
   return *this;
 }
 
+void FieldMap::take( FieldMap& rhs, bool movePooled )
+{
+  if ( movePooled )
+  {
+    m_deferred.swap( rhs.m_deferred );
+    m_pDecoder = rhs.m_pDecoder;
+    rhs.m_pDecoder = 0;
+  }
+  else
+  {
+    // the source of deferred groups stays with rhs
+    rhs.decodeGroups();
+  }
+
+  // this map is empty, so rhs is left empty with whatever storage it had
+  m_order = rhs.m_order;
+  m_fields.swap( rhs.m_fields );
+  m_index.swap( rhs.m_index );
+  m_groups.swap( rhs.m_groups );
+  if ( movePooled ) return;
+
+  Groups::iterator i;
+  for ( i = m_groups.begin(); i != m_groups.end(); ++i )
+  {
+    std::vector < FieldMap* > ::iterator j;
+    for ( j = i->second.begin(); j != i->second.end(); ++j )
+    {
+      if ( (*j)->m_pooled )
+        *j = new FieldMap( std::move( **j ) );
+    }
+  }
+}
+#endif
+
 void FieldMap::addGroup( int field, const FieldMap& group, bool setCount )
 {
   FieldMap * pGroup = new FieldMap( group );
@@ -87,11 +170,21 @@ void FieldMap::addGroup( int field, const FieldMap& group, bool setCount )
   addGroupPtr( field, pGroup, setCount );
 }
 
+#ifdef HAVE_RVALUE_REFERENCES
+void FieldMap::addGroup( int field, FieldMap&& group, bool setCount )
+{
+  FieldMap * pGroup = new FieldMap( std::move( group ) );
+
+  addGroupPtr( field, pGroup, setCount );
+}
+#endif
+
 void FieldMap::addGroupPtr( int field, FieldMap * group, bool setCount )
 {
     if( group == 0 )
         return;
 
+    decodeGroups();
     std::vector< FieldMap* >& vec = m_groups[ field ];
     vec.push_back( group );
 
@@ -101,6 +194,7 @@ void FieldMap::addGroupPtr( int field, FieldMap * group, bool setCount )
 
 void FieldMap::replaceGroup( int num, int field, const FieldMap& group )
 {
+  decodeGroups();
   Groups::const_iterator i = m_groups.find( field );
   if ( i == m_groups.end() ) return;
   if ( num <= 0 ) return;
@@ -110,6 +204,7 @@ void FieldMap::replaceGroup( int num, int field, const FieldMap& group )
 
 void FieldMap::removeGroup( int num, int field )
 {
+  decodeGroups();
   Groups::iterator i = m_groups.find( field );
   if ( i == m_groups.end() ) return;
   if ( num <= 0 ) return;
@@ -119,7 +214,8 @@ void FieldMap::removeGroup( int num, int field )
   std::vector< FieldMap* >::iterator iter = vector.begin();
   std::advance( iter, ( num - 1 ) );
 
-  delete (*iter);
+  if ( !(*iter)->m_pooled )
+    delete (*iter);
   vector.erase( iter );
 
   if( vector.size() == 0 )
@@ -136,6 +232,7 @@ void FieldMap::removeGroup( int num, int field )
 
 void FieldMap::removeGroup( int field )
 {
+  decodeGroups();
   Groups::iterator i = m_groups.find( field );
   if ( i == m_groups.end() ) return;
 
@@ -148,7 +245,8 @@ void FieldMap::removeGroup( int field )
 
   while ( !tmp.empty() )
   {
-    delete tmp.back();
+    if ( !tmp.back()->m_pooled )
+      delete tmp.back();
     tmp.pop_back();
   }
 }
@@ -156,8 +254,17 @@ void FieldMap::removeGroup( int field )
 void FieldMap::removeField( int field )
 {
   Fields::iterator i = findTag( field );
-  if ( i != m_fields.end() )
-    m_fields.erase( i );
+  if ( i == m_fields.end() )
+    return;
+
+  std::size_t position = i - m_fields.begin();
+  m_fields.erase( i );
+  if ( !m_index.empty() )
+  {
+    if ( field >= 0 && field < DIRECT_INDEX_SIZE )
+      m_index[ field ] = 0;
+    reindexFrom( position );
+  }
 }
 
 bool FieldMap::hasGroup( int num, int field ) const
@@ -167,32 +274,110 @@ bool FieldMap::hasGroup( int num, int field ) const
 
 bool FieldMap::hasGroup( int field ) const
 {
+  if ( findDeferred( field ) ) return true;
   Groups::const_iterator i = m_groups.find( field );
   return i != m_groups.end();
 }
 
 size_t FieldMap::groupCount( int field ) const
 {
+  const DeferredGroup* pDeferred = findDeferred( field );
+  if( pDeferred )
+    return pDeferred->count;
   Groups::const_iterator i = m_groups.find( field );
   if( i == m_groups.end() )
     return 0;
   return i->second.size();
 }
 
+void FieldMap::deferGroup( int tag, std::size_t count,
+                           std::string::size_type begin,
+                           std::string::size_type end,
+                           const GroupDecoder* pDecoder, int context )
+{
+  DeferredGroup deferred = { tag, count, begin, end, context };
+  m_deferred.push_back( deferred );
+  m_pDecoder = pDecoder;
+}
+
+const FieldMap::DeferredGroup* FieldMap::findDeferred( int tag ) const
+{
+  DeferredGroups::const_iterator i;
+  for ( i = m_deferred.begin(); i != m_deferred.end(); ++i )
+    if ( i->tag == tag ) return &*i;
+  return 0;
+}
+
+void FieldMap::decodeDeferredGroups() const
+{
+  // taken out first so the maps being built do not decode again,
+  // and handed back empty so the vector keeps its capacity
+  DeferredGroups deferred;
+  deferred.swap( m_deferred );
+
+  FieldMap& self = const_cast < FieldMap& > ( *this );
+  DeferredGroups::const_iterator i;
+  for ( i = deferred.begin(); i != deferred.end(); ++i )
+    m_pDecoder->decodeGroup( self, i->tag, i->begin, i->context );
+
+  deferred.clear();
+  m_deferred.swap( deferred );
+  self.m_pDecoder = 0;
+}
+
 void FieldMap::clear()
 {
   m_fields.clear();
+  m_index.clear();
+  m_deferred.clear();
+  m_pDecoder = 0;
 
   Groups::iterator i;
   for ( i = m_groups.begin(); i != m_groups.end(); ++i )
   {
     std::vector < FieldMap* > ::iterator j;
     for ( j = i->second.begin(); j != i->second.end(); ++j )
-      delete *j;
+    {
+      if ( !(*j)->m_pooled )
+        delete *j;
+    }
   }
   m_groups.clear();
 }
 
+void FieldMap::buildIndex()
+{
+  int largest = 0;
+  Fields::const_iterator i;
+  for ( i = m_fields.begin(); i != m_fields.end(); ++i )
+  {
+    int tag = i->getTag();
+    if ( tag > largest && tag < DIRECT_INDEX_SIZE )
+      largest = tag;
+  }
+
+  m_index.assign( largest + 1, 0 );
+  for ( i = m_fields.begin(); i != m_fields.end(); ++i )
+    indexField( i->getTag(), i - m_fields.begin() );
+}
+
+void FieldMap::reindexFrom( std::size_t position )
+{
+  // fields at or after position have moved, so drop their
+  // entries before indexing them again at their new positions
+  std::size_t i;
+  for ( i = position; i < m_fields.size(); ++i )
+  {
+    int tag = m_fields[ i ].getTag();
+    if ( tag >= 0 && (std::size_t)tag < m_index.size()
+         && m_index[ tag ] > (int)position )
+      m_index[ tag ] = 0;
+  }
+
+  for ( i = position; i < m_fields.size(); ++i )
+    indexField( m_fields[ i ].getTag(), i );
+}
+
 bool FieldMap::isEmpty()
 {
   return m_fields.empty();
@@ -200,6 +385,7 @@ bool FieldMap::isEmpty()
 
 size_t FieldMap::totalFields() const
 {
+  decodeGroups();
   size_t result = m_fields.size();
     
   Groups::const_iterator i;
@@ -217,9 +403,16 @@ std::string& FieldMap::calculateString( std::string& result ) const
   Fields::const_iterator i;
   for ( i = m_fields.begin(); i != m_fields.end(); ++i )
   {
-    result += i->getFixString();
+    i->appendTo( result );
 
     // add groups if they exist
+    const DeferredGroup* pDeferred = findDeferred( i->getTag() );
+    if( pDeferred )
+    {
+      result.append( m_pDecoder->groupSource(), pDeferred->begin,
+                     pDeferred->end - pDeferred->begin );
+      continue;
+    }
     if( !m_groups.size() ) continue;
     Groups::const_iterator j = m_groups.find( i->getTag() );
     if ( j == m_groups.end() ) continue;
@@ -230,6 +423,50 @@ std::string& FieldMap::calculateString( std::string& result ) const
   return result;
 }
 
+int FieldMap::serializeTo( std::string& result,
+                           int checkSumField,
+                           std::string::size_type* pLengthPosition,
+                           int bodyLengthField,
+                           int lengthWidth ) const
+{
+  int total = 0;
+  Fields::const_iterator i;
+  for ( i = m_fields.begin(); i != m_fields.end(); ++i )
+  {
+    int tag = i->getTag();
+    if ( tag == checkSumField )
+      continue;
+
+    std::string::size_type start = result.size();
+    if ( pLengthPosition && tag == bodyLengthField )
+    {
+      FieldBase( tag, std::string( lengthWidth, '0' ) ).appendTo( result );
+      *pLengthPosition = result.size() - lengthWidth - 1;
+    }
+    else
+    {
+      i->appendTo( result );
+    }
+
+    // deferred groups are copied as received
+    const DeferredGroup* pDeferred = findDeferred( tag );
+    if( pDeferred )
+      result.append( m_pDecoder->groupSource(), pDeferred->begin,
+                     pDeferred->end - pDeferred->begin );
+
+    total += (int)ByteScanner::sum( result.data() + start, result.data() + result.size() );
+
+    // add groups if they exist
+    if( !m_groups.size() ) continue;
+    Groups::const_iterator j = m_groups.find( tag );
+    if ( j == m_groups.end() ) continue;
+    std::vector < FieldMap* > ::const_iterator k;
+    for ( k = j->second.begin(); k != j->second.end(); ++k )
+      total += ( *k ) ->serializeTo( result, checkSumField );
+  }
+  return total;
+}
+
 int FieldMap::calculateLength( int beginStringField,
                                int bodyLengthField,
                                int checkSumField ) const
@@ -245,6 +482,10 @@ int FieldMap::calculateLength( int beginStringField,
     { result += i->getLength(); }
   }
 
+  DeferredGroups::const_iterator d;
+  for ( d = m_deferred.begin(); d != m_deferred.end(); ++d )
+    result += (int)( d->end - d->begin );
+
   Groups::const_iterator j;
   for ( j = m_groups.begin(); j != m_groups.end(); ++j )
   {
@@ -265,6 +506,13 @@ int FieldMap::calculateTotal( int checkSumField ) const
       result += i->getTotal();
   }
 
+  DeferredGroups::const_iterator d;
+  for ( d = m_deferred.begin(); d != m_deferred.end(); ++d )
+  {
+    const char* source = m_pDecoder->groupSource().data();
+    result += (int)ByteScanner::sum( source + d->begin, source + d->end );
+  }
+
   Groups::const_iterator j;
   for ( j = m_groups.begin(); j != m_groups.end(); ++j )
   {
@@ -275,4 +523,38 @@ int FieldMap::calculateTotal( int checkSumField ) const
   return result;
 }
 
+
+FieldMap* GroupArena::allocate( const message_order& order )
+{
+  if ( m_used == m_blocks.size() * BLOCK_SIZE )
+  {
+    FieldMap* block = new FieldMap[ BLOCK_SIZE ];
+    for ( int i = 0; i < BLOCK_SIZE; ++i )
+      block[ i ].m_pooled = true;
+    m_blocks.push_back( block );
+  }
+
+  FieldMap& group = m_blocks[ m_used / BLOCK_SIZE ][ m_used % BLOCK_SIZE ];
+  ++m_used;
+  group.m_order = order;
+  return &group;
+}
+
+void GroupArena::reset()
+{
+  for ( std::size_t i = 0; i < m_used; ++i )
+    m_blocks[ i / BLOCK_SIZE ][ i % BLOCK_SIZE ].clear();
+  m_used = 0;
+}
+
+GroupArena::~GroupArena()
+{
+  // empty every group before destroying any, groups in the
+  // arena can point at each other
+  reset();
+
+  std::vector < FieldMap* > ::iterator i;
+  for ( i = m_blocks.begin(); i != m_blocks.end(); ++i )
+    delete [] *i;
+}
 }
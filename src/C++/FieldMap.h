@@ -37,6 +37,30 @@
 
 namespace FIX
 {
+class FieldMap;
+
+/**
+ * Builds repeating groups whose decoding was deferred.
+ *
+ * A map can record the byte range of a group instead of building its
+ * instances.  The decoder keeps the string the range refers to and is
+ * asked to build the instances when the groups of the map are accessed,
+ * or into a copy of the map when it is copied.
+ */
+class GroupDecoder
+{
+public:
+  virtual ~GroupDecoder() {}
+
+  /// The string deferred group ranges refer to
+  virtual const std::string& groupSource() const = 0;
+  /// Decode the instances of the group following the count field at pos,
+  /// context being the value given when the group was deferred
+  virtual void decodeGroup( FieldMap& map, int tag,
+                            std::string::size_type pos,
+                            int context ) const = 0;
+};
+
 /**
  * Stores and organizes a collection of Fields.
  *
@@ -85,17 +109,50 @@ class FieldMap
   };
 
   enum { DEFAULT_SIZE = 16 };
+  // tags below this value are looked up through a direct index
+  // once a map holds INDEX_THRESHOLD fields or more
+  enum { DIRECT_INDEX_SIZE = 1024, INDEX_THRESHOLD = 16 };
 
 protected:
 
   FieldMap( const message_order& order, int size );
 
+#ifdef HAVE_RVALUE_REFERENCES
+  /**
+   * Take the fields and groups of rhs.  Unless movePooled is set, groups
+   * owned by a GroupArena are moved into groups of their own.  Owners
+   * that move the arena along set it to take them as they are, together
+   * with any deferred groups.
+   */
+  FieldMap( FieldMap&& rhs, bool movePooled );
+#endif
+
+  /**
+   * Copy the fields and groups of rhs.  Unless copyDeferred is set, the
+   * groups rhs has deferred are decoded into this map, leaving rhs as it
+   * is.  Owners that copy the source of the groups along set it to keep
+   * them deferred.
+   */
+  FieldMap( const FieldMap& rhs, bool copyDeferred );
+
 public:
 
   typedef std::vector < FieldBase, ALLOCATOR< FieldBase > > Fields;
+  typedef std::vector < int, ALLOCATOR< int > > Index;
   typedef std::map < int, std::vector < FieldMap* >, std::less<int>,
                      ALLOCATOR<std::pair<const int, std::vector< FieldMap* > > > > Groups;
 
+  /// Position and instance count of a group that has not been decoded
+  struct DeferredGroup
+  {
+    int tag;
+    std::size_t count;
+    std::string::size_type begin;
+    std::string::size_type end;
+    int context;
+  };
+  typedef std::vector < DeferredGroup > DeferredGroups;
+
   typedef Fields::iterator iterator;
   typedef Fields::const_iterator const_iterator;
   typedef Groups::iterator g_iterator;
@@ -112,6 +169,11 @@ public:
 
   FieldMap& operator=( const FieldMap& rhs );
 
+#ifdef HAVE_RVALUE_REFERENCES
+  FieldMap( FieldMap&& rhs );
+  FieldMap& operator=( FieldMap&& rhs );
+#endif
+
   /// Set a field without type checking
   void setField( const FieldBase& field, bool overwrite = true )
   EXCEPT ( RepeatedTag )
@@ -142,6 +204,31 @@ public:
     setField( fieldBase );
   }
 
+#ifdef HAVE_RVALUE_REFERENCES
+  /// Set a field without type checking, taking its value
+  void setField( FieldBase&& field, bool overwrite = true )
+  EXCEPT ( RepeatedTag )
+  {
+    if( overwrite )
+    {
+      Fields::iterator i = findTag( field.getTag() );
+      if( i != m_fields.end() )
+      {
+        *i = std::move( field );
+        return;
+      }
+    }
+    addField( std::move( field ) );
+  }
+
+  /// Set a field without a field class, taking its value
+  void setField( int tag, std::string&& value )
+  EXCEPT ( RepeatedTag, NoTagValue )
+  {
+    setField( FieldBase( tag, std::move( value ) ) );
+  }
+#endif
+
   /// Get a field if set
   bool getFieldIfSet( FieldBase& field ) const
   {
@@ -196,6 +283,10 @@ public:
 
   /// Add a group.
   void addGroup( int tag, const FieldMap& group, bool setCount = true );
+#ifdef HAVE_RVALUE_REFERENCES
+  /// Add a group, taking its fields and groups
+  void addGroup( int tag, FieldMap&& group, bool setCount = true );
+#endif
 
   /// Acquire ownership of Group object
   void addGroupPtr( int tag, FieldMap * group, bool setCount = true );
@@ -214,6 +305,7 @@ public:
   FieldMap& getGroupRef( int num, int tag ) const
   EXCEPT ( FieldNotFound )
   {
+    decodeGroups();
     Groups::const_iterator i = m_groups.find( tag );
     if( i == m_groups.end() ) throw FieldNotFound( tag );
     if( num <= 0 ) throw FieldNotFound( tag );
@@ -240,15 +332,52 @@ public:
   /// Count the number of instance of a group
   size_t groupCount( int tag ) const;
 
-  /// Clear all fields from the map
+  /**
+   * Record a group that was scanned but not decoded.
+   *
+   * The instances are built by pDecoder, which is handed context back,
+   * the first time the groups of this map are accessed.  Until then
+   * groupCount() and hasGroup() answer from the recorded count, and
+   * serialization copies the recorded range.  Groups are built even when
+   * they are reached through a const map, so a map with deferred groups
+   * must not be read from several threads at once.
+   */
+  void deferGroup( int tag, std::size_t count,
+                   std::string::size_type begin, std::string::size_type end,
+                   const GroupDecoder* pDecoder, int context );
+  /// Check if any groups are still waiting to be decoded
+  bool hasDeferredGroups() const { return !m_deferred.empty(); }
+
+  /**
+   * Clear all fields from the map.
+   *
+   * Field storage keeps its capacity.  Groups that were decoded into a
+   * GroupArena are left for the arena to release.
+   */
   void clear();
   /// Check if map contains any fields
   bool isEmpty();
 
   size_t totalFields() const;
 
+  /// The order fields are sorted and written in
+  const message_order& getOrder() const { return m_order; }
+
   std::string& calculateString( std::string& ) const;
 
+  /**
+   * Append the fields and groups to a string in a single pass and return
+   * the sum of the characters written.  The field with checkSumField is
+   * skipped.  If pLengthPosition is given, the bodyLengthField is written
+   * as a zero placeholder of the given width and its position is stored
+   * so the caller can patch it once the length is known.
+   */
+  int serializeTo( std::string& result,
+                   int checkSumField = FIELD::CheckSum,
+                   std::string::size_type* pLengthPosition = 0,
+                   int bodyLengthField = FIELD::BodyLength,
+                   int lengthWidth = 0 ) const;
+
   int calculateLength( int beginStringField = FIELD::BeginString,
                        int bodyLengthField = FIELD::BodyLength,
                        int checkSumField = FIELD::CheckSum ) const;
@@ -259,14 +388,15 @@ public:
   iterator end() { return m_fields.end(); }
   const_iterator begin() const { return m_fields.begin(); }
   const_iterator end() const { return m_fields.end(); }
-  g_iterator g_begin() { return m_groups.begin(); }
-  g_iterator g_end() { return m_groups.end(); }
-  g_const_iterator g_begin() const { return m_groups.begin(); }
-  g_const_iterator g_end() const { return m_groups.end(); }
+  g_iterator g_begin() { decodeGroups(); return m_groups.begin(); }
+  g_iterator g_end() { decodeGroups(); return m_groups.end(); }
+  g_const_iterator g_begin() const { decodeGroups(); return m_groups.begin(); }
+  g_const_iterator g_end() const { decodeGroups(); return m_groups.end(); }
 
 protected:
 
   friend class Message;
+  friend class GroupArena;
 
   void addField( const FieldBase& field )
   {
@@ -274,13 +404,35 @@ protected:
     if( iter == m_fields.end() )
     {
       m_fields.push_back( field );
+      if( !m_index.empty() )
+        indexField( field.getTag(), m_fields.size() - 1 );
+      else if( m_fields.size() >= INDEX_THRESHOLD )
+        buildIndex();
     }
     else
     {
+      std::size_t position = iter - m_fields.begin();
       m_fields.insert( iter, field );
+      if( !m_index.empty() )
+        reindexFrom( position );
+      else if( m_fields.size() >= INDEX_THRESHOLD )
+        buildIndex();
     }
   }
 
+#ifdef HAVE_RVALUE_REFERENCES
+  void addField( FieldBase&& field )
+  {
+    Fields::iterator iter = findPositionFor( field.getTag() );
+    std::size_t position = iter - m_fields.begin();
+    m_fields.insert( iter, std::move( field ) );
+    if( !m_index.empty() )
+      reindexFrom( position );
+    else if( m_fields.size() >= INDEX_THRESHOLD )
+      buildIndex();
+  }
+#endif
+
   // used to find data length fields during message decoding
   // message fields are not yet sorted so regular find*** functions might return wrong results
   const FieldBase& reverse_find( int tag ) const
@@ -297,16 +449,35 @@ protected:
   void appendField( const FieldBase& field )
   {
     m_fields.push_back( field );
+    if( !m_index.empty() )
+      indexField( field.getTag(), m_fields.size() - 1 );
   }
 
   // sort fields after message decoding
   void sortFields()
   {
     std::sort( m_fields.begin(), m_fields.end(), sorter(m_order) );
+    if( m_fields.size() >= INDEX_THRESHOLD )
+      buildIndex();
+    else
+      m_index.clear();
   }
 
 private:
 
+  // build any deferred groups before m_groups is used
+  void decodeGroups() const
+  {
+    if( !m_deferred.empty() )
+      decodeDeferredGroups();
+  }
+  void decodeDeferredGroups() const;
+  const DeferredGroup* findDeferred( int tag ) const;
+  void assign( const FieldMap& rhs, bool copyDeferred );
+#ifdef HAVE_RVALUE_REFERENCES
+  void take( FieldMap& rhs, bool movePooled );
+#endif
+
   Fields::const_iterator findTag( int tag ) const
   {
     return lookup( m_fields.begin(), m_fields.end(), tag );
@@ -320,6 +491,13 @@ private:
   template <typename Iterator>
   Iterator lookup(Iterator begin, Iterator end, int tag) const
   {
+    if( !m_index.empty() && tag >= 0 && tag < DIRECT_INDEX_SIZE )
+    {
+      if( (std::size_t)tag >= m_index.size() || m_index[ tag ] == 0 )
+        return end;
+      return begin + ( m_index[ tag ] - 1 );
+    }
+
 #if defined(__SUNPRO_CC)
     std::size_t numElements;
     std::distance( begin, end, numElements );
@@ -354,18 +532,89 @@ private:
     return std::upper_bound( m_fields.begin(), m_fields.end(), tag, sorter( m_order ) );
   }
 
+  // record the first position of a tag in the direct index
+  void indexField( int tag, std::size_t position )
+  {
+    if( tag < 0 || tag >= DIRECT_INDEX_SIZE )
+      return;
+    if( (std::size_t)tag >= m_index.size() )
+      m_index.resize( tag + 1, 0 );
+    if( m_index[ tag ] == 0 || (std::size_t)m_index[ tag ] > position + 1 )
+      m_index[ tag ] = (int)position + 1;
+  }
+
+  void buildIndex();
+  void reindexFrom( std::size_t position );
+
   Fields m_fields;
+  Index m_index;
   Groups m_groups;
   message_order m_order;
+  // owned by a GroupArena rather than by the map holding it
+  bool m_pooled;
+  // groups scanned but not yet built, and what builds them
+  mutable DeferredGroups m_deferred;
+  const GroupDecoder* m_pDecoder;
+};
+
+/**
+ * Owns the groups created while decoding a message.
+ *
+ * Groups are handed out from blocks of contiguous FieldMaps instead of
+ * being allocated one at a time.  reset() releases all of them in one
+ * step and keeps them, with their field storage, for the next message.
+ */
+class GroupArena
+{
+public:
+  GroupArena() : m_used( 0 ) {}
+  // groups belong to one message, so copies start out empty
+  GroupArena( const GroupArena& ) : m_used( 0 ) {}
+  GroupArena& operator=( const GroupArena& ) { return *this; }
+#ifdef HAVE_RVALUE_REFERENCES
+  // the groups move along with the message that holds them
+  GroupArena( GroupArena&& rhs ) : m_used( 0 ) { swap( rhs ); }
+  GroupArena& operator=( GroupArena&& rhs )
+  { reset(); swap( rhs ); return *this; }
+#endif
+  ~GroupArena();
+
+  /// Get an empty group sorted with the given order
+  FieldMap* allocate( const message_order& order );
+  /// Release every group handed out since the last reset
+  void reset();
+
+  std::size_t size() const { return m_used; }
+
+private:
+  void swap( GroupArena& rhs )
+  {
+    m_blocks.swap( rhs.m_blocks );
+    std::swap( m_used, rhs.m_used );
+  }
+
+  enum { BLOCK_SIZE = 32 };
+
+  std::vector < FieldMap* > m_blocks;
+  std::size_t m_used;
 };
 /*! @} */
 }
 
+#ifdef HAVE_RVALUE_REFERENCES
+#define FIELD_SET_RVALUE( MAP, FIELD )    \
+void set( FIELD&& field )                 \
+{ (MAP).setField(std::move(field)); }
+#else
+#define FIELD_SET_RVALUE( MAP, FIELD )
+#endif
+
 #define FIELD_SET( MAP, FIELD )           \
 bool isSet( const FIELD& field ) const    \
 { return (MAP).isSetField(field); }       \
 void set( const FIELD& field )            \
 { (MAP).setField(field); }                \
+FIELD_SET_RVALUE( MAP, FIELD )            \
 FIELD& get( FIELD& field ) const          \
 { return (FIELD&)(MAP).getField(field); } \
 bool getIfSet( FIELD& field ) const       \
@@ -80,21 +80,25 @@ void FileLogFactory::destroy( Log* pLog )
 }
 
 FileLog::FileLog( const std::string& path )
+: m_pClock( &Clock::realtime() )
 {
   init( path, path, "GLOBAL" );
 }
 
 FileLog::FileLog( const std::string& path, const std::string& backupPath )
+: m_pClock( &Clock::realtime() )
 {
   init( path, backupPath, "GLOBAL" );
 }
 
 FileLog::FileLog( const std::string& path, const SessionID& s )
+: m_pClock( &Clock::realtime() )
 {
   init( path, path, generatePrefix(s) );
 }
 
 FileLog::FileLog( const std::string& path, const std::string& backupPath, const SessionID& s )
+: m_pClock( &Clock::realtime() )
 {
   init( path, backupPath, generatePrefix(s) );
 }
@@ -80,17 +80,23 @@ public:
   void backup();
 
   void onIncoming( const std::string& value )
-  { m_messages << UtcTimeStampConvertor::convert(UtcTimeStamp(), 9) << " : " << value << std::endl; }
+  { write( m_messages, value ); }
   void onOutgoing( const std::string& value )
-  { m_messages << UtcTimeStampConvertor::convert(UtcTimeStamp(), 9) << " : " << value << std::endl; }
+  { write( m_messages, value ); }
   void onEvent( const std::string& value )
+  { write( m_event, value ); }
+
+  void setClock( Clock& clock )
+  { m_pClock = &clock; }
+
+private:
+  void write( std::ofstream& stream, const std::string& value )
   {
-    UtcTimeStamp now;
-    m_event << UtcTimeStampConvertor::convert( now, 9 )
-            << " : " << value << std::endl;
+    char timestamp[ UtcTimeStampConvertor::MAX_LENGTH ];
+    stream.write( timestamp, m_timestamps.format( timestamp, m_pClock->now(), 9 ) );
+    stream << " : " << value << std::endl;
   }
 
-private:
   std::string generatePrefix( const SessionID& sessionID );
   void init( std::string path, std::string backupPath, const std::string& prefix );
 
@@ -100,6 +106,8 @@ private:
   std::string m_eventFileName;
   std::string m_fullPrefix;
   std::string m_fullBackupPrefix;
+  UtcTimeStampCache m_timestamps;
+  Clock* m_pClock;
 };
 }
 
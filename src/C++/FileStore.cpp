@@ -191,6 +191,28 @@ void FileStoreFactory::destroy( MessageStore* pStore )
 
 bool FileStore::set( int msgSeqNum, const std::string& msg )
 EXCEPT ( IOException )
+{
+  long offset = seekToEnd();
+  append( msgSeqNum, msg, offset );
+  flush();
+  return true;
+}
+
+bool FileStore::setBatch( int msgSeqNum,
+                          const std::vector < std::string > & messages )
+EXCEPT ( IOException )
+{
+  if ( messages.empty() ) return true;
+
+  long offset = seekToEnd();
+  std::vector < std::string > ::const_iterator i;
+  for ( i = messages.begin(); i != messages.end(); ++i )
+    append( msgSeqNum++, *i, offset );
+  flush();
+  return true;
+}
+
+long FileStore::seekToEnd() EXCEPT ( IOException )
 {
   if ( fseek( m_msgFile, 0, SEEK_END ) ) 
     throw IOException( "Cannot seek to end of " + m_msgFileName );
@@ -200,6 +222,12 @@ EXCEPT ( IOException )
   long offset = ftell( m_msgFile );
   if ( offset < 0 ) 
     throw IOException( "Unable to get file pointer position from " + m_msgFileName );
+  return offset;
+}
+
+void FileStore::append( int msgSeqNum, const std::string& msg, long& offset )
+EXCEPT ( IOException )
+{
   std::size_t size = msg.size();
 
   if ( fprintf( m_headerFile, "%d,%ld,%lu ", msgSeqNum, offset, size ) < 0 )
@@ -213,11 +241,15 @@ EXCEPT ( IOException )
   fwrite( msg.c_str(), sizeof( char ), msg.size(), m_msgFile );
   if ( ferror( m_msgFile ) ) 
     throw IOException( "Unable to write to file " + m_msgFileName );
+  offset += (long)size;
+}
+
+void FileStore::flush() EXCEPT ( IOException )
+{
   if ( fflush( m_msgFile ) == EOF ) 
     throw IOException( "Unable to flush file " + m_msgFileName );
   if ( fflush( m_headerFile ) == EOF ) 
     throw IOException( "Unable to flush file " + m_headerFileName );
-  return true;
 }
 
 void FileStore::get( int begin, int end,
@@ -85,6 +85,8 @@ public:
   virtual ~FileStore();
 
   bool set( int, const std::string& ) EXCEPT ( IOException );
+  /// Append all messages before flushing the files once
+  bool setBatch( int, const std::vector < std::string > & ) EXCEPT ( IOException );
   void get( int, int, std::vector < std::string > & ) const EXCEPT ( IOException );
 
   int getNextSenderMsgSeqNum() const EXCEPT ( IOException );
@@ -110,6 +112,10 @@ private:
   void open( bool deleteFile );
   void populateCache();
   bool readFromFile( int offset, int size, std::string& msg );
+  long seekToEnd() EXCEPT ( IOException );
+  void append( int msgSeqNum, const std::string& msg, long& offset )
+  EXCEPT ( IOException );
+  void flush() EXCEPT ( IOException );
   void setSeqNum();
   void setSession();
 
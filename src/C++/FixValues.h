@@ -125,6 +125,126 @@ namespace FIX
   const char MsgType_StreamAssignmentRequest[] = "CC";
   const char MsgType_StreamAssignmentReport[] = "CD";
   const char MsgType_StreamAssignmentReportACK[] = "CE";
+  const int MsgTypeId_Heartbeat = 1;
+  const int MsgTypeId_TestRequest = 2;
+  const int MsgTypeId_ResendRequest = 3;
+  const int MsgTypeId_Reject = 4;
+  const int MsgTypeId_SequenceReset = 5;
+  const int MsgTypeId_Logout = 6;
+  const int MsgTypeId_Logon = 11;
+  const int MsgTypeId_IOI = 7;
+  const int MsgTypeId_Advertisement = 8;
+  const int MsgTypeId_ExecutionReport = 9;
+  const int MsgTypeId_OrderCancelReject = 10;
+  const int MsgTypeId_News = 12;
+  const int MsgTypeId_Email = 13;
+  const int MsgTypeId_NewOrderSingle = 14;
+  const int MsgTypeId_NewOrderList = 15;
+  const int MsgTypeId_OrderCancelRequest = 16;
+  const int MsgTypeId_OrderCancelReplaceRequest = 17;
+  const int MsgTypeId_OrderStatusRequest = 18;
+  const int MsgTypeId_Allocation = 20;
+  const int MsgTypeId_ListCancelRequest = 21;
+  const int MsgTypeId_ListExecute = 22;
+  const int MsgTypeId_ListStatusRequest = 23;
+  const int MsgTypeId_ListStatus = 24;
+  const int MsgTypeId_AllocationInstructionAck = 26;
+  const int MsgTypeId_DontKnowTrade = 27;
+  const int MsgTypeId_QuoteRequest = 28;
+  const int MsgTypeId_Quote = 29;
+  const int MsgTypeId_SettlementInstructions = 30;
+  const int MsgTypeId_MarketDataRequest = 32;
+  const int MsgTypeId_MarketDataSnapshotFullRefresh = 33;
+  const int MsgTypeId_MarketDataIncrementalRefresh = 34;
+  const int MsgTypeId_MarketDataRequestReject = 35;
+  const int MsgTypeId_QuoteCancel = 36;
+  const int MsgTypeId_QuoteStatusRequest = 37;
+  const int MsgTypeId_QuoteAcknowledgement = 38;
+  const int MsgTypeId_SecurityDefinitionRequest = 39;
+  const int MsgTypeId_SecurityDefinition = 40;
+  const int MsgTypeId_SecurityStatusRequest = 41;
+  const int MsgTypeId_SecurityStatus = 42;
+  const int MsgTypeId_TradingSessionStatusRequest = 43;
+  const int MsgTypeId_TradingSessionStatus = 44;
+  const int MsgTypeId_MassQuote = 45;
+  const int MsgTypeId_BusinessMessageReject = 46;
+  const int MsgTypeId_BidRequest = 47;
+  const int MsgTypeId_BidResponse = 48;
+  const int MsgTypeId_ListStrikePrice = 49;
+  const int MsgTypeId_AllocationAck = 26;
+  const int MsgTypeId_MassQuoteAcknowledgement = 38;
+  const int MsgTypeId_XMLnonFIX = 50;
+  const int MsgTypeId_RegistrationInstructions = 51;
+  const int MsgTypeId_RegistrationInstructionsResponse = 52;
+  const int MsgTypeId_OrderMassCancelRequest = 53;
+  const int MsgTypeId_OrderMassCancelReport = 54;
+  const int MsgTypeId_NewOrderCross = 55;
+  const int MsgTypeId_CrossOrderCancelRequest = 57;
+  const int MsgTypeId_CrossOrderCancelReplaceRequest = 56;
+  const int MsgTypeId_SecurityTypeRequest = 58;
+  const int MsgTypeId_SecurityTypes = 59;
+  const int MsgTypeId_SecurityListRequest = 60;
+  const int MsgTypeId_SecurityList = 61;
+  const int MsgTypeId_DerivativeSecurityListRequest = 62;
+  const int MsgTypeId_DerivativeSecurityList = 693;
+  const int MsgTypeId_NewOrderMultileg = 694;
+  const int MsgTypeId_MultilegOrderCancelReplaceRequest = 695;
+  const int MsgTypeId_TradeCaptureReportRequest = 696;
+  const int MsgTypeId_TradeCaptureReport = 697;
+  const int MsgTypeId_OrderMassStatusRequest = 698;
+  const int MsgTypeId_QuoteRequestReject = 699;
+  const int MsgTypeId_RFQRequest = 700;
+  const int MsgTypeId_QuoteStatusReport = 701;
+  const int MsgTypeId_AllocationInstruction = 20;
+  const int MsgTypeId_MultilegOrderCancelReplace = 695;
+  const int MsgTypeId_QuoteResponse = 702;
+  const int MsgTypeId_Confirmation = 703;
+  const int MsgTypeId_PositionMaintenanceRequest = 704;
+  const int MsgTypeId_PositionMaintenanceReport = 705;
+  const int MsgTypeId_RequestForPositions = 706;
+  const int MsgTypeId_RequestForPositionsAck = 707;
+  const int MsgTypeId_PositionReport = 708;
+  const int MsgTypeId_TradeCaptureReportRequestAck = 709;
+  const int MsgTypeId_TradeCaptureReportAck = 710;
+  const int MsgTypeId_AllocationReport = 711;
+  const int MsgTypeId_AllocationReportAck = 712;
+  const int MsgTypeId_ConfirmationAck = 713;
+  const int MsgTypeId_SettlementInstructionRequest = 714;
+  const int MsgTypeId_AssignmentReport = 715;
+  const int MsgTypeId_CollateralRequest = 716;
+  const int MsgTypeId_CollateralAssignment = 717;
+  const int MsgTypeId_CollateralResponse = 718;
+  const int MsgTypeId_CollateralReport = 755;
+  const int MsgTypeId_CollateralInquiry = 756;
+  const int MsgTypeId_NetworkCounterpartySystemStatusRequest = 757;
+  const int MsgTypeId_NetworkCounterpartySystemStatusResponse = 758;
+  const int MsgTypeId_UserRequest = 759;
+  const int MsgTypeId_UserResponse = 760;
+  const int MsgTypeId_CollateralInquiryAck = 761;
+  const int MsgTypeId_ConfirmationRequest = 762;
+  const int MsgTypeId_ContraryIntentionReport = 769;
+  const int MsgTypeId_SecurityDefinitionUpdateReport = 770;
+  const int MsgTypeId_SecurityListUpdateReport = 765;
+  const int MsgTypeId_AdjustedPositionReport = 766;
+  const int MsgTypeId_AllocationInstructionAlert = 767;
+  const int MsgTypeId_ExecutionAcknowledgement = 768;
+  const int MsgTypeId_TradingSessionList = 764;
+  const int MsgTypeId_TradingSessionListRequest = 763;
+  const int MsgTypeId_SettlementObligationReport = 771;
+  const int MsgTypeId_DerivativeSecurityListUpdateReport = 772;
+  const int MsgTypeId_TradingSessionListUpdateReport = 773;
+  const int MsgTypeId_MarketDefinitionRequest = 774;
+  const int MsgTypeId_MarketDefinition = 775;
+  const int MsgTypeId_MarketDefinitionUpdateReport = 776;
+  const int MsgTypeId_ApplicationMessageRequest = 777;
+  const int MsgTypeId_ApplicationMessageRequestAck = 778;
+  const int MsgTypeId_ApplicationMessageReport = 779;
+  const int MsgTypeId_OrderMassActionReport = 780;
+  const int MsgTypeId_OrderMassActionRequest = 817;
+  const int MsgTypeId_UserNotification = 818;
+  const int MsgTypeId_StreamAssignmentRequest = 819;
+  const int MsgTypeId_StreamAssignmentReport = 820;
+  const int MsgTypeId_StreamAssignmentReportACK = 821;
   const char PossDupFlag_NO = 'N';
   const char PossDupFlag_YES = 'Y';
   const char PossResend_NO = 'N';
@@ -32,6 +32,13 @@ void Group::addGroup( const Group& group )
   FieldMap::addGroup( group.field(), group );
 }
 
+#ifdef HAVE_RVALUE_REFERENCES
+void Group::addGroup( Group&& group )
+{
+  FieldMap::addGroup( group.field(), std::move( group ) );
+}
+#endif
+
 void Group::replaceGroup( unsigned num, const FIX::Group& group )
 {
   FieldMap::replaceGroup( num, group.field(), group ); 
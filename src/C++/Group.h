@@ -53,10 +53,34 @@ public:
   Group( const Group& copy )
   : FieldMap( copy ), m_field( copy.m_field ), m_delim( copy.m_delim ) {}
 
+#ifdef HAVE_RVALUE_REFERENCES
+  Group( Group&& rhs )
+  : FieldMap( std::move( rhs ) ), m_field( rhs.m_field ), m_delim( rhs.m_delim ) {}
+
+  Group& operator=( const Group& rhs )
+  {
+    FieldMap::operator=( rhs );
+    m_field = rhs.m_field;
+    m_delim = rhs.m_delim;
+    return *this;
+  }
+
+  Group& operator=( Group&& rhs )
+  {
+    FieldMap::operator=( std::move( rhs ) );
+    m_field = rhs.m_field;
+    m_delim = rhs.m_delim;
+    return *this;
+  }
+#endif
+
   int field() const { return m_field; }
   int delim() const { return m_delim; }
 
   void addGroup( const Group& group );
+#ifdef HAVE_RVALUE_REFERENCES
+  void addGroup( Group&& group );
+#endif
   void replaceGroup( unsigned num, const Group& group );
   Group& getGroup( unsigned num, Group& group ) const EXCEPT ( FieldNotFound );
   void removeGroup( unsigned num, const Group& group );
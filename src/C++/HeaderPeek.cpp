@@ -0,0 +1,184 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "HeaderPeek.h"
+#include "ByteScanner.h"
+#include "FieldConvertors.h"
+#include "Message.h"
+
+namespace FIX
+{
+bool HeaderPeek::peek( const char* data, std::size_t length )
+{
+  static const int order[] =
+  { FIELD::BeginString, FIELD::BodyLength, FIELD::MsgType };
+
+  clear();
+
+  const char* pos = data;
+  const char* const end = data + length;
+  int count = 0;
+  int dataTag = 0;
+  int dataLength = 0;
+
+  while ( pos < end )
+  {
+    const char* equalSign = ByteScanner::find( pos, end, '=' );
+    int tag = 0;
+    if ( equalSign == end || !ByteScanner::parseTag( pos, equalSign, tag ) )
+      break;
+    if ( count < 3 && order[ count ] != tag )
+      break;
+    if ( tag != dataTag && !Message::isHeaderField( tag ) )
+      break;
+
+    const char* value = equalSign + 1;
+    const char* soh = 0;
+    if ( tag == dataTag )
+    {
+      // data fields may hold SOH so their length field is used instead
+      if ( dataLength < 0 || end - value <= dataLength )
+        break;
+      soh = value + dataLength;
+      if ( *soh != '\001' )
+        break;
+    }
+    else
+    {
+      soh = ByteScanner::findSoh( value, end );
+      if ( soh == end )
+        break;
+    }
+
+    dataTag = 0;
+    if ( tag == FIELD::SecureDataLen || tag == FIELD::XmlDataLen )
+    {
+      if ( !IntConvertor::convert( value, soh, dataLength ) )
+        break;
+      dataTag = tag == FIELD::SecureDataLen ? FIELD::SecureData : FIELD::XmlData;
+    }
+
+    const int slot = slotOf( tag );
+    if ( slot != SLOTS && !m_values[ slot ] )
+    {
+      m_values[ slot ] = value;
+      m_lengths[ slot ] = soh - value;
+    }
+
+    ++count;
+    pos = soh + 1;
+  }
+
+  m_valid = count >= 3;
+  return m_valid;
+}
+
+bool HeaderPeek::getValue( int tag, const char*& value, std::size_t& length ) const
+{
+  const int slot = slotOf( tag );
+  if ( slot == SLOTS || !m_values[ slot ] )
+    return false;
+  value = m_values[ slot ];
+  length = m_lengths[ slot ];
+  return true;
+}
+
+bool HeaderPeek::isSetField( int tag ) const
+{
+  const int slot = slotOf( tag );
+  return slot != SLOTS && m_values[ slot ] != 0;
+}
+
+bool HeaderPeek::getFieldIfSet( FieldBase& field ) const
+{
+  const char* value = 0;
+  std::size_t length = 0;
+  if ( !getValue( field.getTag(), value, length ) )
+    return false;
+  field.setString( std::string( value, length ) );
+  return true;
+}
+
+std::string HeaderPeek::getField( int tag ) const
+EXCEPT ( FieldNotFound )
+{
+  const char* value = 0;
+  std::size_t length = 0;
+  if ( !getValue( tag, value, length ) )
+    throw FieldNotFound( tag );
+  return std::string( value, length );
+}
+
+int HeaderPeek::getMsgTypeId() const
+{
+  if ( !m_values[ MSG_TYPE ] )
+    return 0;
+  return Message::msgTypeId( m_values[ MSG_TYPE ], m_lengths[ MSG_TYPE ] );
+}
+
+int HeaderPeek::getMsgSeqNum() const
+{
+  const char* value = m_values[ MSG_SEQ_NUM ];
+  int result = 0;
+  if ( !value
+       || !IntConvertor::convert( value, value + m_lengths[ MSG_SEQ_NUM ], result ) )
+    return 0;
+  return result;
+}
+
+bool HeaderPeek::isPossDup() const
+{
+  return m_lengths[ POSS_DUP_FLAG ] == 1 && *m_values[ POSS_DUP_FLAG ] == 'Y';
+}
+
+int HeaderPeek::slotOf( int tag )
+{
+  switch ( tag )
+  {
+    case FIELD::BeginString: return BEGIN_STRING;
+    case FIELD::BodyLength: return BODY_LENGTH;
+    case FIELD::MsgType: return MSG_TYPE;
+    case FIELD::MsgSeqNum: return MSG_SEQ_NUM;
+    case FIELD::PossDupFlag: return POSS_DUP_FLAG;
+    case FIELD::SenderCompID: return SENDER_COMP_ID;
+    case FIELD::TargetCompID: return TARGET_COMP_ID;
+    case FIELD::SenderSubID: return SENDER_SUB_ID;
+    case FIELD::TargetSubID: return TARGET_SUB_ID;
+    case FIELD::ApplVerID: return APPL_VER_ID;
+    default: return SLOTS;
+  }
+}
+
+void HeaderPeek::clear()
+{
+  for ( int i = 0; i < SLOTS; ++i )
+  {
+    m_values[ i ] = 0;
+    m_lengths[ i ] = 0;
+  }
+  m_valid = false;
+}
+}
@@ -0,0 +1,97 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_HEADERPEEK_H
+#define FIX_HEADERPEEK_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4786 )
+#endif
+
+#include "Field.h"
+#include "Exceptions.h"
+#include <cstddef>
+#include <string>
+
+namespace FIX
+{
+/**
+ * Session level header fields of a raw message, found without building
+ * a Message.
+ *
+ * One pass over the header records where the values of BeginString,
+ * BodyLength, MsgType, MsgSeqNum, PossDupFlag, SenderCompID,
+ * TargetCompID, SenderSubID, TargetSubID and ApplVerID are.  Nothing is
+ * copied or allocated, so the raw message must outlive the peek.  The
+ * scan stops at the first field that is not a header field.
+ */
+class HeaderPeek
+{
+public:
+  HeaderPeek() { clear(); }
+  HeaderPeek( const char* data, std::size_t length ) { peek( data, length ); }
+  HeaderPeek( const std::string& string ) { peek( string ); }
+
+  /**
+   * Find the header fields at the start of data.
+   *
+   * @return false unless data starts with BeginString, BodyLength
+   *         and MsgType
+   */
+  bool peek( const char* data, std::size_t length );
+  bool peek( const std::string& string )
+  { return peek( string.data(), string.size() ); }
+
+  /// True if the last peek found BeginString, BodyLength and MsgType
+  bool isValid() const { return m_valid; }
+
+  /// Point value at the value of tag, false if it was not found
+  bool getValue( int tag, const char*& value, std::size_t& length ) const;
+  bool isSetField( int tag ) const;
+  bool getFieldIfSet( FieldBase& field ) const;
+  std::string getField( int tag ) const EXCEPT ( FieldNotFound );
+
+  /// Integer id of the MsgType, zero if it was not found
+  int getMsgTypeId() const;
+  /// Value of MsgSeqNum, zero if it was not found or is not a number
+  int getMsgSeqNum() const;
+  /// True if PossDupFlag is Y
+  bool isPossDup() const;
+
+private:
+  enum Slot
+  {
+    BEGIN_STRING, BODY_LENGTH, MSG_TYPE, MSG_SEQ_NUM, POSS_DUP_FLAG,
+    SENDER_COMP_ID, TARGET_COMP_ID, SENDER_SUB_ID, TARGET_SUB_ID,
+    APPL_VER_ID, SLOTS
+  };
+
+  /// Slot of tag, SLOTS if it is not peeked
+  static int slotOf( int tag );
+  void clear();
+
+  const char* m_values[ SLOTS ];
+  std::size_t m_lengths[ SLOTS ];
+  bool m_valid;
+};
+}
+
+#endif //FIX_HEADERPEEK_H
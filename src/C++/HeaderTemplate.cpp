@@ -0,0 +1,135 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "HeaderTemplate.h"
+
+namespace FIX
+{
+HeaderTemplate::HeaderTemplate( const SessionID& sessionID )
+: m_beginString( sessionID.getBeginString().getString() ),
+  m_senderCompID( sessionID.getSenderCompID().getString() ),
+  m_targetCompID( sessionID.getTargetCompID().getString() ),
+  m_beginStringLength( sessionID.getBeginString().getLength() )
+{
+  m_beginStringPrefix = sessionID.getBeginString().getFixString();
+  TagPrefix::appendTo( m_beginStringPrefix, FIELD::BodyLength );
+
+  m_senderCompIDSlot = '\001';
+  m_senderCompIDSlot += sessionID.getSenderCompID().getFixString();
+  TagPrefix::appendTo( m_senderCompIDSlot, FIELD::SendingTime );
+
+  m_targetCompIDSlot = '\001';
+  m_targetCompIDSlot += sessionID.getTargetCompID().getFixString();
+}
+
+bool HeaderTemplate::serialize( const Message& message, int msgSeqNum,
+                                const char* sendingTime, std::size_t sendingTimeLength,
+                                std::string& result ) const
+{
+  const Header& header = message.getHeader();
+  if ( header.g_begin() != header.g_end() )
+    return false;
+
+  // a header ordered by a data dictionary may write its fields in
+  // another order than the template does
+  const message_order& order = header.getOrder();
+  if ( !order( FIELD::BeginString, FIELD::BodyLength )
+       || !order( FIELD::BodyLength, FIELD::MsgType )
+       || !order( FIELD::MsgType, FIELD::MsgSeqNum )
+       || !order( FIELD::MsgSeqNum, FIELD::SenderCompID )
+       || !order( FIELD::SenderCompID, FIELD::SendingTime )
+       || !order( FIELD::SendingTime, FIELD::TargetCompID ) )
+    return false;
+
+  char seqNumBuffer[ 20 ];
+  char* seqNum = integer_to_string( seqNumBuffer, sizeof( seqNumBuffer ), msgSeqNum );
+  std::size_t seqNumLength = seqNumBuffer + sizeof( seqNumBuffer ) - seqNum;
+
+  // the fields are only compared to find what application callbacks
+  // changed after the session set them; the values written come from
+  // the session
+  const FieldBase* msgType = 0;
+  bool hasMsgSeqNum = false;
+  bool hasSendingTime = false;
+  Header::const_iterator i;
+  for ( i = header.begin(); i != header.end(); ++i )
+  {
+    const std::string& value = i->getString();
+    switch ( i->getTag() )
+    {
+    case FIELD::BodyLength:
+      break;
+    case FIELD::MsgType:
+      msgType = &*i;
+      break;
+    case FIELD::MsgSeqNum:
+      if ( value.size() != seqNumLength
+           || value.compare( 0, seqNumLength, seqNum, seqNumLength ) != 0 )
+        return false;
+      hasMsgSeqNum = true;
+      break;
+    case FIELD::SendingTime:
+      if ( value.size() != sendingTimeLength
+           || value.compare( 0, sendingTimeLength, sendingTime, sendingTimeLength ) != 0 )
+        return false;
+      hasSendingTime = true;
+      break;
+    case FIELD::BeginString:
+      if ( value != m_beginString ) return false;
+      break;
+    case FIELD::SenderCompID:
+      if ( value != m_senderCompID ) return false;
+      break;
+    case FIELD::TargetCompID:
+      if ( value != m_targetCompID ) return false;
+      break;
+    default:
+      return false;
+    }
+  }
+
+  if ( !msgType || !hasMsgSeqNum || !hasSendingTime )
+    return false;
+
+  int width = message.lengthWidth( FIELD::BodyLength );
+
+  // written in the order Message::toString writes these fields in
+  result.assign( m_beginStringPrefix );
+  std::string::size_type lengthPosition = result.size();
+  result.append( width, '0' );
+  result += '\001';
+  msgType->appendTo( result );
+  TagPrefix::appendTo( result, FIELD::MsgSeqNum );
+  result.append( seqNum, seqNumLength );
+  result += m_senderCompIDSlot;
+  result.append( sendingTime, sendingTimeLength );
+  result += m_targetCompIDSlot;
+
+  int total = (int)ByteScanner::sum( result.data(), result.data() + result.size() );
+  message.finishString( result, total, lengthPosition, width,
+                        m_beginStringLength, FIELD::BodyLength, FIELD::CheckSum );
+  return true;
+}
+}
@@ -0,0 +1,82 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifndef FIX_HEADERTEMPLATE_H
+#define FIX_HEADERTEMPLATE_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4786 )
+#endif
+
+#include "Message.h"
+#include "SessionID.h"
+#include <string>
+
+namespace FIX
+{
+/**
+ * Pre-serialized standard header of a session.
+ *
+ * BeginString, SenderCompID and TargetCompID do not change during a
+ * session so they are rendered once and need not be set on the message.
+ * MsgSeqNum and SendingTime are written into their slots from the values
+ * the session assigned, so only MsgType is taken from the message.  A
+ * message whose header holds anything else, or whose fields were changed
+ * after the session set them, is not serialized and should go through
+ * Message::toString.
+ */
+class HeaderTemplate
+{
+public:
+  HeaderTemplate( const SessionID& sessionID );
+
+  /**
+   * Serialize a message with the header Session::fill produces.  The
+   * result matches Message::toString of the message with the identity
+   * fields set, and BodyLength and CheckSum are updated on the message
+   * the same way.
+   *
+   * @param msgSeqNum the sequence number the session set on the message
+   * @param sendingTime the SendingTime the session set on the message
+   * @return false if the header does not fit the template
+   */
+  bool serialize( const Message& message, int msgSeqNum,
+                  const char* sendingTime, std::size_t sendingTimeLength,
+                  std::string& result ) const;
+
+private:
+  std::string m_beginString;
+  std::string m_senderCompID;
+  std::string m_targetCompID;
+
+  /// "8=<BeginString>[SOH]9="
+  std::string m_beginStringPrefix;
+  /// length of "8=<BeginString>[SOH]", which BodyLength does not count
+  int m_beginStringLength;
+  /// "[SOH]49=<SenderCompID>[SOH]52=", between MsgSeqNum and SendingTime
+  std::string m_senderCompIDSlot;
+  /// "[SOH]56=<TargetCompID>[SOH]", after SendingTime
+  std::string m_targetCompIDSlot;
+};
+}
+
+#endif //FIX_HEADERTEMPLATE_H
@@ -68,8 +68,15 @@ void Initiator::initialize() EXCEPT ( ConfigError )
   if ( !sessions.size() )
     throw ConfigError( "No sessions defined" );
 
+  std::string clockSource = "REALTIME";
+  if ( m_settings.get().has( CLOCK_SOURCE ) )
+    clockSource = m_settings.get().getString( CLOCK_SOURCE );
+  m_pClock.reset( Clock::create( clockSource ) );
+  if ( m_pLog )
+    m_pLog->setClock( *m_pClock );
+
   SessionFactory factory( m_application, m_messageStoreFactory,
-                          m_pLogFactory );
+                          m_pLogFactory, m_pClock.get() );
 
   for ( i = sessions.begin(); i != sessions.end(); ++i )
   {
@@ -137,7 +144,7 @@ void Initiator::connect()
   for ( ; i != disconnected.end(); ++i )
   {
     Session* pSession = Session::lookupSession( *i );
-    if ( pSession->isEnabled() && pSession->isSessionTime(UtcTimeStamp()) )
+    if ( pSession->isEnabled() && pSession->isSessionTime(pSession->getClock().now()) )
       doConnect( *i, m_settings.get( *i ));
   }
 }
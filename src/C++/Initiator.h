@@ -93,6 +93,9 @@ public:
     return &m_nullLog;
   }
 
+  /// Clock shared by the sessions of this initiator
+  Clock& getClock() { return *m_pClock; }
+
 protected:
   void setPending( const SessionID& );
   void setConnected( const SessionID& );
@@ -141,6 +144,7 @@ private:
   LogFactory* m_pLogFactory;
   Log* m_pLog;
   NullLog m_nullLog;
+  SmartPtr<Clock> m_pClock;
   bool m_firstPoll;
   bool m_stop;
   Mutex m_mutex;
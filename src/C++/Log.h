@@ -27,6 +27,7 @@
 #endif
 
 #include "Message.h"
+#include "Clock.h"
 #include "Mutex.h"
 #include "SessionSettings.h"
 #include <map>
@@ -88,6 +89,9 @@ public:
   virtual void onIncoming( const std::string& ) = 0;
   virtual void onOutgoing( const std::string& ) = 0;
   virtual void onEvent( const std::string& ) = 0;
+  /// Clock used to timestamp entries, logs that do not keep their own
+  /// timestamps can ignore it
+  virtual void setClock( Clock& ) {}
 };
 /*! @} */
 
@@ -43,18 +43,32 @@ SmartPtr<DataDictionary> Message::s_dataDictionary;
 Message::Message()
 : m_validStructure( true )
 , m_tag( 0 )
+, m_lazyGroups( false )
+, m_pGroupSessionDD( 0 )
+, m_pGroupApplicationDD( 0 )
+, m_pDecodeProfile( 0 )
+, m_skippedLength( 0 )
+, m_skippedTotal( 0 )
 {
   
 }
 
 Message::Message(const message_order &hdrOrder, const message_order &trlOrder, const message_order& order)
 : FieldMap(order), m_header(hdrOrder),
-  m_trailer(trlOrder), m_validStructure( true ) {}
+  m_trailer(trlOrder), m_validStructure( true ), m_lazyGroups( false ),
+  m_pGroupSessionDD( 0 ), m_pGroupApplicationDD( 0 ), m_pDecodeProfile( 0 ),
+  m_skippedLength( 0 ), m_skippedTotal( 0 ) {}
 
 Message::Message( const std::string& string, bool validate )
 EXCEPT ( InvalidMessage )
 : m_validStructure( true )
 , m_tag( 0 )
+, m_lazyGroups( false )
+, m_pGroupSessionDD( 0 )
+, m_pGroupApplicationDD( 0 )
+, m_pDecodeProfile( 0 )
+, m_skippedLength( 0 )
+, m_skippedTotal( 0 )
 {
   setString( string, validate );
 }
@@ -65,6 +79,12 @@ Message::Message( const std::string& string,
 EXCEPT ( InvalidMessage )
 : m_validStructure( true )
 , m_tag( 0 )
+, m_lazyGroups( false )
+, m_pGroupSessionDD( 0 )
+, m_pGroupApplicationDD( 0 )
+, m_pDecodeProfile( 0 )
+, m_skippedLength( 0 )
+, m_skippedTotal( 0 )
 {
   setString( string, validate, &dataDictionary, &dataDictionary );
 }
@@ -76,6 +96,12 @@ Message::Message( const std::string& string,
 EXCEPT ( InvalidMessage )
 : m_validStructure( true )
 , m_tag( 0 )
+, m_lazyGroups( false )
+, m_pGroupSessionDD( 0 )
+, m_pGroupApplicationDD( 0 )
+, m_pDecodeProfile( 0 )
+, m_skippedLength( 0 )
+, m_skippedTotal( 0 )
 {
     setString( string, validate, &sessionDataDictionary, &applicationDataDictionary );
 }
@@ -88,7 +114,9 @@ Message::Message( const message_order &hdrOrder,
                   bool validate )
 EXCEPT ( InvalidMessage )
 : FieldMap(order), m_header(hdrOrder),
-  m_trailer(trlOrder), m_validStructure( true )
+  m_trailer(trlOrder), m_validStructure( true ), m_lazyGroups( false ),
+  m_pGroupSessionDD( 0 ), m_pGroupApplicationDD( 0 ), m_pDecodeProfile( 0 ),
+  m_skippedLength( 0 ), m_skippedTotal( 0 )
 {
   setString( string, validate, &dataDictionary, &dataDictionary );
 }
@@ -102,7 +130,9 @@ Message::Message( const message_order &hdrOrder,
                   bool validate )
 EXCEPT ( InvalidMessage )
 : FieldMap(order), m_header(hdrOrder),
-  m_trailer(trlOrder), m_validStructure( true )
+  m_trailer(trlOrder), m_validStructure( true ), m_lazyGroups( false ),
+  m_pGroupSessionDD( 0 ), m_pGroupApplicationDD( 0 ), m_pDecodeProfile( 0 ),
+  m_skippedLength( 0 ), m_skippedTotal( 0 )
 {
   setStringHeader( string );
   if( isAdmin() )
@@ -114,26 +144,113 @@ EXCEPT ( InvalidMessage )
 Message::Message( const BeginString& beginString, const MsgType& msgType )
 : m_validStructure(true)
 , m_tag( 0 )
+, m_lazyGroups( false )
+, m_pGroupSessionDD( 0 )
+, m_pGroupApplicationDD( 0 )
+, m_pDecodeProfile( 0 )
+, m_skippedLength( 0 )
+, m_skippedTotal( 0 )
 {
   m_header.setField(beginString);
   m_header.setField(msgType);
 }
 
 Message::Message(const Message& copy)
-: FieldMap(copy)
-, m_header(copy.m_header)
-, m_trailer(copy.m_trailer)
+: FieldMap(copy, true)
 , m_validStructure(copy.m_validStructure)
 , m_tag(copy.m_tag)
+, m_lazyGroups(copy.m_lazyGroups)
+, m_pGroupSessionDD(0)
+, m_pGroupApplicationDD(0)
+, m_pDecodeProfile(0)
+, m_skippedLength(copy.m_skippedLength)
+, m_skippedTotal(copy.m_skippedTotal)
+, m_skippedFields(copy.m_skippedFields)
 #ifdef HAVE_EMX
 , m_subMsgType(copy.m_subMsgType)
 #endif
 {
+  m_header.assign( copy.m_header, true );
+  m_trailer.assign( copy.m_trailer, true );
+  copyDeferredGroups( copy );
+}
+
+Message& Message::operator=( const Message& rhs )
+{
+  if ( this == &rhs ) return *this;
+
+  // groups in the arena are let go of before the maps are copied
+  clear();
+  FieldMap::assign( rhs, true );
+  m_header.assign( rhs.m_header, true );
+  m_trailer.assign( rhs.m_trailer, true );
+  m_validStructure = rhs.m_validStructure;
+  m_tag = rhs.m_tag;
+  m_lazyGroups = rhs.m_lazyGroups;
+  m_pGroupSessionDD = 0;
+  m_pGroupApplicationDD = 0;
+  copyDeferredGroups( rhs );
+  m_skippedLength = rhs.m_skippedLength;
+  m_skippedTotal = rhs.m_skippedTotal;
+  m_skippedFields = rhs.m_skippedFields;
+#ifdef HAVE_EMX
+  m_subMsgType = rhs.m_subMsgType;
+#endif
+  return *this;
+}
+
+#ifdef HAVE_RVALUE_REFERENCES
+Message::Message( Message&& rhs )
+: FieldMap( std::move( rhs ), true )
+, m_header( std::move( rhs.m_header ), true )
+, m_trailer( std::move( rhs.m_trailer ), true )
+, m_groupArena( std::move( rhs.m_groupArena ) )
+, m_pGroupSessionDD( 0 )
+, m_pGroupApplicationDD( 0 )
+{
+  takeState( rhs );
+}
 
+Message& Message::operator=( Message&& rhs )
+{
+  if ( this == &rhs ) return *this;
+
+  clear();
+  FieldMap::take( rhs, true );
+  m_header.take( rhs.m_header, true );
+  m_trailer.take( rhs.m_trailer, true );
+  m_groupArena = std::move( rhs.m_groupArena );
+  takeState( rhs );
+  return *this;
 }
 
+void Message::takeState( Message& rhs )
+{
+  m_validStructure = rhs.m_validStructure;
+  m_tag = rhs.m_tag;
+  m_lazyGroups = rhs.m_lazyGroups;
+  m_groupSource.swap( rhs.m_groupSource );
+  m_groupMsgType.swap( rhs.m_groupMsgType );
+  m_pGroupSessionDD = rhs.m_pGroupSessionDD;
+  m_pGroupApplicationDD = rhs.m_pGroupApplicationDD;
+  m_pDecodeProfile = rhs.m_pDecodeProfile;
+  m_skippedLength = rhs.m_skippedLength;
+  m_skippedTotal = rhs.m_skippedTotal;
+  m_skippedFields.swap( rhs.m_skippedFields );
+#ifdef HAVE_EMX
+  m_subMsgType.swap( rhs.m_subMsgType );
+#endif
+
+  adoptDeferredGroups();
+
+  rhs.clear();
+}
+#endif
+
 Message::~Message()
 {
+  // groups in the arena must be let go of before it is destroyed
+  clear();
 }
 
 bool Message::InitializeXML( const std::string& url )
@@ -247,9 +364,9 @@ std::string& Message::toString( std::string& str,
                                 int bodyLengthField, 
                                 int checkSumField ) const
 {
-  int length = bodyLength( beginStringField, bodyLengthField, checkSumField );
-  m_header.setField( IntField(bodyLengthField, length) );
-  m_trailer.setField( CheckSumField(checkSumField, checkSum(checkSumField)) );
+  int width = lengthWidth( bodyLengthField );
+  if ( !m_header.isSetField( bodyLengthField ) )
+    m_header.setField( IntField( bodyLengthField, 0 ) );
 
 #if defined(_MSC_VER) && _MSC_VER < 1300
   str = "";
@@ -257,12 +374,55 @@ std::string& Message::toString( std::string& str,
   str.clear();
 #endif
 
-  /*small speculation about the space needed for FIX string*/
-  str.reserve( length + 64 );
+  std::string::size_type lengthPosition = std::string::npos;
+  int total = m_header.serializeTo( str, checkSumField, &lengthPosition, bodyLengthField, width );
+  Fields::const_iterator beginString = m_header.findTag( beginStringField );
+  int beginStringLength = beginString != m_header.m_fields.end()
+    ? (int)beginString->getLength() : 0;
+  return finishString( str, total, lengthPosition, width,
+                       beginStringLength, bodyLengthField, checkSumField );
+}
+
+int Message::lengthWidth( int bodyLengthField ) const
+{
+  // The previous BodyLength, if any, is a good guess at how many digits
+  // to reserve; it is only wrong when the length crosses a power of ten.
+  Fields::const_iterator previous = m_header.findTag( bodyLengthField );
+  if ( previous != m_header.m_fields.end()
+       && previous->getString().length() > 0 && previous->getString().length() < 10 )
+    return (int)previous->getString().length();
+  return 3;
+}
 
-  m_header.calculateString( str );
-  FieldMap::calculateString( str );
-  m_trailer.calculateString( str );
+std::string& Message::finishString( std::string& str, int total,
+                                    std::string::size_type lengthPosition, int width,
+                                    int beginStringLength, int bodyLengthField,
+                                    int checkSumField ) const
+{
+  total += FieldMap::serializeTo( str, checkSumField );
+  total += m_trailer.serializeTo( str, checkSumField );
+
+  // backpatch BodyLength now that the body has been written.  It counts
+  // every byte but those of BeginString, BodyLength and CheckSum, which
+  // need not be the first fields when custom tags are passed.
+  int length = (int)( str.size() - TagPrefix::length( bodyLengthField ) - width - 1 )
+    - beginStringLength;
+  int digits = FIX::number_of_symbols_in( length );
+  if ( digits != width )
+    str.replace( lengthPosition, width, std::string( digits, '0' ) );
+  char* lengthBuffer = &str[ lengthPosition ];
+  FIX::integer_to_string( lengthBuffer, digits, length );
+  total -= width * '0';
+  for ( int i = 0; i < digits; ++i )
+    total += (unsigned char)lengthBuffer[ i ];
+
+  char checkSumBuffer[ 3 ];
+  int checkSumValue = total % 256;
+  FIX::integer_to_string_padded( checkSumBuffer, 3, checkSumValue );
+  FieldBase( checkSumField, std::string( checkSumBuffer, 3 ) ).appendTo( str );
+
+  m_header.setField( IntField( bodyLengthField, length ) );
+  m_trailer.setField( CheckSumField( checkSumField, checkSumValue ) );
 
   return str;
 }
@@ -347,9 +507,15 @@ EXCEPT ( InvalidMessage )
   FIX::MsgType msg;
 
   field_type type = header;
+  // body fields to decode, set once the message type is known
+  const DecodeProfile::Fields* pWanted = 0;
 
   while ( pos < string.size() )
   {
+    if ( pWanted && skipField( string, pos, *pWanted, msg, type,
+                               pSessionDataDictionary, pApplicationDataDictionary ) )
+      continue;
+
     FieldBase field = extractField( string, pos, pSessionDataDictionary, pApplicationDataDictionary );
     if ( count < 3 && headerOrder[ count++ ] != field.getTag() )
       if ( doValidation ) throw InvalidMessage("Header fields out of order");
@@ -384,12 +550,15 @@ EXCEPT ( InvalidMessage )
           m_subMsgType.assign(string.substr(equalSign, soh - equalSign ));
 #endif
         }
+
+        if ( m_pDecodeProfile && !isAdminMsgType( msg ) )
+          pWanted = m_pDecodeProfile->getFields( msg );
       }
 
       m_header.appendField( field );
 
       if ( pSessionDataDictionary )
-        setGroup( "_header_", field, string, pos, getHeader(), *pSessionDataDictionary );
+        setOrDeferGroup( "_header_", field, string, pos, getHeader(), *pSessionDataDictionary );
     }
     else if ( isTrailerField( field, pSessionDataDictionary ) )
     {
@@ -397,7 +566,7 @@ EXCEPT ( InvalidMessage )
       m_trailer.appendField( field );
 
       if ( pSessionDataDictionary )
-        setGroup( "_trailer_", field, string, pos, getTrailer(), *pSessionDataDictionary );
+        setOrDeferGroup( "_trailer_", field, string, pos, getTrailer(), *pSessionDataDictionary );
     }
     else
     {
@@ -412,9 +581,9 @@ EXCEPT ( InvalidMessage )
 
       if ( pApplicationDataDictionary )
 #ifdef HAVE_EMX
-        setGroup(m_subMsgType, field, string, pos, *this, *pApplicationDataDictionary);
+        setOrDeferGroup(m_subMsgType, field, string, pos, *this, *pApplicationDataDictionary);
 #else
-        setGroup( msg, field, string, pos, *this, *pApplicationDataDictionary );
+        setOrDeferGroup( msg, field, string, pos, *this, *pApplicationDataDictionary );
 #endif
     }
   }
@@ -431,47 +600,261 @@ EXCEPT ( InvalidMessage )
 void Message::setGroup( const std::string& msg, const FieldBase& field,
                         const std::string& string,
                         std::string::size_type& pos, FieldMap& map,
-                        const DataDictionary& dataDictionary )
+                        const DataDictionary& dataDictionary,
+                        GroupArena* pArena )
 {
   int group = field.getTag();
   int delim;
   const DataDictionary* pDD = 0;
   if ( !dataDictionary.getGroup( msg, group, delim, pDD ) ) return ;
-  SmartPtr<Group> pGroup;
+  FieldMap* pGroup = 0;
+  // a group not taken from the arena is owned here until it is added
+  SmartPtr<FieldMap> pOwned;
 
   while ( pos < string.size() )
   {
     std::string::size_type oldPos = pos;
-    FieldBase field = extractField( string, pos, &dataDictionary, &dataDictionary, pGroup.get() );
+    FieldBase field = extractField( string, pos, &dataDictionary, &dataDictionary, pGroup );
        
     // Start a new group because...
     if (// found delimiter
     (field.getTag() == delim) ||
     // no delimiter, but field belongs to group OR field already processed
-    (pDD->isField( field.getTag() ) && (pGroup.get() == 0 || pGroup->isSetField( field.getTag() )) ))
+    (pDD->isField( field.getTag() ) && (pGroup == 0 || pGroup->isSetField( field.getTag() )) ))
     {
-      if ( pGroup.get() )
+      if ( pGroup )
       {
-        map.addGroupPtr( group, pGroup.release(), false );
+        pOwned.release();
+        map.addGroupPtr( group, pGroup, false );
+      }
+      if ( pArena )
+        pGroup = pArena->allocate( pDD->getOrderedFields() );
+      else
+      {
+        pOwned.reset( new Group( field.getTag(), delim, pDD->getOrderedFields() ) );
+        pGroup = pOwned.get();
       }
-      pGroup.reset( new Group( field.getTag(), delim, pDD->getOrderedFields() ) );
     }
     else if ( !pDD->isField( field.getTag() ) )
     {
-      if ( pGroup.get() )
+      if ( pGroup )
       {
-        map.addGroupPtr( group, pGroup.release(), false );
+        pOwned.release();
+        map.addGroupPtr( group, pGroup, false );
       }
       pos = oldPos;
       return ;
     }
 
-    if ( !pGroup.get() ) return ;
+    if ( !pGroup ) return ;
     pGroup->addField( field );
-    setGroup( msg, field, string, pos, *pGroup, *pDD );
+    setGroup( msg, field, string, pos, *pGroup, *pDD, pArena );
   }
 }
 
+bool Message::skipField( const std::string& string, std::string::size_type& pos,
+                         const DecodeProfile::Fields& wanted, const std::string& msg,
+                         field_type& type, const DataDictionary* pSessionDD,
+                         const DataDictionary* pAppDD )
+{
+  const char* const strStart = string.data();
+  const char* const strEnd = strStart + string.size();
+  const char* const tagStart = strStart + pos;
+  const char* const equalSign = ByteScanner::find( tagStart, strEnd, '=' );
+  int field = 0;
+  if ( equalSign == strEnd || !ByteScanner::parseTag( tagStart, equalSign, field ) )
+    return false;
+
+  // data fields and their lengths are left to extractField,
+  // which finds the length among the decoded fields
+  if ( DecodeProfile::contains( wanted, field )
+       || isHeaderField( field, pSessionDD )
+       || isTrailerField( field, pSessionDD )
+       || IsDataField( field, pSessionDD, pAppDD )
+       || IsDataField( field + 1, pSessionDD, pAppDD ) )
+    return false;
+
+  const char* const soh = ByteScanner::findSoh( equalSign + 1, strEnd );
+  if ( soh == strEnd ) return false;
+
+  const std::string::size_type begin = pos;
+  pos = soh + 1 - strStart;
+  if ( pAppDD )
+  {
+    std::size_t count = 0;
+    m_scanned.clear();
+    if ( !skipGroup( msg, field, string, pos, *pAppDD, count ) )
+    {
+      pos = begin;
+      return false;
+    }
+  }
+
+  if ( type == trailer )
+  {
+    if(m_tag == 0) m_tag = field;
+    m_validStructure = false;
+  }
+  type = body;
+
+  m_skippedLength += (int)( pos - begin );
+  m_skippedTotal += (int)ByteScanner::sum( tagStart, strStart + pos );
+  std::vector < int >::iterator i =
+    std::lower_bound( m_skippedFields.begin(), m_skippedFields.end(), field );
+  if ( i == m_skippedFields.end() || *i != field )
+    m_skippedFields.insert( i, field );
+  return true;
+}
+
+void Message::setOrDeferGroup( const std::string& msg, const FieldBase& field,
+                               const std::string& string,
+                               std::string::size_type& pos, FieldMap& map,
+                               const DataDictionary& dataDictionary )
+{
+  if ( m_lazyGroups )
+  {
+    std::string::size_type begin = pos;
+    std::size_t count = 0;
+    m_scanned.clear();
+    if ( skipGroup( msg, field.getTag(), string, pos, dataDictionary, count ) )
+    {
+      if ( count == 0 ) return ;
+      if ( !m_header.hasDeferredGroups() && !FieldMap::hasDeferredGroups()
+           && !m_trailer.hasDeferredGroups() )
+        m_groupSource.assign( string );
+
+      if ( &map == &m_header || &map == &m_trailer )
+        m_pGroupSessionDD = &dataDictionary;
+      else
+      {
+        m_pGroupApplicationDD = &dataDictionary;
+        m_groupMsgType = msg;
+      }
+      map.deferGroup( field.getTag(), count, begin, pos, this,
+                      &map == &m_header ? header
+                      : &map == &m_trailer ? trailer : body );
+      return ;
+    }
+    // decode it now so that errors are reported as they always are
+    pos = begin;
+  }
+  setGroup( msg, field, string, pos, map, dataDictionary, &m_groupArena );
+}
+
+bool Message::skipGroup( const std::string& msg, int group,
+                         const std::string& string, std::string::size_type& pos,
+                         const DataDictionary& dataDictionary, std::size_t& count )
+{
+  count = 0;
+  int delim;
+  const DataDictionary* pDD = 0;
+  if ( !dataDictionary.getGroup( msg, group, delim, pDD ) ) return true;
+
+  const char* const strStart = string.data();
+  const char* const strEnd = strStart + string.size();
+  // fields of the current instance start at base
+  const std::size_t base = m_scanned.size();
+
+  while ( pos < string.size() )
+  {
+    const char* const tagStart = strStart + pos;
+    const char* const equalSign = ByteScanner::find( tagStart, strEnd, '=' );
+    int field = 0;
+    if ( equalSign == strEnd || !ByteScanner::parseTag( tagStart, equalSign, field ) )
+      return false;
+
+    const char* const valueStart = equalSign + 1;
+    const char* soh = ByteScanner::findSoh( valueStart, strEnd );
+
+    if ( dataDictionary.isDataField( field ) )
+    {
+      // the length must be in the current instance, anything
+      // else is left for setGroup to resolve
+      int lenField = field == FIELD::Signature ? FIELD::SignatureLength : field - 1;
+      std::size_t i = m_scanned.size();
+      while ( i > base && m_scanned[ i - 1 ].tag != lenField ) --i;
+      signed_int length = 0;
+      if ( i == base
+           || !IntConvertor::convert( m_scanned[ i - 1 ].value, m_scanned[ i - 1 ].end, length )
+           || length < 0 )
+        return false;
+      soh = valueStart + length;
+    }
+    if ( soh >= strEnd ) return false;
+
+    bool isSet = false;
+    for ( std::size_t i = base; i < m_scanned.size() && !isSet; ++i )
+      isSet = m_scanned[ i ].tag == field;
+
+    // Start a new group because...
+    if ( field == delim || ( pDD->isField( field ) && ( count == 0 || isSet ) ) )
+    {
+      m_scanned.resize( base );
+      ++count;
+    }
+    else if ( !pDD->isField( field ) )
+    {
+      m_scanned.resize( base );
+      return true;
+    }
+
+    pos = soh + 1 - strStart;
+    ScannedField scanned = { field, valueStart, soh };
+    m_scanned.push_back( scanned );
+
+    std::size_t nested = 0;
+    if ( !skipGroup( msg, field, string, pos, *pDD, nested ) )
+      return false;
+  }
+
+  m_scanned.resize( base );
+  return true;
+}
+
+void Message::decodeGroup( FieldMap& map, int tag,
+                           std::string::size_type pos, int context ) const
+{
+  // building groups does not change what the message holds, only
+  // what has been decoded of it
+  Message& self = const_cast < Message& > ( *this );
+  const FieldBase& field = map.getFieldRef( tag );
+  // maps copied out of this message own the groups built into them
+  GroupArena* pArena =
+    ( &map == &m_header || &map == this || &map == &m_trailer )
+    ? &m_groupArena : 0;
+
+  if ( context == header )
+    self.setGroup( "_header_", field, m_groupSource, pos, map,
+                   *m_pGroupSessionDD, pArena );
+  else if ( context == trailer )
+    self.setGroup( "_trailer_", field, m_groupSource, pos, map,
+                   *m_pGroupSessionDD, pArena );
+  else
+    self.setGroup( m_groupMsgType, field, m_groupSource, pos, map,
+                   *m_pGroupApplicationDD, pArena );
+}
+
+void Message::copyDeferredGroups( const Message& rhs )
+{
+  if ( !m_header.hasDeferredGroups() && !FieldMap::hasDeferredGroups()
+       && !m_trailer.hasDeferredGroups() )
+    return;
+
+  m_groupSource = rhs.m_groupSource;
+  m_groupMsgType = rhs.m_groupMsgType;
+  m_pGroupSessionDD = rhs.m_pGroupSessionDD;
+  m_pGroupApplicationDD = rhs.m_pGroupApplicationDD;
+  adoptDeferredGroups();
+}
+
+void Message::adoptDeferredGroups()
+{
+  // deferred groups are decoded by the message holding them
+  if ( m_header.m_pDecoder ) m_header.m_pDecoder = this;
+  if ( m_pDecoder ) m_pDecoder = this;
+  if ( m_trailer.m_pDecoder ) m_trailer.m_pDecoder = this;
+}
+
 bool Message::setStringHeader( const std::string& string )
 {
   clear();
@@ -595,13 +978,18 @@ void Message::setSessionID( const SessionID& sessionID )
 }
 
 void Message::validate() const
+{
+  validate( bodyLength() + m_skippedLength,
+            ( checkSum() + m_skippedTotal ) % 256 );
+}
+
+void Message::validate( int actualLength, int actualChecksum ) const
 {
   try
   {
     const BodyLength& aBodyLength = FIELD_GET_REF( m_header, BodyLength );
 
     const int expectedLength = (int)aBodyLength;
-    const int actualLength = bodyLength();
 
     if ( expectedLength != actualLength )
     {
@@ -614,7 +1002,6 @@ void Message::validate() const
     const CheckSum& aCheckSum = FIELD_GET_REF( m_trailer, CheckSum );
 
     const int expectedChecksum = (int)aCheckSum;
-    const int actualChecksum = checkSum();
 
     if ( expectedChecksum != actualChecksum )
     {
@@ -638,22 +1025,23 @@ void Message::validate() const
 
 FIX::FieldBase Message::extractField( const std::string& string, std::string::size_type& pos, 
                                       const DataDictionary* pSessionDD /*= 0*/, const DataDictionary* pAppDD /*= 0*/, 
-                                      const Group* pGroup /*= 0*/ ) const
+                                      const FieldMap* pGroup /*= 0*/ ) const
 {
-  std::string::const_iterator const tagStart = string.begin() + pos;
-  std::string::const_iterator const strEnd = string.end();
+  const char* const strStart = string.data();
+  const char* const tagStart = strStart + pos;
+  const char* const strEnd = strStart + string.size();
 
-  std::string::const_iterator const equalSign = std::find( tagStart, strEnd, '=' );
+  const char* const equalSign = ByteScanner::find( tagStart, strEnd, '=' );
   if( equalSign == strEnd )
     throw InvalidMessage("Equal sign not found in field");
 
   int field = 0;
-  if( !IntConvertor::convert( tagStart, equalSign, field ) )
+  if( !ByteScanner::parseTag( tagStart, equalSign, field ) )
     throw InvalidMessage( std::string("Field tag is invalid: ") + std::string( tagStart, equalSign ));
 
-  std::string::const_iterator const valueStart = equalSign + 1;
+  const char* const valueStart = equalSign + 1;
 
-  std::string::const_iterator soh = std::find( valueStart, strEnd, '\001' );
+  const char* soh = ByteScanner::findSoh( valueStart, strEnd );
   if ( soh == strEnd )
     throw InvalidMessage("SOH not found at end of field");
 
@@ -691,12 +1079,11 @@ FIX::FieldBase Message::extractField( const std::string& string, std::string::si
     }
   }
 
-  std::string::const_iterator const tagEnd = soh + 1;
-#if defined(__SUNPRO_CC)
-  std::distance( string.begin(), tagEnd, pos );
-#else
-  pos = std::distance( string.begin(), tagEnd );
-#endif
+  if ( soh >= strEnd )
+    throw InvalidMessage("SOH not found at end of field");
+
+  const char* const tagEnd = soh + 1;
+  pos = tagEnd - strStart;
 
   return FieldBase (
     field,
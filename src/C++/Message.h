@@ -31,10 +31,20 @@
 #include "Group.h"
 #include "SessionID.h"
 #include "DataDictionary.h"
+#include "DecodeProfile.h"
+#include "HeaderPeek.h"
 #include "Values.h"
 #include <vector>
 #include <memory>
 
+/// Rank of an alphanumeric MsgType character in 0-9, A-Z, a-z
+#define FIX_MSGTYPE_RANK( c ) \
+  ( (c) <= '9' ? (c) - '0' : (c) <= 'Z' ? (c) - 'A' + 10 : (c) - 'a' + 36 )
+/// Integer id of the MsgType c1, or c1 c2 if c2 is not zero
+#define FIX_MSGTYPE_ID( c1, c2 ) \
+  ( (c2) == 0 ? 1 + FIX_MSGTYPE_RANK( c1 ) \
+              : 63 + FIX_MSGTYPE_RANK( c1 ) * 62 + FIX_MSGTYPE_RANK( c2 ) )
+
 namespace FIX
 {
 
@@ -71,6 +81,15 @@ public:
   bool hasGroup( unsigned num, const FIX::Group& group ) const
   { return FieldMap::hasGroup( num, group.field() ); }
 
+#ifdef HAVE_RVALUE_REFERENCES
+  void addGroup( FIX::Group&& group )
+  { FieldMap::addGroup( group.field(), std::move( group ) ); }
+
+protected:
+  friend class Message;
+  Header( Header&& rhs, bool movePooled ) : FieldMap( std::move( rhs ), movePooled )
+  {}
+#endif
 };
 
 class Trailer : public FieldMap
@@ -106,6 +125,15 @@ public:
   bool hasGroup( unsigned num, const FIX::Group& group ) const
   { return FieldMap::hasGroup( num, group.field() ); }
 
+#ifdef HAVE_RVALUE_REFERENCES
+  void addGroup( FIX::Group&& group )
+  { FieldMap::addGroup( group.field(), std::move( group ) ); }
+
+protected:
+  friend class Message;
+  Trailer( Trailer&& rhs, bool movePooled ) : FieldMap( std::move( rhs ), movePooled )
+  {}
+#endif
 };
 
 /**
@@ -114,14 +142,31 @@ public:
  * A message consists of three field maps.  One for the header, the body,
  * and the trailer.
  */
-class Message : public FieldMap
+class Message : public FieldMap, private GroupDecoder
 {
   friend class DataDictionary;
   friend class Session;
+  friend class HeaderTemplate;
+  friend class FastDecoder;
 
   enum field_type { header, body, trailer };
 
 public:
+  /// Integer ids of FIX versions, the application ones equal their ApplVerID
+  enum Version
+  {
+    VERSION_UNKNOWN = 0,
+    VERSION_FIX40 = 2,
+    VERSION_FIX41,
+    VERSION_FIX42,
+    VERSION_FIX43,
+    VERSION_FIX44,
+    VERSION_FIX50,
+    VERSION_FIX50SP1,
+    VERSION_FIX50SP2,
+    VERSION_FIXT11
+  };
+
   Message();
 
   /// Construct message with a specified order of fields
@@ -155,11 +200,23 @@ public:
 
   ~Message();
 
+  Message& operator=( const Message& rhs );
+
+#ifdef HAVE_RVALUE_REFERENCES
+  /// Take the fields, groups and decoding state of rhs, leaving it empty
+  Message( Message&& rhs );
+  Message& operator=( Message&& rhs );
+#endif
+
   /// Set global data dictionary for encoding messages into XML
   static bool InitializeXML( const std::string& string );
 
   void addGroup( const FIX::Group& group )
   { FieldMap::addGroup( group.field(), group ); }
+#ifdef HAVE_RVALUE_REFERENCES
+  void addGroup( FIX::Group&& group )
+  { FieldMap::addGroup( group.field(), std::move( group ) ); }
+#endif
 
   void replaceGroup( unsigned num, const FIX::Group& group )
   { FieldMap::replaceGroup( num, group.field(), group ); }
@@ -230,9 +287,41 @@ public:
                   const FIX::DataDictionary* pApplicationDataDictionary )
   EXCEPT ( InvalidMessage );
 
+  /// Decode the instances of a group, taking them from pArena if given
   void setGroup( const std::string& msg, const FieldBase& field,
                  const std::string& string, std::string::size_type& pos,
-                 FieldMap& map, const DataDictionary& dataDictionary );
+                 FieldMap& map, const DataDictionary& dataDictionary,
+                 GroupArena* pArena = 0 );
+
+  /**
+   * Defer building repeating groups until they are accessed.
+   *
+   * When set, setString only scans the instances of each top level group
+   * and records where they are.  The instances are built the first time
+   * the groups of the header, body or trailer holding them are accessed.
+   * The message keeps a copy of the string and pointers to the data
+   * dictionaries it was decoded with, so the dictionaries must outlive
+   * it.  Required fields inside deferred groups are not validated.
+   */
+  void setLazyGroups( bool value ) { m_lazyGroups = value; }
+  bool getLazyGroups() const { return m_lazyGroups; }
+
+  /**
+   * Only decode the body fields a profile names for the message type.
+   *
+   * Skipped fields and groups are not added to the message, but their
+   * length and checksum are kept so that setString can still validate
+   * BodyLength and CheckSum.  Their tags are recorded so that required
+   * fields that were skipped still count as present.  The profile must
+   * outlive the message and is not passed on to copies of it.
+   */
+  void setDecodeProfile( const DecodeProfile* pProfile )
+  { m_pDecodeProfile = pProfile; }
+  const DecodeProfile* getDecodeProfile() const { return m_pDecodeProfile; }
+  /// Check if decoding skipped any body fields
+  bool hasSkippedFields() const { return m_skippedLength != 0; }
+  /// Sorted tags of the body fields decoding skipped
+  const std::vector < int >& getSkippedFields() const { return m_skippedFields; }
 
   /**
    * Set a messages header from a string
@@ -285,6 +374,14 @@ public:
     return false;
   }
 
+  /// Integer id of the MsgType in the header, zero if it has none
+  int getMsgTypeId() const
+  {
+    if( !m_header.isSetField( FIELD::MsgType ) )
+      return 0;
+    return msgTypeId( m_header.getField( FIELD::MsgType ) );
+  }
+
   bool isEmpty()
   { return m_header.isEmpty() && FieldMap::isEmpty() && m_trailer.isEmpty(); }
 
@@ -295,6 +392,10 @@ public:
     m_header.clear();
     FieldMap::clear();
     m_trailer.clear();
+    m_groupArena.reset();
+    m_skippedLength = 0;
+    m_skippedTotal = 0;
+    m_skippedFields.clear();
   }
 
   static bool isAdminMsgType( const MsgType& msgType )
@@ -304,6 +405,61 @@ public:
              msgType.getValue().c_str() [ 0 ] ) != 0;
   }
 
+  /**
+   * Integer id of a MsgType, as given by FIX_MSGTYPE_ID.
+   *
+   * Every MsgType of one or two alphanumeric characters has its own id
+   * between 1 and 3906, any other value has the id zero.
+   */
+  static int msgTypeId( const char* value, std::size_t length )
+  {
+    if( length == 0 || length > 2 || !isMsgTypeChar( value[0] ) )
+      return 0;
+    if( length == 1 )
+      return FIX_MSGTYPE_ID( value[0], 0 );
+    if( !isMsgTypeChar( value[1] ) )
+      return 0;
+    return FIX_MSGTYPE_ID( value[0], value[1] );
+  }
+
+  static int msgTypeId( const std::string& msgType )
+  { return msgTypeId( msgType.data(), msgType.size() ); }
+
+  static bool isAdminMsgTypeId( int msgTypeId )
+  {
+    return ( msgTypeId >= MsgTypeId_Heartbeat && msgTypeId <= MsgTypeId_Logout )
+           || msgTypeId == MsgTypeId_Logon;
+  }
+
+  /// Version id of a BeginString, VERSION_UNKNOWN if it is not known
+  static int versionId( const BeginString& beginString )
+  {
+    const std::string& value = beginString.getValue();
+    if( value == BeginString_FIXT11 )
+      return VERSION_FIXT11;
+    if( value.size() < 7 || value.compare( 0, 4, "FIX." ) != 0
+        || value[5] != '.' )
+      return VERSION_UNKNOWN;
+    if( value.size() == 7 && value[4] == '4' && value[6] >= '0' && value[6] <= '4' )
+      return VERSION_FIX40 + ( value[6] - '0' );
+    if( value == BeginString_FIX50 )
+      return VERSION_FIX50;
+    if( value == "FIX.5.0SP1" )
+      return VERSION_FIX50SP1;
+    if( value == "FIX.5.0SP2" )
+      return VERSION_FIX50SP2;
+    return VERSION_UNKNOWN;
+  }
+
+  /// Version id of an ApplVerID, VERSION_UNKNOWN if it is not known
+  static int versionId( const ApplVerID& applVerID )
+  {
+    const std::string& value = applVerID.getValue();
+    if( value.size() != 1 || value[0] < '2' || value[0] > '9' )
+      return VERSION_UNKNOWN;
+    return value[0] - '0';
+  }
+
   static ApplVerID toApplVerID(const BeginString& value)
   {
     if( value == BeginString_FIX40 )
@@ -371,10 +527,16 @@ public:
 #endif
 
 private:
+  static bool isMsgTypeChar( char c )
+  {
+    return ( c >= '0' && c <= '9' ) || ( c >= 'A' && c <= 'Z' )
+           || ( c >= 'a' && c <= 'z' );
+  }
+
   FieldBase extractField(
     const std::string& string, std::string::size_type& pos,
     const DataDictionary* pSessionDD = 0, const DataDictionary* pAppDD = 0,
-    const Group* pGroup = 0) const;
+    const FieldMap* pGroup = 0) const;
 
   static bool IsDataField(
     int field,
@@ -390,7 +552,41 @@ private:
     return false;
   }
 
+  /// Decode a group, or only scan it and defer decoding when lazy
+  void setOrDeferGroup( const std::string& msg, const FieldBase& field,
+                        const std::string& string, std::string::size_type& pos,
+                        FieldMap& map, const DataDictionary& dataDictionary );
+  /// Skip a body field, with its groups, unless the profile wants it
+  bool skipField( const std::string& string, std::string::size_type& pos,
+                  const DecodeProfile::Fields& wanted, const std::string& msg,
+                  field_type& type, const DataDictionary* pSessionDD,
+                  const DataDictionary* pAppDD );
+  /// Walk the instances of a group the way setGroup does without building them
+  bool skipGroup( const std::string& msg, int group,
+                  const std::string& string, std::string::size_type& pos,
+                  const DataDictionary& dataDictionary, std::size_t& count );
+
+  const std::string& groupSource() const { return m_groupSource; }
+  void decodeGroup( FieldMap& map, int tag, std::string::size_type pos,
+                    int context ) const;
+  /// Copy the deferred groups of rhs along with what they are decoded from
+  void copyDeferredGroups( const Message& rhs );
+  /// Have the deferred groups of this message decoded by it
+  void adoptDeferredGroups();
+#ifdef HAVE_RVALUE_REFERENCES
+  /// Take the decoding state of rhs once its maps and groups have moved
+  void takeState( Message& rhs );
+#endif
+
   void validate() const;
+  void validate( int actualLength, int actualChecksum ) const;
+  /// Digits to reserve for the BodyLength placeholder
+  int lengthWidth( int bodyLengthField ) const;
+  /// Append body and trailer after a serialized header, then patch in BodyLength and add CheckSum
+  std::string& finishString( std::string& str, int total,
+                             std::string::size_type lengthPosition, int width,
+                             int beginStringLength, int bodyLengthField,
+                             int checkSumField ) const;
   std::string toXMLFields(const FieldMap& fields, int space) const;
 
 protected:
@@ -398,6 +594,27 @@ protected:
   mutable Trailer m_trailer;
   bool m_validStructure;
   int m_tag;
+  // groups decoded by setString, released when the message is cleared
+  mutable GroupArena m_groupArena;
+  bool m_lazyGroups;
+  // what deferred groups are decoded from
+  std::string m_groupSource;
+  std::string m_groupMsgType;
+  const DataDictionary* m_pGroupSessionDD;
+  const DataDictionary* m_pGroupApplicationDD;
+  // fields of the group instances being skipped by skipGroup
+  struct ScannedField
+  {
+    int tag;
+    const char* value;
+    const char* end;
+  };
+  std::vector < ScannedField > m_scanned;
+  const DecodeProfile* m_pDecodeProfile;
+  // length and byte sum of the fields skipped by setString
+  int m_skippedLength;
+  int m_skippedTotal;
+  std::vector < int > m_skippedFields;
 #ifdef HAVE_EMX
   std::string m_subMsgType;
 #endif
@@ -417,15 +634,12 @@ inline std::ostream& operator <<
 inline MsgType identifyType( const std::string& message )
 EXCEPT ( MessageParseError )
 {
-  std::string::size_type pos = message.find( "\001" "35=" );
-  if ( pos == std::string::npos ) throw MessageParseError();
-
-  std::string::size_type startValue = pos + 4;
-  std::string::size_type soh = message.find_first_of( '\001', startValue );
-  if ( soh == std::string::npos ) throw MessageParseError();
+  const char* value = 0;
+  std::size_t length = 0;
+  if ( !HeaderPeek( message ).getValue( FIELD::MsgType, value, length ) )
+    throw MessageParseError();
 
-  std::string value = message.substr( startValue, soh - startValue );
-  return MsgType( value );
+  return MsgType( std::string( value, length ) );
 }
 }
 
@@ -65,18 +65,24 @@ public:
               const SessionID& sessionID,
               const BeginString& beginString )
   {
-    if ( beginString == BeginString_FIX40 )
+    switch( Message::versionId( beginString ) )
+    {
+    case Message::VERSION_FIX40:
       ((FIX40::MessageCracker&)(*this)).crack((const FIX40::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX41 )
+      break;
+    case Message::VERSION_FIX41:
       ((FIX41::MessageCracker&)(*this)).crack((const FIX41::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX42 )
+      break;
+    case Message::VERSION_FIX42:
       ((FIX42::MessageCracker&)(*this)).crack((const FIX42::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX43 )
+      break;
+    case Message::VERSION_FIX43:
       ((FIX43::MessageCracker&)(*this)).crack((const FIX43::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX44 )
+      break;
+    case Message::VERSION_FIX44:
       ((FIX44::MessageCracker&)(*this)).crack((const FIX44::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIXT11 )
-    {
+      break;
+    case Message::VERSION_FIXT11:
       if( message.isAdmin() )
       {
         ((FIXT11::MessageCracker&)(*this)).crack((const FIXT11::Message&) message, sessionID);
@@ -92,6 +98,7 @@ public:
 
         crack( message, sessionID, applVerID );
       }
+      break;
     }
   }
 
@@ -99,22 +106,33 @@ public:
               const SessionID& sessionID,
               const ApplVerID& applVerID )
   {
-    if ( applVerID == ApplVerID_FIX40 )
+    switch( Message::versionId( applVerID ) )
+    {
+    case Message::VERSION_FIX40:
       ((FIX40::MessageCracker&)(*this)).crack((const FIX40::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX41 )
+      break;
+    case Message::VERSION_FIX41:
       ((FIX41::MessageCracker&)(*this)).crack((const FIX41::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX42 )
+      break;
+    case Message::VERSION_FIX42:
       ((FIX42::MessageCracker&)(*this)).crack((const FIX42::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX43 )
+      break;
+    case Message::VERSION_FIX43:
       ((FIX43::MessageCracker&)(*this)).crack((const FIX43::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX44 )
+      break;
+    case Message::VERSION_FIX44:
       ((FIX44::MessageCracker&)(*this)).crack((const FIX44::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX50 )
+      break;
+    case Message::VERSION_FIX50:
       ((FIX50::MessageCracker&)(*this)).crack((const FIX50::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX50SP1 )
+      break;
+    case Message::VERSION_FIX50SP1:
       ((FIX50SP1::MessageCracker&)(*this)).crack((const FIX50SP1::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX50SP2 )
+      break;
+    case Message::VERSION_FIX50SP2:
       ((FIX50SP2::MessageCracker&)(*this)).crack((const FIX50SP2::Message&) message, sessionID);
+      break;
+    }
   }
 
   void crack( Message& message,
@@ -130,18 +148,24 @@ public:
               const SessionID& sessionID,
               const BeginString& beginString )
   {
-    if ( beginString == BeginString_FIX40 )
+    switch( Message::versionId( beginString ) )
+    {
+    case Message::VERSION_FIX40:
       ((FIX40::MessageCracker&)(*this)).crack((FIX40::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX41 )
+      break;
+    case Message::VERSION_FIX41:
       ((FIX41::MessageCracker&)(*this)).crack((FIX41::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX42 )
+      break;
+    case Message::VERSION_FIX42:
       ((FIX42::MessageCracker&)(*this)).crack((FIX42::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX43 )
+      break;
+    case Message::VERSION_FIX43:
       ((FIX43::MessageCracker&)(*this)).crack((FIX43::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIX44 )
+      break;
+    case Message::VERSION_FIX44:
       ((FIX44::MessageCracker&)(*this)).crack((FIX44::Message&) message, sessionID);
-    else if ( beginString == BeginString_FIXT11 )
-    {
+      break;
+    case Message::VERSION_FIXT11:
       if( message.isAdmin() )
       {
         ((FIXT11::MessageCracker&)(*this)).crack((FIXT11::Message&) message, sessionID);
@@ -157,6 +181,7 @@ public:
 
         crack( message, sessionID, applVerID );
       }
+      break;
     }
   }
 
@@ -164,24 +189,34 @@ public:
               const SessionID& sessionID,
               const ApplVerID& applVerID )
   {
-    if ( applVerID == ApplVerID_FIX40 )
+    switch( Message::versionId( applVerID ) )
+    {
+    case Message::VERSION_FIX40:
       ((FIX40::MessageCracker&)(*this)).crack((FIX40::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX41 )
+      break;
+    case Message::VERSION_FIX41:
       ((FIX41::MessageCracker&)(*this)).crack((FIX41::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX42 )
+      break;
+    case Message::VERSION_FIX42:
       ((FIX42::MessageCracker&)(*this)).crack((FIX42::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX43 )
+      break;
+    case Message::VERSION_FIX43:
       ((FIX43::MessageCracker&)(*this)).crack((FIX43::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX44 )
+      break;
+    case Message::VERSION_FIX44:
       ((FIX44::MessageCracker&)(*this)).crack((FIX44::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX50 )
+      break;
+    case Message::VERSION_FIX50:
       ((FIX50::MessageCracker&)(*this)).crack((FIX50::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX50SP1 )
+      break;
+    case Message::VERSION_FIX50SP1:
       ((FIX50SP1::MessageCracker&)(*this)).crack((FIX50SP1::Message&) message, sessionID);
-    if ( applVerID == ApplVerID_FIX50SP2 )
+      break;
+    case Message::VERSION_FIX50SP2:
       ((FIX50SP2::MessageCracker&)(*this)).crack((FIX50SP2::Message&) message, sessionID);
+      break;
+    }
   }
-
 };
 }
 
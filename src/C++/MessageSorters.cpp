@@ -30,7 +30,7 @@
 namespace FIX
 {
 message_order::message_order( int first, ... )
-: m_mode( group ), m_delim( 0 ), m_largest( 0 )
+: m_mode( group ), m_delim( 0 ), m_largest( 0 ), m_table( 0 ), m_size( 0 )
 {
   int field = first;
   int size = 0;
@@ -69,7 +69,7 @@ message_order::message_order( int first, ... )
 }
 
 message_order::message_order( const int order[] )
-: m_mode( group ), m_delim( 0 ), m_largest( 0 )
+: m_mode( group ), m_delim( 0 ), m_largest( 0 ), m_table( 0 ), m_size( 0 )
 {
   int size = 0;
   while( order[size] != 0 ) { ++size; }
@@ -82,6 +82,8 @@ message_order& message_order::operator=( const message_order& rhs )
   m_delim = rhs.m_delim;
   m_largest = rhs.m_largest;
   m_groupOrder = rhs.m_groupOrder;
+  m_table = rhs.m_table;
+  m_size = rhs.m_size;
 
   return *this;
 }
@@ -102,6 +102,59 @@ struct group_order
   }
 };
 
+/// Sorts fields in group order using a static table sorted by field
+struct static_group_order
+{
+  struct field_position
+  {
+    int field;
+    int position;
+  };
+
+  static bool compare( const int x, const int y,
+                       const field_position* table, int size )
+  {
+    int largest = table[ size - 1 ].field;
+    if ( x <= largest && y <= largest )
+    {
+      int iX = getPosition( x, table, size );
+      int iY = getPosition( y, table, size );
+      if ( iX == 0 && iY == 0 )
+        return x < y;
+      else if ( iX == 0 )
+        return false;
+      else if ( iY == 0 )
+        return true;
+      else
+        return iX < iY;
+    }
+    else if ( x <= largest ) return true;
+    else if ( y <= largest ) return false;
+    else return x < y;
+  }
+
+  static int getPosition( const int field, const field_position* table, int size )
+  {
+    // most groups only have a few fields
+    if ( size <= 8 )
+    {
+      for ( int i = 0; i < size; ++i )
+        if ( table[ i ].field == field ) return table[ i ].position;
+      return 0;
+    }
+
+    int low = 0;
+    int high = size;
+    while ( low < high )
+    {
+      int middle = ( low + high ) / 2;
+      if ( table[ middle ].field < field ) low = middle + 1;
+      else high = middle;
+    }
+    return low < size && table[ low ].field == field ? table[ low ].position : 0;
+  }
+};
+
 typedef std::less < int > normal_order;
 
 /**
@@ -113,12 +166,21 @@ typedef std::less < int > normal_order;
 struct message_order
 {
 public:
-  enum cmp_mode { header, trailer, normal, group };
+  enum cmp_mode { header, trailer, normal, group, static_group };
+  typedef static_group_order::field_position field_position;
 
   message_order( cmp_mode mode = normal ) 
-    : m_mode( mode ), m_delim( 0 ), m_largest( 0 ) {}
+    : m_mode( mode ), m_delim( 0 ), m_largest( 0 ), m_table( 0 ), m_size( 0 ) {}
   message_order( int first, ... );
   message_order( const int order[] );
+  /**
+   * Group order read from a table in static storage, sorted by field.
+   * The table is referenced rather than copied, so creating and copying
+   * the order neither allocates nor touches a reference count.
+   */
+  message_order( const field_position table[], int size )
+    : m_mode( size ? static_group : normal ), m_delim( 0 ), m_largest( 0 ),
+      m_table( table ), m_size( size ) {}
   message_order( const message_order& copy ) 
   { *this = copy; }
 
@@ -132,6 +194,8 @@ public:
       return trailer_order::compare( x, y );
       case group:
       return group_order::compare( x, y, m_groupOrder, m_largest );
+      case static_group:
+      return static_group_order::compare( x, y, m_table, m_size );
       case normal: default:
       return x < y;
     }
@@ -140,7 +204,7 @@ public:
   message_order& operator=( const message_order& rhs );
 
   operator bool() const
-  { return !m_groupOrder.empty(); }
+  { return !m_groupOrder.empty() || m_table != 0; }
 
 private:
   void setOrder( int size, const int order[] );
@@ -149,6 +213,8 @@ private:
   int m_delim;
   shared_array<int> m_groupOrder;
   int m_largest;
+  const field_position* m_table;
+  int m_size;
 };
 }
 
@@ -27,6 +27,17 @@
 
 namespace FIX
 {
+bool MessageStore::setBatch( int msgSeqNum,
+                             const std::vector < std::string > & messages )
+EXCEPT ( IOException )
+{
+  bool result = true;
+  std::vector < std::string > ::const_iterator i;
+  for ( i = messages.begin(); i != messages.end(); ++i )
+    result = set( msgSeqNum++, *i ) && result;
+  return result;
+}
+
 MessageStore* MemoryStoreFactory::create( const SessionID& )
 {
   return new MemoryStore();
@@ -73,6 +84,13 @@ bool MessageStoreExceptionWrapper::set( int num, const std::string& msg, bool& t
   catch ( IOException & e ) { threw = true; ex = e; return false; }
 }
 
+bool MessageStoreExceptionWrapper::setBatch( int num, const std::vector < std::string > & msgs, bool& threw, IOException& ex )
+{
+  threw = false;
+  try { return m_pStore->setBatch( num, msgs ); }
+  catch ( IOException & e ) { threw = true; ex = e; return false; }
+}
+
 void MessageStoreExceptionWrapper::get( int begin, int end, std::vector < std::string > & msgs, bool& threw, IOException& ex ) const
 {
   threw = false;
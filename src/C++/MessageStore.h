@@ -70,6 +70,13 @@ public:
 
   virtual bool set( int, const std::string& )
   EXCEPT ( IOException ) = 0;
+  /**
+   * Store messages with consecutive sequence numbers, the first of
+   * them with msgSeqNum.  Stores that can write them together should
+   * override this, by default each message is stored with set.
+   */
+  virtual bool setBatch( int msgSeqNum, const std::vector < std::string > & messages )
+  EXCEPT ( IOException );
   virtual void get( int, int, std::vector < std::string > & ) const
   EXCEPT ( IOException ) = 0;
 
@@ -156,6 +163,7 @@ public:
   ~MessageStoreExceptionWrapper() { delete m_pStore; }
 
   bool set( int, const std::string&, bool&, IOException& );
+  bool setBatch( int, const std::vector < std::string > &, bool&, IOException& );
   void get( int, int, std::vector < std::string > &, bool&, IOException& ) const;
   int getNextSenderMsgSeqNum( bool&, IOException& ) const;
   int getNextTargetMsgSeqNum( bool&, IOException& ) const;
@@ -0,0 +1,331 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "MessageView.h"
+#include "ByteScanner.h"
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+namespace FIX
+{
+FieldMapView::iterator FieldMapView::find( int tag ) const
+{
+  Index::const_iterator i =
+    std::lower_bound( m_index.begin(), m_index.end(), tag, tag_position::before );
+  if ( i == m_index.end() || i->tag != tag )
+    return m_locations.end();
+  return m_locations.begin() + i->position;
+}
+
+void FieldMapView::buildIndex()
+{
+  m_index.resize( m_locations.size() );
+  for ( std::size_t i = 0; i < m_locations.size(); ++i )
+  {
+    m_index[ i ].tag = m_locations[ i ].tag;
+    m_index[ i ].position = i;
+  }
+  std::sort( m_index.begin(), m_index.end() );
+}
+
+bool FieldMapView::getFieldIfSet( FieldBase& field ) const
+{
+  iterator i = find( field.getTag() );
+  if ( i == m_locations.end() )
+    return false;
+  field.setString( std::string( valueOf( *i ), i->length ) );
+  return true;
+}
+
+std::string FieldMapView::getField( int tag ) const
+EXCEPT ( FieldNotFound )
+{
+  iterator i = find( tag );
+  if ( i == m_locations.end() )
+    throw FieldNotFound( tag );
+  return std::string( valueOf( *i ), i->length );
+}
+
+bool FieldMapView::getValue( int tag, const char*& value, std::size_t& length ) const
+{
+  iterator i = find( tag );
+  if ( i == m_locations.end() )
+    return false;
+  value = valueOf( *i );
+  length = i->length;
+  return true;
+}
+
+MessageView::MessageView()
+: m_length( 0 ), m_checkSumOffset( 0 ), m_validStructure( true ), m_headerOrdered( true ), m_tag( 0 ),
+  m_pSessionDD( 0 ), m_pAppDD( 0 )
+{
+}
+
+MessageView::MessageView( const std::string& string,
+                          const DataDictionary* pSessionDataDictionary,
+                          const DataDictionary* pApplicationDataDictionary )
+EXCEPT ( InvalidMessage )
+: m_length( 0 ), m_checkSumOffset( 0 ), m_validStructure( true ), m_headerOrdered( true ), m_tag( 0 ),
+  m_pSessionDD( 0 ), m_pAppDD( 0 )
+{
+  setString( string, pSessionDataDictionary, pApplicationDataDictionary );
+}
+
+MessageView::MessageView( const char* data, std::size_t length,
+                          const DataDictionary* pSessionDataDictionary,
+                          const DataDictionary* pApplicationDataDictionary )
+EXCEPT ( InvalidMessage )
+: m_length( 0 ), m_checkSumOffset( 0 ), m_validStructure( true ), m_headerOrdered( true ), m_tag( 0 ),
+  m_pSessionDD( 0 ), m_pAppDD( 0 )
+{
+  setString( data, length, pSessionDataDictionary, pApplicationDataDictionary );
+}
+
+void MessageView::setString( const char* data, std::size_t length,
+                             const DataDictionary* pSessionDataDictionary,
+                             const DataDictionary* pApplicationDataDictionary )
+EXCEPT ( InvalidMessage )
+{
+  static const int headerOrder[] =
+  { FIELD::BeginString, FIELD::BodyLength, FIELD::MsgType };
+
+  clear( data );
+  m_header.clear( data );
+  m_trailer.clear( data );
+  m_length = length;
+  m_checkSumOffset = length;
+  m_validStructure = true;
+  m_headerOrdered = true;
+  m_tag = 0;
+  m_pSessionDD = pSessionDataDictionary;
+  m_pAppDD = pApplicationDataDictionary;
+
+  const char* const end = data + length;
+  const char* tagStart = data;
+  const DataDictionary* pHeaderGroupDD = 0;
+  int count = 0;
+  field_type type = header;
+
+  while ( tagStart < end )
+  {
+    const char* const equalSign = ByteScanner::find( tagStart, end, '=' );
+    if ( equalSign == end )
+      throw InvalidMessage( "Equal sign not found in field" );
+
+    int field = 0;
+    if ( !ByteScanner::parseTag( tagStart, equalSign, field ) )
+      throw InvalidMessage( std::string( "Field tag is invalid: " ) + std::string( tagStart, equalSign ) );
+
+    if ( count < 3 && headerOrder[ count++ ] != field )
+      m_headerOrdered = false;
+
+    const char* const valueStart = equalSign + 1;
+    const char* soh = 0;
+
+    const bool isHeader = Message::isHeaderField( field, m_pSessionDD )
+      || ( pHeaderGroupDD && type == header && pHeaderGroupDD->isField( field ) );
+    const bool isTrailer = !isHeader && Message::isTrailerField( field, m_pSessionDD );
+
+    if ( ( m_pSessionDD && m_pSessionDD->isDataField( field ) )
+         || ( m_pAppDD && m_pAppDD != m_pSessionDD && m_pAppDD->isDataField( field ) ) )
+    {
+      soh = valueStart + lengthOfData( field );
+      if ( soh >= end || *soh != '\001' )
+        throw InvalidMessage( "SOH not found at end of field" );
+    }
+    else
+    {
+      soh = ByteScanner::findSoh( valueStart, end );
+      if ( soh == end )
+        throw InvalidMessage( "SOH not found at end of field" );
+    }
+
+    field_location location( field, valueStart - data, soh - valueStart );
+
+    if ( isHeader )
+    {
+      if ( type != header )
+      {
+        if ( m_tag == 0 ) m_tag = field;
+        m_validStructure = false;
+      }
+      m_header.m_locations.push_back( location );
+
+      int delim;
+      const DataDictionary* pDD = 0;
+      if ( m_pSessionDD && m_pSessionDD->getGroup( "_header_", field, delim, pDD ) )
+        pHeaderGroupDD = pDD;
+    }
+    else if ( isTrailer )
+    {
+      if ( field == FIELD::CheckSum && m_checkSumOffset == m_length )
+        m_checkSumOffset = tagStart - data;
+      type = trailer;
+      m_trailer.m_locations.push_back( location );
+    }
+    else
+    {
+      if ( type == trailer )
+      {
+        if ( m_tag == 0 ) m_tag = field;
+        m_validStructure = false;
+      }
+      type = body;
+      m_locations.push_back( location );
+    }
+
+    tagStart = soh + 1;
+  }
+
+  buildIndex();
+  m_header.buildIndex();
+  m_trailer.buildIndex();
+}
+
+std::size_t MessageView::lengthOfData( int field ) const
+EXCEPT ( InvalidMessage )
+{
+  // Assume length field is 1 less.
+  int lenField = field - 1;
+  // Special case for Signature which violates above assumption.
+  if ( field == FIELD::Signature ) lenField = FIELD::SignatureLength;
+
+  // identify part of the message that should contain length field
+  const Locations& locations =
+    Message::isHeaderField( lenField, m_pSessionDD ) ? m_header.m_locations
+    : Message::isTrailerField( lenField, m_pSessionDD ) ? m_trailer.m_locations
+    : m_locations;
+
+  for ( Locations::const_reverse_iterator i = locations.rbegin(); i != locations.rend(); ++i )
+  {
+    if ( i->tag != lenField )
+      continue;
+
+    int length = 0;
+    if ( !IntConvertor::convert( valueOf( *i ), valueOf( *i ) + i->length, length ) || length < 0 )
+    {
+      throw InvalidMessage( std::string( "Unable to determine SOH for data field " )
+                            + IntConvertor::convert( field ) );
+    }
+    return length;
+  }
+
+  throw InvalidMessage( std::string( "Data length field " ) + IntConvertor::convert( lenField ) + std::string( " was not found for data field " ) + IntConvertor::convert( field ) );
+}
+
+bool MessageView::isAdmin() const
+{
+  const char* value = 0;
+  std::size_t length = 0;
+  if ( !m_header.getValue( FIELD::MsgType, value, length ) )
+    return false;
+  return length == 1 && std::strchr( "0A12345", *value ) != 0;
+}
+
+bool MessageView::isApp() const
+{
+  return m_header.isSetField( FIELD::MsgType ) && !isAdmin();
+}
+
+int MessageView::getMsgTypeId() const
+{
+  const char* value = 0;
+  std::size_t length = 0;
+  if ( !m_header.getValue( FIELD::MsgType, value, length ) )
+    return 0;
+  return Message::msgTypeId( value, length );
+}
+
+int MessageView::bodyLength() const
+{
+  iterator bodyLength = m_header.find( FIELD::BodyLength );
+  if ( bodyLength == m_header.end() )
+    return 0;
+  const std::size_t start = bodyLength->offset + bodyLength->length + 1;
+  return start < m_checkSumOffset ? (int)( m_checkSumOffset - start ) : 0;
+}
+
+int MessageView::checkSum() const
+{
+  return ByteScanner::checkSum( m_data, m_data + m_checkSumOffset );
+}
+
+void MessageView::validate() const
+EXCEPT ( InvalidMessage )
+{
+  if ( !m_headerOrdered )
+    throw InvalidMessage( "Header fields out of order" );
+
+  BodyLength aBodyLength;
+  CheckSum aCheckSum;
+
+  try
+  {
+    m_header.getField( aBodyLength );
+
+    const int expectedLength = (int)aBodyLength;
+    const int actualLength = bodyLength();
+
+    if ( expectedLength != actualLength )
+    {
+      std::stringstream text;
+      text << "Expected BodyLength=" << actualLength
+           << ", Received BodyLength=" << expectedLength;
+      throw InvalidMessage(text.str());
+    }
+
+    m_trailer.getField( aCheckSum );
+
+    const int expectedChecksum = (int)aCheckSum;
+    const int actualChecksum = checkSum();
+
+    if ( expectedChecksum != actualChecksum )
+    {
+      std::stringstream text;
+      text << "Expected CheckSum=" << actualChecksum
+           << ", Received CheckSum=" << expectedChecksum;
+      throw InvalidMessage(text.str());
+    }
+  }
+  catch ( FieldNotFound& e )
+  {
+    const std::string fieldName = ( e.field == FIX::FIELD::BodyLength ) ? "BodyLength" : "CheckSum";
+    throw InvalidMessage( fieldName + std::string(" is missing") );
+  }
+  catch ( IncorrectDataFormat& e )
+  {
+    const std::string fieldName = ( e.field == FIX::FIELD::BodyLength ) ? "BodyLength" : "CheckSum";
+    throw InvalidMessage( fieldName + std::string(" has wrong format: ") + e.detail );
+  }
+}
+
+void MessageView::toMessage( Message& message, bool validate ) const
+EXCEPT ( InvalidMessage )
+{
+  message.setString( toString(), validate, m_pSessionDD, m_pAppDD );
+}
+}
@@ -0,0 +1,217 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_MESSAGEVIEW
+#define FIX_MESSAGEVIEW
+
+#ifdef _MSC_VER
+#pragma warning( disable: 4786 )
+#endif
+
+#include "Message.h"
+#include <vector>
+
+namespace FIX
+{
+/**
+ * Read-only index of the fields in one section of a raw FIX message.
+ *
+ * Each field is stored as the tag number plus the offset and length of
+ * its value inside the original buffer.  Values are only converted into
+ * field objects when they are asked for.  Lookups by tag go through an
+ * index sorted by tag that is built once the section has been parsed.
+ */
+class FieldMapView
+{
+public:
+  struct field_location
+  {
+    field_location( int t, std::size_t o, std::size_t l )
+    : tag( t ), offset( o ), length( l ) {}
+
+    int tag;
+    std::size_t offset;
+    std::size_t length;
+  };
+
+  typedef std::vector < field_location > Locations;
+  typedef Locations::const_iterator iterator;
+
+  FieldMapView() : m_data( 0 ) {}
+
+  /// Get a field if set
+  bool getFieldIfSet( FieldBase& field ) const;
+
+  /// Get a field without type checking
+  FieldBase& getField( FieldBase& field ) const
+  EXCEPT ( FieldNotFound )
+  {
+    if ( !getFieldIfSet( field ) )
+      throw FieldNotFound( field.getTag() );
+    return field;
+  }
+
+  /// Get a field without a field class
+  std::string getField( int tag ) const
+  EXCEPT ( FieldNotFound );
+
+  /// Get a pointer to the raw value of a field without copying it
+  bool getValue( int tag, const char*& value, std::size_t& length ) const;
+
+  /// Check to see if a field is set
+  bool isSetField( const FieldBase& field ) const
+  { return isSetField( field.getTag() ); }
+  /// Check to see if a field is set by referencing its number
+  bool isSetField( int tag ) const
+  { return find( tag ) != m_locations.end(); }
+
+  bool isEmpty() const { return m_locations.empty(); }
+  std::size_t totalFields() const { return m_locations.size(); }
+
+  iterator begin() const { return m_locations.begin(); }
+  iterator end() const { return m_locations.end(); }
+
+  /// Raw value of an indexed field
+  const char* valueOf( const field_location& location ) const
+  { return m_data + location.offset; }
+
+private:
+  friend class MessageView;
+
+  /// Position of a field in m_locations, ordered by tag then position
+  struct tag_position
+  {
+    int tag;
+    std::size_t position;
+
+    bool operator<( const tag_position& rhs ) const
+    { return tag < rhs.tag || ( tag == rhs.tag && position < rhs.position ); }
+    static bool before( const tag_position& index, int tag )
+    { return index.tag < tag; }
+  };
+  typedef std::vector < tag_position > Index;
+
+  /// First location with the tag, found through the index
+  iterator find( int tag ) const;
+  /// Sort the locations parsed so far into the index
+  void buildIndex();
+
+  void clear( const char* data )
+  {
+    m_locations.clear();
+    m_index.clear();
+    m_data = data;
+  }
+
+  Locations m_locations;
+  Index m_index;
+  const char* m_data;
+};
+
+/**
+ * Zero-copy view over a raw FIX message.
+ *
+ * The view indexes the header, body and trailer of a message without
+ * allocating a FieldBase per field.  It does not own the bytes it was
+ * built from; they must outlive the view.  Repeating groups are not
+ * broken out, so group members are only reachable through their first
+ * occurrence.  Use toMessage() to get a fully decoded Message.
+ */
+class MessageView : public FieldMapView
+{
+public:
+  MessageView();
+
+  /// Index a message contained in a string
+  MessageView( const std::string& string,
+               const DataDictionary* pSessionDataDictionary = 0,
+               const DataDictionary* pApplicationDataDictionary = 0 )
+  EXCEPT ( InvalidMessage );
+
+  /// Index a message contained in a raw buffer
+  MessageView( const char* data, std::size_t length,
+               const DataDictionary* pSessionDataDictionary = 0,
+               const DataDictionary* pApplicationDataDictionary = 0 )
+  EXCEPT ( InvalidMessage );
+
+  /// Re-index the view over new bytes, reusing allocated capacity
+  void setString( const std::string& string,
+                  const DataDictionary* pSessionDataDictionary = 0,
+                  const DataDictionary* pApplicationDataDictionary = 0 )
+  EXCEPT ( InvalidMessage )
+  {
+    setString( string.data(), string.size(),
+               pSessionDataDictionary, pApplicationDataDictionary );
+  }
+
+  void setString( const char* data, std::size_t length,
+                  const DataDictionary* pSessionDataDictionary = 0,
+                  const DataDictionary* pApplicationDataDictionary = 0 )
+  EXCEPT ( InvalidMessage );
+
+  const FieldMapView& getHeader() const { return m_header; }
+  const FieldMapView& getTrailer() const { return m_trailer; }
+
+  const char* data() const { return m_data; }
+  std::size_t size() const { return m_length; }
+  std::string toString() const { return std::string( m_data, m_length ); }
+
+  bool isAdmin() const;
+  bool isApp() const;
+  /// Integer id of the MsgType in the header, zero if it has none
+  int getMsgTypeId() const;
+
+  bool hasValidStructure( int& tag ) const
+  { tag = m_tag;
+    return m_validStructure;
+  }
+
+  /// Number of bytes between BodyLength and CheckSum
+  int bodyLength() const;
+  /// Sum of the bytes preceding CheckSum, modulo 256
+  int checkSum() const;
+
+  /// Check header order, BodyLength and CheckSum against the raw bytes
+  void validate() const EXCEPT ( InvalidMessage );
+
+  /// Decode the viewed bytes into a full Message
+  void toMessage( Message& message, bool validate = false ) const
+  EXCEPT ( InvalidMessage );
+
+private:
+  enum field_type { header, body, trailer };
+
+  std::size_t lengthOfData( int field ) const
+  EXCEPT ( InvalidMessage );
+
+  FieldMapView m_header;
+  FieldMapView m_trailer;
+  std::size_t m_length;
+  std::size_t m_checkSumOffset;
+  bool m_validStructure;
+  bool m_headerOrdered;
+  int m_tag;
+  const DataDictionary* m_pSessionDD;
+  const DataDictionary* m_pAppDD;
+};
+}
+
+#endif //FIX_MESSAGEVIEW
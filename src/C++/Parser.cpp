@@ -26,6 +26,7 @@
 #include "Parser.h"
 #include "Utility.h"
 #include "FieldConvertors.h"
+#include "ByteScanner.h"
 #include <algorithm>
 
 namespace FIX
@@ -34,70 +35,125 @@ bool Parser::extractLength( int& length, std::string::size_type& pos,
                             const std::string& buffer )
 EXCEPT ( MessageParseError )
 {
-  if( !buffer.size() ) return false;
+  std::size_t endPos = 0;
+  if( !extractLength( length, endPos, buffer.data(), buffer.data() + buffer.size() ) )
+    return false;
+  pos = endPos;
+  return true;
+}
 
-  std::string::size_type startPos = buffer.find( "\0019=", 0 );
-  if( startPos == std::string::npos ) return false;
-  startPos += 3;
-  std::string::size_type endPos = buffer.find( "\001", startPos );
-  if( endPos == std::string::npos ) return false;
+bool Parser::extractLength( int& length, std::size_t& pos,
+                            const char* begin, const char* end )
+EXCEPT ( MessageParseError )
+{
+  if( begin == end ) return false;
 
-  std::string strLength( buffer, startPos, endPos - startPos );
+  const char* soh = ByteScanner::findSoh( begin, end );
+  while( soh != end && !( end - soh > 2 && soh[1] == '9' && soh[2] == '=' ) )
+    soh = ByteScanner::findSoh( soh + 1, end );
+  if( soh == end ) return false;
 
-  try
-  {
-    length = IntConvertor::convert( strLength );
-    if( length < 0 ) throw MessageParseError();
-  }
-  catch( FieldConvertError& )
-  { throw MessageParseError(); }
+  const char* const startPos = soh + 3;
+  const char* const endPos = ByteScanner::findSoh( startPos, end );
+  if( endPos == end ) return false;
+
+  if( !IntConvertor::convert( startPos, endPos, length ) || length < 0 )
+    throw MessageParseError();
 
-  pos = endPos + 1;
+  pos = endPos - begin + 1;
   return true;
 }
 
 bool Parser::readFixMessage( std::string& str )
 EXCEPT ( MessageParseError )
 {
-  std::string::size_type pos = 0;
+  const char* data = 0;
+  std::size_t length = 0;
+  if( !readFixMessage( data, length ) )
+    return false;
+  str.assign( data, length );
+  return true;
+}
+
+bool Parser::readFixMessage( const char*& data, std::size_t& length )
+EXCEPT ( MessageParseError )
+{
+  if( m_end - m_begin < 2 ) return false;
 
-  if( m_buffer.length() < 2 ) return false;
-  pos = m_buffer.find( "8=" );
-  if( pos == std::string::npos ) return false;
-  m_buffer.erase( 0, pos );
+  const char* const end = &m_buffer[ 0 ] + m_end;
+  const char* begin = &m_buffer[ 0 ] + m_begin;
+  const char* start = ByteScanner::find( begin, end, '8' );
+  while( start != end && !( end - start > 1 && start[1] == '=' ) )
+    start = ByteScanner::find( start + 1, end, '8' );
+  if( start == end ) return false;
+  m_begin = start - &m_buffer[ 0 ];
+  begin = start;
 
-  int length = 0;
+  int bodyLength = 0;
+  std::size_t pos = 0;
 
   try
   {
-    if( extractLength(length, pos, m_buffer) )
+    if( extractLength( bodyLength, pos, begin, end ) )
     {
-      pos += length;
-      if( m_buffer.size() < pos )
+      pos += bodyLength;
+      if( std::size_t( end - begin ) < pos )
         return false;
 
-      pos = m_buffer.find( "\00110=", pos-1 );
-      if( pos == std::string::npos ) return false;
-      pos += 4;
-      pos = m_buffer.find( "\001", pos );
-      if( pos == std::string::npos ) return false;
-      pos += 1;
+      const char* soh = ByteScanner::findSoh( begin + pos - 1, end );
+      while( soh != end && !( end - soh > 3 && soh[1] == '1' && soh[2] == '0' && soh[3] == '=' ) )
+        soh = ByteScanner::findSoh( soh + 1, end );
+      if( soh == end ) return false;
+      soh = ByteScanner::findSoh( soh + 4, end );
+      if( soh == end ) return false;
 
-      str.assign( m_buffer, 0, pos );
-      m_buffer.erase( 0, pos );
+      data = begin;
+      length = soh - begin + 1;
+      m_begin += length;
+      if( m_begin == m_end )
+        m_begin = m_end = 0;
       return true;
     }
   }
   catch( MessageParseError& e )
   {
-    if( length > 0 )
-      m_buffer.erase( 0, pos + length );
+    if( bodyLength > 0 && pos + bodyLength < std::size_t( end - begin ) )
+      m_begin += pos + bodyLength;
     else
-      m_buffer.erase();
+      m_begin = m_end = 0;
 
     throw e;
   }
 
   return false;
 }
+
+char* Parser::getBuffer( std::size_t& length, std::size_t minimum )
+{
+  if( m_buffer.size() - m_end < minimum )
+  {
+    // reclaim consumed bytes before growing, only a partial
+    // message is ever left to move
+    if( m_begin )
+    {
+      std::copy( m_buffer.begin() + m_begin, m_buffer.begin() + m_end,
+                 m_buffer.begin() );
+      m_end -= m_begin;
+      m_begin = 0;
+    }
+    if( m_buffer.size() - m_end < minimum )
+      m_buffer.resize( std::max( m_buffer.size() * 2, m_end + minimum ) );
+  }
+
+  length = m_buffer.size() - m_end;
+  return &m_buffer[ 0 ] + m_end;
+}
+
+void Parser::addToStream( const char* str, size_t len )
+{
+  std::size_t length = 0;
+  char* buffer = getBuffer( length, len );
+  std::copy( str, str + len, buffer );
+  commit( len );
+}
 }
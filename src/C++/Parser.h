@@ -27,31 +27,61 @@
 #endif
 
 #include "Exceptions.h"
+#include <cstdio>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace FIX
 {
-/// Parses %FIX messages off an input stream.
+/**
+ * Parses %FIX messages off an input stream.
+ *
+ * Incoming bytes are kept in a compacting buffer.  Complete messages are
+ * handed out as spans into that buffer, and consumed bytes are only
+ * reclaimed when more free space is asked for, so reading a burst of
+ * messages never moves the bytes that follow them.
+ */
 class Parser
 {
 public:
-  Parser() {}
+  Parser() : m_begin( 0 ), m_end( 0 ) {}
   ~Parser() {}
 
   bool extractLength( int& length, std::string::size_type& pos,
                       const std::string& buffer )
   EXCEPT ( MessageParseError );
+
+  /// Copy the next complete message into str
   bool readFixMessage( std::string& str )
   EXCEPT ( MessageParseError );
+  /// Point at the next complete message without copying it.  The span
+  /// stays valid until the buffer is next written to.
+  bool readFixMessage( const char*& data, std::size_t& length )
+  EXCEPT ( MessageParseError );
+
+  /// Free space at the end of the buffer, at least minimum bytes long.
+  /// Data written there becomes part of the stream once committed.
+  char* getBuffer( std::size_t& length, std::size_t minimum = BUFSIZ );
+  /// Add length bytes written into the space returned by getBuffer
+  void commit( std::size_t length )
+  { m_end += length; }
 
-  void addToStream( const char* str, size_t len )
-  { m_buffer.append( str, len ); }
+  void addToStream( const char* str, size_t len );
   void addToStream( const std::string& str )
-  { m_buffer.append( str ); }
+  { addToStream( str.data(), str.size() ); }
+
+  /// Number of bytes received but not yet read as messages
+  std::size_t size() const { return m_end - m_begin; }
 
 private:
-  std::string m_buffer;
+  bool extractLength( int& length, std::size_t& pos,
+                      const char* begin, const char* end )
+  EXCEPT ( MessageParseError );
+
+  std::vector<char> m_buffer;
+  std::size_t m_begin;
+  std::size_t m_end;
 };
 }
 #endif //FIX_PARSER_H
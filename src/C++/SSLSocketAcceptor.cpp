@@ -185,6 +185,10 @@ EXCEPT ( ConfigError )
     if( settings.has(SOCKET_NODELAY) )
       settings.getBool( SOCKET_NODELAY );
   }
+
+  const Dictionary& dict = s.get();
+  if( dict.has(SOCKET_USE_EPOLL) )
+    dict.getBool( SOCKET_USE_EPOLL );
 }
 
 void SSLSocketAcceptor::onInitialize( const SessionSettings& s )
@@ -232,6 +236,11 @@ EXCEPT ( RuntimeError )
   {
     m_pServer = new SocketServer( 1 );
 
+    const Dictionary& dict = s.get();
+    if( dict.has(SOCKET_USE_EPOLL) && dict.getBool(SOCKET_USE_EPOLL)
+        && !m_pServer->getMonitor().useEpoll() && getLog() )
+      getLog()->onEvent( "epoll is not available, using select" );
+
     std::set<SessionID> sessions = s.getSessions();
     std::set<SessionID>::iterator i = sessions.begin();
     for( ; i != sessions.end(); ++i )
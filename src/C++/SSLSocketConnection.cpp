@@ -287,7 +287,7 @@ bool SSLSocketConnection::read(SSLSocketAcceptor &a, SocketServer& s )
       if( m_pSession )
         m_pSession = a.getSession( msg, *this );
       if( m_pSession )
-        m_pSession->next( msg, UtcTimeStamp() );
+        m_pSession->next( msg, m_pSession->getClock().now() );
       if( !m_pSession )
       {
         s.getMonitor().drop( m_socket );
@@ -345,7 +345,9 @@ EXCEPT ( SocketRecvFailed )
     {
       Locker locker(m_mutex);
 
-      size = SSL_read(m_ssl, m_buffer, sizeof(m_buffer));
+      std::size_t length = 0;
+      char* buffer = m_parser.getBuffer(length);
+      size = SSL_read(m_ssl, buffer, (int)length);
       if (size <= 0)
         errCodeSSL = SSL_get_error(m_ssl, size);
       else if (SSL_pending(m_ssl) > 0)
@@ -384,7 +386,7 @@ EXCEPT ( SocketRecvFailed )
       }
     }
 
-    m_parser.addToStream(m_buffer, size);
+    m_parser.commit(size);
   } while (pending);
 }
 
@@ -402,12 +404,14 @@ void SSLSocketConnection::readMessages( SocketMonitor& s )
 {
   if( !m_pSession ) return;
 
+  // every message taken from one recv is processed with the same time
+  UtcTimeStamp now = m_pSession->getClock().now();
   std::string msg;
   while( readMessage( msg ) )
   {
     try
     {
-      m_pSession->next( msg, UtcTimeStamp() );
+      m_pSession->next( msg, now );
     }
     catch ( InvalidMessage& )
     {
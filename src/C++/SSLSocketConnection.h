@@ -188,7 +188,6 @@ private:
 
   socket_handle m_socket;
   SSL *m_ssl;
-  char m_buffer[BUFSIZ];
 
   Parser m_parser;
   Queue m_sendQueue;
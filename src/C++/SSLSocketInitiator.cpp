@@ -191,6 +191,9 @@ EXCEPT ( ConfigError )
     m_sendBufSize = dict.getInt( SOCKET_SEND_BUFFER_SIZE );
   if( dict.has( SOCKET_RECEIVE_BUFFER_SIZE ) )
     m_rcvBufSize = dict.getInt( SOCKET_RECEIVE_BUFFER_SIZE );
+  if( dict.has( SOCKET_USE_EPOLL ) && dict.getBool( SOCKET_USE_EPOLL )
+      && !m_connector.getMonitor().useEpoll() && getLog() )
+    getLog()->onEvent( "epoll is not available, using select" );
 }
 
 void SSLSocketInitiator::onInitialize( const SessionSettings& s )
@@ -293,7 +296,7 @@ void SSLSocketInitiator::doConnect( const SessionID& s, const Dictionary& d )
     short sourcePort = 0;
 
     Session* session = Session::lookupSession( s );
-    if( !session->isSessionTime(UtcTimeStamp()) ) return;
+    if( !session->isSessionTime(session->getClock().now()) ) return;
 
     Log* log = session->getLog();
 
@@ -25,6 +25,7 @@
 
 #include "Session.h"
 #include "Values.h"
+#include "HeaderPeek.h"
 #include <algorithm>
 #include <iostream>
 
@@ -61,10 +62,20 @@ Session::Session( Application& application,
   m_timestampPrecision( 3 ),
   m_persistMessages( true ),
   m_validateLengthAndChecksum( true ),
+  m_useMessageView( false ),
+  m_reuseInboundMessage( false ),
+  m_lazyGroupDecoding( false ),
+  m_pDecodeProfile( 0 ),
   m_dataDictionaryProvider( dataDictionaryProvider ),
   m_messageStoreFactory( messageStoreFactory ),
   m_pLogFactory( pLogFactory ),
-  m_pResponder( 0 )
+  m_pResponder( 0 ),
+  m_batchSize( 0 ),
+  m_headerTemplate( sessionID ),
+  m_sendingTimeLength( 0 ),
+  m_inboundInUse( false ),
+  m_pMovableMessage( 0 ),
+  m_pClock( &Clock::realtime() )
 {
   m_state.heartBtInt( heartBtInt );
   m_state.initiate( heartBtInt != 0 );
@@ -72,7 +83,7 @@ Session::Session( Application& application,
   if ( m_pLogFactory )
     m_state.log( m_pLogFactory->create( m_sessionID ) );
 
-  if( !checkSessionTime(UtcTimeStamp()) )
+  if( !checkSessionTime(m_pClock->now()) )
     reset();
 
   addSession( *this );
@@ -88,16 +99,17 @@ Session::~Session()
     m_pLogFactory->destroy( m_state.log() );
 }
 
-void Session::insertSendingTime( Header& header )
+void Session::insertSendingTime( Header& header, const UtcTimeStamp& now )
 {
-  UtcTimeStamp now;
   bool showMilliseconds = false;
   if( m_sessionID.getBeginString() == BeginString_FIXT11 )
     showMilliseconds = true;
   else
     showMilliseconds = m_sessionID.getBeginString() >= BeginString_FIX42;
 
-  header.setField( SendingTime(now, showMilliseconds ? m_timestampPrecision : 0) );
+  // kept for the header template to write into its slot
+  m_sendingTimeLength = m_timestamps.format( m_sendingTime, now, showMilliseconds ? m_timestampPrecision : 0 );
+  header.setField( FieldBase( FIELD::SendingTime, std::string( m_sendingTime, m_sendingTimeLength ) ) );
 }
 
 void Session::insertOrigSendingTime( Header& header, const UtcTimeStamp& when )
@@ -108,23 +120,48 @@ void Session::insertOrigSendingTime( Header& header, const UtcTimeStamp& when )
   else
     showMilliseconds = m_sessionID.getBeginString() >= BeginString_FIX42;
 
-  header.setField( OrigSendingTime(when, showMilliseconds ? m_timestampPrecision : 0) );
+  char buffer[ UtcTimeStampConvertor::MAX_LENGTH ];
+  std::size_t length = m_timestamps.format( buffer, when, showMilliseconds ? m_timestampPrecision : 0 );
+  header.setField( FieldBase( FIELD::OrigSendingTime, std::string( buffer, length ) ) );
 }
 
 void Session::fill( Header& header )
 {
-  UtcTimeStamp now;
+  UtcTimeStamp now = m_pClock->now();
   m_state.lastSentTime( now );
-  header.setField( m_sessionID.getBeginString() );
-  header.setField( m_sessionID.getSenderCompID() );
-  header.setField( m_sessionID.getTargetCompID() );
+  // the identity fields are written by serialize, so they are only
+  // corrected here on messages that already have them
+  if ( header.isSetField( FIELD::BeginString ) )
+    header.setField( m_sessionID.getBeginString() );
+  if ( header.isSetField( FIELD::SenderCompID ) )
+    header.setField( m_sessionID.getSenderCompID() );
+  if ( header.isSetField( FIELD::TargetCompID ) )
+    header.setField( m_sessionID.getTargetCompID() );
   header.setField( MsgSeqNum( getExpectedSenderNum() ) );
-  insertSendingTime( header );
+  insertSendingTime( header, now );
+}
+
+std::string& Session::serialize( Message& message, int msgSeqNum, std::string& string )
+{
+  if ( m_headerTemplate.serialize( message, msgSeqNum,
+                                   m_sendingTime, m_sendingTimeLength, string ) )
+    return string;
+
+  // application callbacks changed the header, so it is written out as
+  // it is with whichever identity fields they did not set
+  Header& header = message.getHeader();
+  if ( !header.isSetField( FIELD::BeginString ) )
+    header.setField( m_sessionID.getBeginString() );
+  if ( !header.isSetField( FIELD::SenderCompID ) )
+    header.setField( m_sessionID.getSenderCompID() );
+  if ( !header.isSetField( FIELD::TargetCompID ) )
+    header.setField( m_sessionID.getTargetCompID() );
+  return message.toString( string );
 }
 
 void Session::next()
 {
-  next( UtcTimeStamp() );
+  next( m_pClock->now() );
 }
 
 void Session::next( const UtcTimeStamp& timeStamp )
@@ -155,7 +192,7 @@ void Session::next( const UtcTimeStamp& timeStamp )
         generateLogon();
         m_state.onEvent( "Initiated logon request" );
       }
-      else if ( m_state.alreadySentLogon() && m_state.logonTimedOut() )
+      else if ( m_state.alreadySentLogon() && m_state.logonTimedOut( timeStamp ) )
       {
         m_state.onEvent( "Timed out waiting for logon response" );
         disconnect();
@@ -165,28 +202,28 @@ void Session::next( const UtcTimeStamp& timeStamp )
 
     if ( m_state.heartBtInt() == 0 ) return ;
 
-    if ( m_state.logoutTimedOut() )
+    if ( m_state.logoutTimedOut( timeStamp ) )
     {
       m_state.onEvent( "Timed out waiting for logout response" );
       disconnect();
     }
 
-    if ( m_state.withinHeartBeat() ) return ;
+    if ( m_state.withinHeartBeat( timeStamp ) ) return ;
 
-    if ( m_state.timedOut() )
+    if ( m_state.timedOut( timeStamp ) )
     {
       m_state.onEvent( "Timed out waiting for heartbeat" );
       disconnect();
     }
     else
     {
-      if ( m_state.needTestRequest() )
+      if ( m_state.needTestRequest( timeStamp ) )
       {
         generateTestRequest( "TEST" );
         m_state.testRequest( m_state.testRequest() + 1 );
         m_state.onEvent( "Sent test request TEST" );
       }
-      else if ( m_state.needHeartbeat() )
+      else if ( m_state.needHeartbeat( timeStamp ) )
       {
         generateHeartbeat();
       }
@@ -243,7 +280,7 @@ void Session::nextLogon( const Message& logon, const UtcTimeStamp& timeStamp )
   if( !m_state.initiate() && m_resetOnLogon )
     m_state.reset();
 
-  if( !verify( logon, false, true ) )
+  if( !verify( logon, timeStamp, false, true ) )
     return;
   m_state.receivedLogon( true );
 
@@ -279,14 +316,14 @@ void Session::nextLogon( const Message& logon, const UtcTimeStamp& timeStamp )
 
 void Session::nextHeartbeat( const Message& heartbeat, const UtcTimeStamp& timeStamp )
 {
-  if ( !verify( heartbeat ) ) return ;
+  if ( !verify( heartbeat, timeStamp ) ) return ;
   m_state.incrNextTargetMsgSeqNum();
   nextQueued( timeStamp );
 }
 
 void Session::nextTestRequest( const Message& testRequest, const UtcTimeStamp& timeStamp )
 {
-  if ( !verify( testRequest ) ) return ;
+  if ( !verify( testRequest, timeStamp ) ) return ;
   generateHeartbeat( testRequest );
   m_state.incrNextTargetMsgSeqNum();
   nextQueued( timeStamp );
@@ -294,7 +331,7 @@ void Session::nextTestRequest( const Message& testRequest, const UtcTimeStamp& t
 
 void Session::nextLogout( const Message& logout, const UtcTimeStamp& timeStamp )
 {
-  if ( !verify( logout, false, false ) ) return ;
+  if ( !verify( logout, timeStamp, false, false ) ) return ;
   if ( !m_state.sentLogout() )
   {
     m_state.onEvent( "Received logout request" );
@@ -311,7 +348,7 @@ void Session::nextLogout( const Message& logout, const UtcTimeStamp& timeStamp )
 
 void Session::nextReject( const Message& reject, const UtcTimeStamp& timeStamp )
 {
-  if ( !verify( reject, false, true ) ) return ;
+  if ( !verify( reject, timeStamp, false, true ) ) return ;
   m_state.incrNextTargetMsgSeqNum();
   nextQueued( timeStamp );
 }
@@ -325,7 +362,7 @@ void Session::nextSequenceReset( const Message& sequenceReset, const UtcTimeStam
     isGapFill = gapFillFlag;
   }
 
-  if ( !verify( sequenceReset, isGapFill, isGapFill ) ) return ;
+  if ( !verify( sequenceReset, timeStamp, isGapFill, isGapFill ) ) return ;
 
   NewSeqNo newSeqNo;
   if ( sequenceReset.getFieldIfSet( newSeqNo ) )
@@ -343,7 +380,7 @@ void Session::nextSequenceReset( const Message& sequenceReset, const UtcTimeStam
 
 void Session::nextResendRequest( const Message& resendRequest, const UtcTimeStamp& timeStamp )
 {
-  if ( !verify( resendRequest, false, false ) ) return ;
+  if ( !verify( resendRequest, timeStamp, false, false ) ) return ;
 
   Locker l( m_mutex );
 
@@ -384,20 +421,33 @@ void Session::nextResendRequest( const Message& resendRequest, const UtcTimeStam
 
   for ( i = messages.begin(); i != messages.end(); ++i )
   {
+    HeaderPeek peek( *i );
+    if ( peek.getMsgSeqNum() && Message::isAdminMsgTypeId( peek.getMsgTypeId() ) )
+    {
+      // admin messages are never resent so they are not decoded
+      msgSeqNum = MsgSeqNum( peek.getMsgSeqNum() );
+      if( (current != msgSeqNum) && !begin )
+        begin = current;
+      if ( !begin ) begin = msgSeqNum;
+      current = msgSeqNum + 1;
+      continue;
+    }
+
     SmartPtr<FIX::Message> pMsg;
     std::string strMsgType;
     const DataDictionary& sessionDD =
       m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
     if (sessionDD.isMessageFieldsOrderPreserved())
     {
-      std::string::size_type equalSign = (*i).find("\00135=");
-      equalSign += 4;
-      std::string::size_type soh = (*i).find_first_of('\001', equalSign);
-      strMsgType = (*i).substr(equalSign, soh - equalSign);
+      const char* value = 0;
+      std::size_t length = 0;
+      if ( peek.getValue( FIELD::MsgType, value, length ) )
+        strMsgType.assign( value, length );
 #ifdef HAVE_EMX
       if (FIX::Message::isAdminMsgType(strMsgType) == false)
       {
-        equalSign = (*i).find("\0019426=", soh);
+        std::string::size_type equalSign = (*i).find("\0019426=");
+        std::string::size_type soh;
         if (equalSign == std::string::npos)
           throw FIX::IOException("EMX message type (9426) not found");
 
@@ -412,10 +462,8 @@ void Session::nextResendRequest( const Message& resendRequest, const UtcTimeStam
 
     if( m_sessionID.isFIXT() )
     {
-      Message msg;
-      msg.setStringHeader(*i);
       ApplVerID applVerID;
-      if( !msg.getHeader().getFieldIfSet(applVerID) )
+      if( !peek.getFieldIfSet(applVerID) )
         applVerID = m_senderDefaultApplVerID;
 
       const DataDictionary& applicationDD =
@@ -527,28 +575,126 @@ bool Session::send( Message& message )
   return sendRaw( message );
 }
 
+bool Session::send( std::vector < Message* > & messages )
+{
+  Locker l( m_mutex );
+
+  bool result = true;
+  try
+  {
+    m_batchSize = 0;
+    std::vector < Message* > ::iterator i;
+    for ( i = messages.begin(); i != messages.end(); ++i )
+    {
+      Message& message = **i;
+      Header& header = message.getHeader();
+      header.removeField( FIELD::PossDupFlag );
+      header.removeField( FIELD::OrigSendingTime );
+
+      if ( Message::isAdminMsgTypeId( message.getMsgTypeId() ) )
+      {
+        // admin messages can reset the sequence numbers
+        sendBatch();
+        result = sendRaw( message ) && result;
+        continue;
+      }
+
+      // do not send application messages if they will just be cleared
+      if( !isLoggedOn() && shouldSendReset() )
+      {
+        result = false;
+        continue;
+      }
+
+      fill( header );
+      int msgSeqNum = getExpectedSenderNum() + (int)m_batchSize;
+      header.setField( MsgSeqNum( msgSeqNum ) );
+      try
+      {
+        m_application.toApp( message, m_sessionID );
+      }
+      catch ( DoNotSend& )
+      {
+        result = false;
+        continue;
+      }
+
+      // a message sent from toApp takes the next number after the batch
+      // so far, which it sends first, and this one follows it
+      if ( getExpectedSenderNum() + (int)m_batchSize != msgSeqNum )
+      {
+        msgSeqNum = getExpectedSenderNum() + (int)m_batchSize;
+        header.setField( MsgSeqNum( msgSeqNum ) );
+      }
+
+      if ( m_batch.size() == m_batchSize )
+        m_batch.push_back( std::string() );
+      serialize( message, msgSeqNum, m_batch[ m_batchSize++ ] );
+    }
+    sendBatch();
+  }
+  catch ( IOException& e )
+  {
+    m_batchSize = 0;
+    m_state.onEvent( e.what() );
+    return false;
+  }
+
+  return result;
+}
+
+void Session::sendBatch() EXCEPT ( IOException )
+{
+  if ( !m_batchSize ) return;
+
+  // the store is handed exactly the messages of this batch
+  std::size_t size = m_batchSize;
+  m_batchSize = 0;
+  m_batch.resize( size );
+
+  int msgSeqNum = getExpectedSenderNum();
+  if( m_persistMessages )
+    m_state.setBatch( msgSeqNum, m_batch );
+  m_state.setNextSenderMsgSeqNum( msgSeqNum + (int)size );
+
+  if ( !isLoggedOn() || !m_pResponder ) return;
+
+  std::string& buffer = m_sendBuffer;
+  buffer.clear();
+  std::vector < std::string > ::const_iterator i;
+  for ( i = m_batch.begin(); i != m_batch.end(); ++i )
+  {
+    m_state.onOutgoing( *i );
+    buffer += *i;
+  }
+  m_pResponder->send( buffer );
+}
+
 bool Session::sendRaw( Message& message, int num )
 {
   Locker l( m_mutex );
 
   try
   {
+    // messages batched before one sent from toApp go out first
+    sendBatch();
+
     Header& header = message.getHeader();
 
-    MsgType msgType;
-    header.getFieldIfSet(msgType);
+    const int msgTypeId = message.getMsgTypeId();
 
     fill( header );
-    std::string messageString;
+    std::string& messageString = m_sendBuffer;
 
+    int msgSeqNum = num ? num : getExpectedSenderNum();
     if ( num )
       header.setField( MsgSeqNum( num ) );
 
-    if ( Message::isAdminMsgType( msgType ) )
+    if ( Message::isAdminMsgTypeId( msgTypeId ) )
     {
       m_application.toAdmin( message, m_sessionID );
 
-      if( msgType == "A" && !m_state.receivedReset() )
+      if( msgTypeId == MsgTypeId_Logon && !m_state.receivedReset() )
       {
         ResetSeqNumFlag resetSeqNumFlag( false );
         message.getFieldIfSet(resetSeqNumFlag);
@@ -556,19 +702,21 @@ bool Session::sendRaw( Message& message, int num )
         if( resetSeqNumFlag )
         {
           m_state.reset();
-          message.getHeader().setField( MsgSeqNum(getExpectedSenderNum()) );
+          msgSeqNum = getExpectedSenderNum();
+          message.getHeader().setField( MsgSeqNum(msgSeqNum) );
         }
         m_state.sentReset( resetSeqNumFlag );
       }
 
-      message.toString( messageString );
+      serialize( message, msgSeqNum, messageString );
 
       if( !num )
         persist( message, messageString );
 
       if (
-        msgType == "A" || msgType == "5"
-        || msgType == "2" || msgType == "4"
+        msgTypeId == MsgTypeId_Logon || msgTypeId == MsgTypeId_Logout
+        || msgTypeId == MsgTypeId_ResendRequest
+        || msgTypeId == MsgTypeId_SequenceReset
         || isLoggedOn() )
       {
         send( messageString );
@@ -583,7 +731,7 @@ bool Session::sendRaw( Message& message, int num )
       try
       {
         m_application.toApp( message, m_sessionID );
-        message.toString( messageString );
+        serialize( message, msgSeqNum, messageString );
 
         if( !num )
           persist( message, messageString );
@@ -649,7 +797,7 @@ bool Session::resend( Message& message )
   header.getField( msgSeqNum );
   insertOrigSendingTime( header, sendingTime );
   header.setField( PossDupFlag( true ) );
-  insertSendingTime( header );
+  insertSendingTime( header, m_pClock->now() );
 
   try
   {
@@ -688,8 +836,7 @@ void Session::generateLogon()
     logon.setField( ResetSeqNumFlag(true) );
 
   fill( logon.getHeader() );
-  UtcTimeStamp now;
-  m_state.lastReceivedTime( now );
+  m_state.lastReceivedTime( m_pClock->now() );
   m_state.testRequest( 0 );
   m_state.sentLogon( true );
   sendRaw( logon );
@@ -1031,8 +1178,9 @@ void Session::populateRejectReason( Message& reject, const std::string& text )
   reject.setField( Text( text ) );
 }
 
-bool Session::verify( const Message& msg, bool checkTooHigh,
-                      bool checkTooLow )
+bool Session::verify( const Message& msg, const UtcTimeStamp& timeStamp,
+                      bool checkTooHigh, bool checkTooLow,
+                      const MessageView* pView )
 {
   const MsgType* pMsgType = 0;
   const MsgSeqNum* pMsgSeqNum = 0;
@@ -1052,7 +1200,7 @@ bool Session::verify( const Message& msg, bool checkTooHigh,
     if ( !validLogonState( *pMsgType ) )
       throw std::logic_error( "Logon state is not valid for message" );
 
-    if ( !isGoodTime( sendingTime ) )
+    if ( !isGoodTime( sendingTime, timeStamp ) )
     {
       doBadTime( msg );
       return false;
@@ -1095,11 +1243,10 @@ bool Session::verify( const Message& msg, bool checkTooHigh,
     return false;
   }
 
-  UtcTimeStamp now;
-  m_state.lastReceivedTime( now );
+  m_state.lastReceivedTime( timeStamp );
   m_state.testRequest( 0 );
 
-  fromCallback( pMsgType ? *pMsgType : MsgType(), msg, m_sessionID );
+  fromCallback( pMsgType ? *pMsgType : MsgType(), msg, m_sessionID, pView );
   return true;
 }
 
@@ -1135,10 +1282,12 @@ bool Session::validLogonState( const MsgType& msgType )
 }
 
 void Session::fromCallback( const MsgType& msgType, const Message& msg,
-                            const SessionID& sessionID )
+                            const SessionID& sessionID, const MessageView* pView )
 {
   if ( Message::isAdminMsgType( msgType ) )
     m_application.fromAdmin( msg, m_sessionID );
+  else if ( pView )
+    m_application.fromAppView( *pView, m_sessionID );
   else
     m_application.fromApp( msg, m_sessionID );
 }
@@ -1216,7 +1365,17 @@ void Session::doTargetTooHigh( const Message& msg )
                    + " but received "
                    + IntConvertor::convert( msgSeqNum ) );
 
-  m_state.queue( msgSeqNum, msg );
+#ifdef HAVE_RVALUE_REFERENCES
+  if( &msg == m_pMovableMessage )
+  {
+    // callers return without reading a message that was queued
+    Message* pMessage = m_pMovableMessage;
+    m_pMovableMessage = 0;
+    m_state.queue( msgSeqNum, std::move( *pMessage ) );
+  }
+  else
+#endif
+    m_state.queue( msgSeqNum, msg );
 
   if( m_state.resendRequested() )
   {
@@ -1257,7 +1416,11 @@ bool Session::nextQueued( int num, const UtcTimeStamp& timeStamp )
     }
     else
     {
+#ifdef HAVE_RVALUE_REFERENCES
+      next( std::move( msg ), timeStamp, true );
+#else
       next( msg, timeStamp, true );
+#endif
     }
     return true;
   }
@@ -1275,11 +1438,25 @@ void Session::next( const std::string& msg, const UtcTimeStamp& timeStamp, bool
     {
       const DataDictionary& applicationDD =
         m_dataDictionaryProvider.getApplicationDataDictionary(m_senderDefaultApplVerID);
-      next( Message( msg, sessionDD, applicationDD, m_validateLengthAndChecksum ), timeStamp, queued );
+      if( m_useMessageView )
+        next( MessageView( msg, &sessionDD, &applicationDD ), timeStamp, queued );
+      else if( m_reuseInboundMessage && !m_inboundInUse )
+        nextInbound( msg, sessionDD, applicationDD, timeStamp, queued );
+      else if( m_lazyGroupDecoding || m_pDecodeProfile )
+        nextDecoded( msg, sessionDD, applicationDD, timeStamp, queued );
+      else
+        next( Message( msg, sessionDD, applicationDD, m_validateLengthAndChecksum ), timeStamp, queued );
     }
     else
     {
-      next( Message( msg, sessionDD, m_validateLengthAndChecksum ), timeStamp, queued );
+      if( m_useMessageView )
+        next( MessageView( msg, &sessionDD, &sessionDD ), timeStamp, queued );
+      else if( m_reuseInboundMessage && !m_inboundInUse )
+        nextInbound( msg, sessionDD, sessionDD, timeStamp, queued );
+      else if( m_lazyGroupDecoding || m_pDecodeProfile )
+        nextDecoded( msg, sessionDD, sessionDD, timeStamp, queued );
+      else
+        next( Message( msg, sessionDD, m_validateLengthAndChecksum ), timeStamp, queued );
     }
   }
   catch( InvalidMessage& e )
@@ -1298,7 +1475,138 @@ void Session::next( const std::string& msg, const UtcTimeStamp& timeStamp, bool
   }
 }
 
+void Session::nextInbound( const std::string& msg, const DataDictionary& sessionDD,
+                           const DataDictionary& applicationDD,
+                           const UtcTimeStamp& timeStamp, bool queued )
+{
+  // Decoding into the same message every time lets its fields and
+  // groups keep their storage.  Queued messages are copied by the
+  // SessionState, so nothing holds on to it after next returns.
+  m_inboundInUse = true;
+  try
+  {
+    m_inboundMessage.setString( msg, m_validateLengthAndChecksum, &sessionDD, &applicationDD );
+    next( m_inboundMessage, timeStamp, queued );
+  }
+  catch( ... )
+  {
+    m_inboundInUse = false;
+    throw;
+  }
+  m_inboundInUse = false;
+}
+
+void Session::nextDecoded( const std::string& msg, const DataDictionary& sessionDD,
+                           const DataDictionary& applicationDD,
+                           const UtcTimeStamp& timeStamp, bool queued )
+{
+  // Groups are built when the application first asks for them.
+  // Deferred groups are decoded from the copy of msg the message
+  // keeps, so a queued message does not refer back to msg either.
+  Message message;
+  message.setLazyGroups( m_lazyGroupDecoding );
+  message.setDecodeProfile( m_pDecodeProfile );
+  message.setString( msg, m_validateLengthAndChecksum, &sessionDD, &applicationDD );
+#ifdef HAVE_RVALUE_REFERENCES
+  next( std::move( message ), timeStamp, queued );
+#else
+  next( message, timeStamp, queued );
+#endif
+}
+
+void Session::next( const MessageView& view, const UtcTimeStamp& timeStamp, bool queued )
+{
+  // Only in sequence application messages are handed to the application
+  // as a view.  Everything else takes the fully decoded path.
+  bool decode = queued || !view.isApp()
+    || view.getHeader().isSetField( FIELD::NoHops );
+#ifdef HAVE_EMX
+  decode = true;
+#endif
+
+  const char* value = 0;
+  std::size_t length = 0;
+  int msgSeqNum = 0;
+  if ( !decode )
+  {
+    decode = !view.getHeader().getValue( FIELD::MsgSeqNum, value, length )
+      || !IntConvertor::convert( value, value + length, msgSeqNum )
+      || isTargetTooHigh( msgSeqNum );
+  }
+
+  // bodies the dictionary cannot check in place are validated decoded
+  if ( !decode )
+  {
+    const DataDictionary* pApplicationDD =
+      &m_dataDictionaryProvider.getSessionDataDictionary( m_sessionID.getBeginString() );
+    if( m_sessionID.isFIXT() )
+    {
+      ApplVerID applVerID = m_targetDefaultApplVerID;
+      view.getHeader().getFieldIfSet( applVerID );
+      pApplicationDD = &m_dataDictionaryProvider.getApplicationDataDictionary( applVerID );
+    }
+    decode = !pApplicationDD->canValidate( view );
+  }
+
+  if ( decode )
+  {
+    Message message;
+    view.toMessage( message, m_validateLengthAndChecksum );
+#ifdef HAVE_RVALUE_REFERENCES
+    next( std::move( message ), timeStamp, queued );
+#else
+    next( message, timeStamp, queued );
+#endif
+    return;
+  }
+
+  if ( m_validateLengthAndChecksum )
+    view.validate();
+
+  // Session level processing only needs the header and trailer
+  Message message;
+  FieldMapView::iterator i;
+  for ( i = view.getHeader().begin(); i != view.getHeader().end(); ++i )
+  {
+    message.getHeader().setField
+      ( FieldBase( i->tag, std::string( view.getHeader().valueOf( *i ), i->length ) ) );
+  }
+  for ( i = view.getTrailer().begin(); i != view.getTrailer().end(); ++i )
+  {
+    message.getTrailer().setField
+      ( FieldBase( i->tag, std::string( view.getTrailer().valueOf( *i ), i->length ) ) );
+  }
+
+  next( message, &view, timeStamp, queued );
+}
+
 void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool queued )
+{
+  next( message, 0, timeStamp, queued );
+}
+
+#ifdef HAVE_RVALUE_REFERENCES
+void Session::next( Message&& message, const UtcTimeStamp& timeStamp, bool queued )
+{
+  // queued messages are processed while this one is, so the
+  // message it replaces is put back afterwards
+  Message* pPrevious = m_pMovableMessage;
+  m_pMovableMessage = &message;
+  try
+  {
+    next( message, 0, timeStamp, queued );
+  }
+  catch( ... )
+  {
+    m_pMovableMessage = pPrevious;
+    throw;
+  }
+  m_pMovableMessage = pPrevious;
+}
+#endif
+
+void Session::next( const Message& message, const MessageView* pView,
+                    const UtcTimeStamp& timeStamp, bool queued )
 {
   const Header& header = message.getHeader();
 
@@ -1307,7 +1615,7 @@ void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool
     if ( !checkSessionTime(timeStamp) )
       { reset(); return; }
 
-    const MsgType& msgType = FIELD_GET_REF( header, MsgType );
+    const int msgTypeId = Message::msgTypeId( FIELD_GET_REF( header, MsgType ) );
     const BeginString& beginString = FIELD_GET_REF( header, BeginString );
     // make sure these fields are present
     FIELD_THROW_IF_NOT_FOUND( header, SenderCompID );
@@ -1316,7 +1624,7 @@ void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool
     if ( beginString != m_sessionID.getBeginString() )
       throw UnsupportedVersion();
 
-    if( msgType == MsgType_Logon )
+    if( msgTypeId == MsgTypeId_Logon )
     {
       if( m_sessionID.isFIXT() )
       {
@@ -1338,30 +1646,38 @@ void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool
       header.getFieldIfSet(applVerID);
       const DataDictionary& applicationDataDictionary = 
         m_dataDictionaryProvider.getApplicationDataDictionary(applVerID);
-      DataDictionary::validate( message, &sessionDataDictionary, &applicationDataDictionary );
+      if( pView )
+        DataDictionary::validate( *pView, &sessionDataDictionary, &applicationDataDictionary );
+      else
+        DataDictionary::validate( message, &sessionDataDictionary, &applicationDataDictionary );
+    }
+    else if( pView )
+    {
+      DataDictionary::validate( *pView, &sessionDataDictionary, &sessionDataDictionary );
     }
     else
     {
       sessionDataDictionary.validate( message );
     }
 
-    if ( msgType == MsgType_Logon )
-      nextLogon( message, timeStamp );
-    else if ( msgType == MsgType_Heartbeat )
-      nextHeartbeat( message, timeStamp );
-    else if ( msgType == MsgType_TestRequest )
-      nextTestRequest( message, timeStamp );
-    else if ( msgType == MsgType_SequenceReset )
-      nextSequenceReset( message, timeStamp );
-    else if ( msgType == MsgType_Logout )
-      nextLogout( message, timeStamp );
-    else if ( msgType == MsgType_ResendRequest )
-      nextResendRequest( message, timeStamp );
-    else if ( msgType == MsgType_Reject )
-      nextReject( message, timeStamp );
-    else
+    switch( msgTypeId )
     {
-      if ( !verify( message ) ) return ;
+    case MsgTypeId_Logon:
+      nextLogon( message, timeStamp ); break;
+    case MsgTypeId_Heartbeat:
+      nextHeartbeat( message, timeStamp ); break;
+    case MsgTypeId_TestRequest:
+      nextTestRequest( message, timeStamp ); break;
+    case MsgTypeId_SequenceReset:
+      nextSequenceReset( message, timeStamp ); break;
+    case MsgTypeId_Logout:
+      nextLogout( message, timeStamp ); break;
+    case MsgTypeId_ResendRequest:
+      nextResendRequest( message, timeStamp ); break;
+    case MsgTypeId_Reject:
+      nextReject( message, timeStamp ); break;
+    default:
+      if ( !verify( message, timeStamp, true, true, pView ) ) return ;
       m_state.incrNextTargetMsgSeqNum();
     }
   }
@@ -1378,7 +1694,7 @@ void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool
     else
     {
       LOGEX( generateReject( message, SessionRejectReason_REQUIRED_TAG_MISSING, e.field ) );
-      if ( header.getField(FIELD::MsgType) == MsgType_Logon )
+      if ( message.getMsgTypeId() == MsgTypeId_Logon )
       {
         m_state.onEvent( "Required field missing from logon" );
         disconnect();
@@ -1420,7 +1736,7 @@ void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool
   }
   catch ( UnsupportedVersion& )
   {
-    if ( header.getField(FIELD::MsgType) == MsgType_Logout )
+    if ( message.getMsgTypeId() == MsgTypeId_Logout )
       nextLogout( message, timeStamp );
     else
     {
@@ -1505,16 +1821,15 @@ Session* Session::lookupSession( const SessionID& sessionID )
 
 Session* Session::lookupSession( const std::string& string, bool reverse )
 {
-  Message message;
-  if ( !message.setStringHeader( string ) )
+  HeaderPeek peek;
+  if ( !peek.peek( string ) )
     return 0;
 
   try
   {
-    const Header& header = message.getHeader();
-    const BeginString& beginString = FIELD_GET_REF( header, BeginString );
-    const SenderCompID& senderCompID = FIELD_GET_REF( header, SenderCompID );
-    const TargetCompID& targetCompID = FIELD_GET_REF( header, TargetCompID );
+    BeginString beginString( peek.getField( FIELD::BeginString ) );
+    SenderCompID senderCompID( peek.getField( FIELD::SenderCompID ) );
+    TargetCompID targetCompID( peek.getField( FIELD::TargetCompID ) );
 
     if ( reverse )
     {
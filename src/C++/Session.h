@@ -35,6 +35,7 @@
 #include "Application.h"
 #include "Mutex.h"
 #include "Log.h"
+#include "HeaderTemplate.h"
 #include <utility>
 #include <map>
 #include <queue>
@@ -207,18 +208,73 @@ public:
   void setValidateLengthAndChecksum ( bool value )
     { m_validateLengthAndChecksum = value; }
 
+  bool getUseMessageView()
+    { return m_useMessageView; }
+  void setUseMessageView ( bool value )
+    { m_useMessageView = value; }
+
+  /// Clock the session reads the time from, owned by the engine
+  Clock& getClock()
+    { return *m_pClock; }
+  void setClock ( Clock& clock )
+    { m_pClock = &clock; m_state.setClock( clock ); }
+
+  bool getReuseInboundMessage()
+    { return m_reuseInboundMessage; }
+  void setReuseInboundMessage ( bool value )
+    { m_reuseInboundMessage = value; }
+
+  bool getLazyGroupDecoding()
+    { return m_lazyGroupDecoding; }
+  void setLazyGroupDecoding ( bool value )
+    { m_lazyGroupDecoding = value;
+      m_inboundMessage.setLazyGroups( value ); }
+
+  /// Only decode the body fields the profile names, see DecodeProfile
+  const DecodeProfile* getDecodeProfile()
+    { return m_pDecodeProfile; }
+  void setDecodeProfile ( const DecodeProfile& profile )
+    { m_decodeProfile = profile;
+      m_pDecodeProfile = m_decodeProfile.empty() ? 0 : &m_decodeProfile;
+      m_inboundMessage.setDecodeProfile( m_pDecodeProfile ); }
+
   void setResponder( Responder* pR )
   {
-    if( !checkSessionTime(UtcTimeStamp()) )
+    if( !checkSessionTime(m_pClock->now()) )
       reset();
     m_pResponder = pR;
   }
 
+  /**
+   * Send a message to the counterparty.
+   *
+   * The session sets MsgSeqNum and SendingTime on the header.  Unless the
+   * message already has them, BeginString, SenderCompID and TargetCompID
+   * are only set when a header changed by toApp or toAdmin has to be
+   * written out field by field; otherwise they appear on the wire but not
+   * on the message.
+   */
   bool send( Message& );
+  /**
+   * Send messages as one batch.
+   *
+   * Application messages get consecutive MsgSeqNums under one lock, are
+   * persisted with one MessageStore::setBatch call and are handed to the
+   * responder as one buffer.  Admin messages are sent on their own, in
+   * order with the others.
+   *
+   * @return false if any of the messages was not sent
+   */
+  bool send( std::vector < Message* > & messages );
   void next();
   void next( const UtcTimeStamp& timeStamp );
   void next( const std::string&, const UtcTimeStamp& timeStamp, bool queued = false );
   void next( const Message&, const UtcTimeStamp& timeStamp, bool queued = false );
+#ifdef HAVE_RVALUE_REFERENCES
+  /// Process a message that is moved, not copied, if it has to be queued
+  void next( Message&&, const UtcTimeStamp& timeStamp, bool queued = false );
+#endif
+  void next( const MessageView&, const UtcTimeStamp& timeStamp, bool queued = false );
   void disconnect();
 
   int getExpectedSenderNum() { return m_state.getNextSenderMsgSeqNum(); }
@@ -238,16 +294,17 @@ private:
   bool sendRaw( Message&, int msgSeqNum = 0 );
   bool resend( Message& message );
   void persist( const Message&, const std::string& ) EXCEPT ( IOException );
+  void sendBatch() EXCEPT ( IOException );
 
-  void insertSendingTime( Header& );
+  void insertSendingTime( Header&, const UtcTimeStamp& now );
   void insertOrigSendingTime( Header&,
                               const UtcTimeStamp& when = UtcTimeStamp () );
   void fill( Header& );
+  std::string& serialize( Message&, int msgSeqNum, std::string& );
 
-  bool isGoodTime( const SendingTime& sendingTime )
+  bool isGoodTime( const SendingTime& sendingTime, const UtcTimeStamp& now )
   {
     if ( !m_checkLatency ) return true;
-    UtcTimeStamp now;
     return labs( now - sendingTime ) <= m_maxLatency;
   }
   bool checkSessionTime( const UtcTimeStamp& timeStamp )
@@ -272,7 +329,7 @@ private:
 
   bool validLogonState( const MsgType& msgType );
   void fromCallback( const MsgType& msgType, const Message& msg,
-                     const SessionID& sessionID );
+                     const SessionID& sessionID, const MessageView* pView = 0 );
 
   void doBadTime( const Message& msg );
   void doBadCompID( const Message& msg );
@@ -281,6 +338,14 @@ private:
   void doTargetTooHigh( const Message& msg );
   void nextQueued( const UtcTimeStamp& timeStamp );
   bool nextQueued( int num, const UtcTimeStamp& timeStamp );
+  void next( const Message&, const MessageView* pView,
+             const UtcTimeStamp& timeStamp, bool queued );
+  void nextInbound( const std::string&, const DataDictionary& sessionDD,
+                    const DataDictionary& applicationDD,
+                    const UtcTimeStamp& timeStamp, bool queued );
+  void nextDecoded( const std::string&, const DataDictionary& sessionDD,
+                    const DataDictionary& applicationDD,
+                    const UtcTimeStamp& timeStamp, bool queued );
 
   void nextLogon( const Message&, const UtcTimeStamp& timeStamp );
   void nextHeartbeat( const Message&, const UtcTimeStamp& timeStamp );
@@ -305,8 +370,9 @@ private:
   void populateRejectReason( Message&, int field, const std::string& );
   void populateRejectReason( Message&, const std::string& );
 
-  bool verify( const Message& msg,
-               bool checkTooHigh = true, bool checkTooLow = true );
+  bool verify( const Message& msg, const UtcTimeStamp& timeStamp,
+               bool checkTooHigh = true, bool checkTooLow = true,
+               const MessageView* pView = 0 );
 
   bool set( int s, const Message& m );
   bool get( int s, Message& m ) const;
@@ -331,12 +397,36 @@ private:
   int m_timestampPrecision;
   bool m_persistMessages;
   bool m_validateLengthAndChecksum;
+  bool m_useMessageView;
+  bool m_reuseInboundMessage;
+  bool m_lazyGroupDecoding;
+  DecodeProfile m_decodeProfile;
+  // null when no profile is set
+  const DecodeProfile* m_pDecodeProfile;
 
   SessionState m_state;
   DataDictionaryProvider m_dataDictionaryProvider;
   MessageStoreFactory& m_messageStoreFactory;
   LogFactory* m_pLogFactory;
   Responder* m_pResponder;
+  // reused by sendRaw so that steady state sending does not allocate
+  std::string m_sendBuffer;
+  // messages serialized by send for a batch, reused the same way
+  std::vector < std::string > m_batch;
+  std::size_t m_batchSize;
+  // renders headers filled by fill without rebuilding the fixed fields
+  HeaderTemplate m_headerTemplate;
+  // formats SendingTime and OrigSendingTime, used with m_mutex held
+  UtcTimeStampCache m_timestamps;
+  // the SendingTime last set by insertSendingTime
+  char m_sendingTime[ UtcTimeStampConvertor::MAX_LENGTH ];
+  std::size_t m_sendingTimeLength;
+  // decoded into by next when m_reuseInboundMessage is set
+  Message m_inboundMessage;
+  bool m_inboundInUse;
+  // the message being processed that doTargetTooHigh may move
+  Message* m_pMovableMessage;
+  Clock* m_pClock;
   Mutex m_mutex;
 
   static Sessions s_sessions;
@@ -196,6 +196,20 @@ Session* SessionFactory::create( const SessionID& sessionID,
     pSession->setPersistMessages( settings.getBool( PERSIST_MESSAGES ) );
   if ( settings.has( VALIDATE_LENGTH_AND_CHECKSUM ) )
     pSession->setValidateLengthAndChecksum( settings.getBool( VALIDATE_LENGTH_AND_CHECKSUM ) );
+  if ( settings.has( USE_MESSAGE_VIEW ) )
+    pSession->setUseMessageView( settings.getBool( USE_MESSAGE_VIEW ) );
+  if ( settings.has( REUSE_INBOUND_MESSAGE ) )
+    pSession->setReuseInboundMessage( settings.getBool( REUSE_INBOUND_MESSAGE ) );
+  if ( settings.has( LAZY_GROUP_DECODING ) )
+    pSession->setLazyGroupDecoding( settings.getBool( LAZY_GROUP_DECODING ) );
+  if ( settings.has( DECODE_PROFILE ) )
+  {
+    DecodeProfile profile;
+    profile.read( settings.getString( DECODE_PROFILE ) );
+    pSession->setDecodeProfile( profile );
+  }
+  if ( m_pClock )
+    pSession->setClock( *m_pClock );
    
   return pSession.release();
 }
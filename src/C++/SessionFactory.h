@@ -48,10 +48,12 @@ class SessionFactory
 public:
   SessionFactory( Application& application,
                   MessageStoreFactory& messageStoreFactory,
-                  LogFactory* pLogFactory )
+                  LogFactory* pLogFactory,
+                  Clock* pClock = 0 )
 : m_application( application ),
   m_messageStoreFactory( messageStoreFactory ),
-  m_pLogFactory( pLogFactory ) {}
+  m_pLogFactory( pLogFactory ),
+  m_pClock( pClock ) {}
 
   ~SessionFactory();
 
@@ -79,6 +81,7 @@ private:
   Application& m_application;
   MessageStoreFactory& m_messageStoreFactory;
   LogFactory* m_pLogFactory;
+  Clock* m_pClock;
   Dictionaries m_dictionaries;
 };
 }
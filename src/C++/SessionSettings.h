@@ -66,10 +66,16 @@ const char SOCKET_CONNECT_PORT[] = "SocketConnectPort";
 const char SOCKET_CONNECT_SOURCE_HOST[] = "SocketConnectSourceHost";
 const char SOCKET_CONNECT_SOURCE_PORT[] = "SocketConnectSourcePort";
 const char SOCKET_NODELAY[] = "SocketNodelay";
+const char SOCKET_USE_EPOLL[] = "SocketUseEpoll";
 const char SOCKET_SEND_BUFFER_SIZE[] = "SocketSendBufferSize";
 const char SOCKET_RECEIVE_BUFFER_SIZE[] = "SocketReceiveBufferSize";
 const char RECONNECT_INTERVAL[] = "ReconnectInterval";
 const char VALIDATE_LENGTH_AND_CHECKSUM[] = "ValidateLengthAndChecksum";
+const char USE_MESSAGE_VIEW[] = "UseMessageView";
+const char REUSE_INBOUND_MESSAGE[] = "ReuseInboundMessage";
+const char LAZY_GROUP_DECODING[] = "LazyGroupDecoding";
+const char DECODE_PROFILE[] = "DecodeProfile";
+const char CLOCK_SOURCE[] = "ClockSource";
 const char VALIDATE_FIELDS_OUT_OF_ORDER[] = "ValidateFieldsOutOfOrder";
 const char VALIDATE_FIELDS_HAVE_VALUES[] = "ValidateFieldsHaveValues";
 const char VALIDATE_USER_DEFINED_FIELDS[] = "ValidateUserDefinedFields";
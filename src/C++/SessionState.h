@@ -115,34 +115,40 @@ public:
   bool shouldSendLogon() const { return initiate() && !sentLogon(); }
   bool alreadySentLogon() const { return initiate() && sentLogon(); }
   bool logonTimedOut() const
+  { return logonTimedOut( UtcTimeStamp() ); }
+  bool logonTimedOut( const UtcTimeStamp& now ) const
   {
-    UtcTimeStamp now;
     return now - lastReceivedTime() >= logonTimeout();
   }
   bool logoutTimedOut() const
+  { return logoutTimedOut( UtcTimeStamp() ); }
+  bool logoutTimedOut( const UtcTimeStamp& now ) const
   {
-    UtcTimeStamp now;
     return sentLogout() && ( ( now - lastSentTime() ) >= logoutTimeout() );
   }
   bool withinHeartBeat() const
+  { return withinHeartBeat( UtcTimeStamp() ); }
+  bool withinHeartBeat( const UtcTimeStamp& now ) const
   {
-    UtcTimeStamp now;
     return ( ( now - lastSentTime() ) < heartBtInt() ) &&
            ( ( now - lastReceivedTime() ) < heartBtInt() );
   }
   bool timedOut() const
+  { return timedOut( UtcTimeStamp() ); }
+  bool timedOut( const UtcTimeStamp& now ) const
   {
-    UtcTimeStamp now;
     return ( now - lastReceivedTime() ) >= ( 2.4 * ( double ) heartBtInt() );
   }
   bool needHeartbeat() const
+  { return needHeartbeat( UtcTimeStamp() ); }
+  bool needHeartbeat( const UtcTimeStamp& now ) const
   {
-    UtcTimeStamp now;
     return ( ( now - lastSentTime() ) >= heartBtInt() ) && !testRequest();
   }
   bool needTestRequest() const
+  { return needTestRequest( UtcTimeStamp() ); }
+  bool needTestRequest( const UtcTimeStamp& now ) const
   {
-    UtcTimeStamp now;
     return ( now - lastReceivedTime() ) >=
            ( ( 1.2 * ( ( double ) testRequest() + 1 ) ) * ( double ) heartBtInt() );
   }
@@ -154,13 +160,28 @@ public:
 
   void queue( int msgSeqNum, const Message& message )
   { Locker l( m_mutex ); m_queue[ msgSeqNum ] = message; }
+#ifdef HAVE_RVALUE_REFERENCES
+  void queue( int msgSeqNum, Message&& message )
+  {
+    Locker l( m_mutex );
+    Messages::iterator i = m_queue.find( msgSeqNum );
+    if ( i != m_queue.end() )
+      i->second = std::move( message );
+    else
+      m_queue.insert( std::make_pair( msgSeqNum, std::move( message ) ) );
+  }
+#endif
   bool retrieve( int msgSeqNum, Message& message )
   {
     Locker l( m_mutex );
     Messages::iterator i = m_queue.find( msgSeqNum );
     if ( i != m_queue.end() )
     {
+#ifdef HAVE_RVALUE_REFERENCES
+      message = std::move( i->second );
+#else
       message = i->second;
+#endif
       m_queue.erase( i );
       return true;
     }
@@ -171,6 +192,8 @@ public:
 
   bool set( int s, const std::string& m ) EXCEPT ( IOException )
   { Locker l( m_mutex ); return m_pStore->set( s, m ); }
+  bool setBatch( int s, const std::vector < std::string > & m ) EXCEPT ( IOException )
+  { Locker l( m_mutex ); return m_pStore->setBatch( s, m ); }
   void get( int b, int e, std::vector < std::string > &m ) const
   EXCEPT ( IOException )
   { Locker l( m_mutex ); m_pStore->get( b, e, m ); }
@@ -203,6 +226,8 @@ public:
   { if ( !m_pLog ) return ; Locker l( m_mutex ); m_pLog->onOutgoing( string ); }
   void onEvent( const std::string& string )
   { if ( !m_pLog ) return ; Locker l( m_mutex ); m_pLog->onEvent( string ); }
+  void setClock( Clock& clock )
+  { if ( !m_pLog ) return ; Locker l( m_mutex ); m_pLog->setClock( clock ); }
 
 private:
   bool m_enabled;
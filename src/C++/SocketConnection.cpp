@@ -154,7 +154,7 @@ bool SocketConnection::read( SocketAcceptor& a, SocketServer& s )
       if( m_pSession )
         m_pSession = a.getSession( msg, *this );
       if( m_pSession )
-        m_pSession->next( msg, UtcTimeStamp() );
+        m_pSession->next( msg, m_pSession->getClock().now() );
       if( !m_pSession )
       {
         s.getMonitor().drop( m_socket );
@@ -197,9 +197,11 @@ bool SocketConnection::isValidSession()
 void SocketConnection::readFromSocket()
 EXCEPT ( SocketRecvFailed )
 {
-  ssize_t size = socket_recv( m_socket, m_buffer, sizeof(m_buffer) );
+  std::size_t length = 0;
+  char* buffer = m_parser.getBuffer( length );
+  ssize_t size = socket_recv( m_socket, buffer, length );
   if( size <= 0 ) throw SocketRecvFailed( size );
-  m_parser.addToStream( m_buffer, size );
+  m_parser.commit( size );
 }
 
 bool SocketConnection::readMessage( std::string& msg )
@@ -216,12 +218,14 @@ void SocketConnection::readMessages( SocketMonitor& s )
 {
   if( !m_pSession ) return;
 
+  // every message taken from one recv is processed with the same time
+  UtcTimeStamp now = m_pSession->getClock().now();
   std::string msg;
   while( readMessage( msg ) )
   {
     try
     {
-      m_pSession->next( msg, UtcTimeStamp() );
+      m_pSession->next( msg, now );
     }
     catch ( InvalidMessage& )
     {
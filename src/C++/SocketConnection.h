@@ -87,7 +87,6 @@ private:
   void disconnect();
 
   socket_handle m_socket;
-  char m_buffer[BUFSIZ];
 
   Parser m_parser;
   Queue m_sendQueue;
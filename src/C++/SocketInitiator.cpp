@@ -77,6 +77,9 @@ EXCEPT ( ConfigError )
     m_sendBufSize = dict.getInt( SOCKET_SEND_BUFFER_SIZE );
   if( dict.has( SOCKET_RECEIVE_BUFFER_SIZE ) )
     m_rcvBufSize = dict.getInt( SOCKET_RECEIVE_BUFFER_SIZE );
+  if( dict.has( SOCKET_USE_EPOLL ) && dict.getBool( SOCKET_USE_EPOLL )
+      && !m_connector.getMonitor().useEpoll() && getLog() )
+    getLog()->onEvent( "epoll is not available, using select" );
 }
 
 void SocketInitiator::onInitialize( const SessionSettings& s )
@@ -138,7 +141,7 @@ void SocketInitiator::doConnect( const SessionID& s, const Dictionary& d )
     short sourcePort = 0;
 
     Session* session = Session::lookupSession( s );
-    if( !session->isSessionTime(UtcTimeStamp()) ) return;
+    if( !session->isSessionTime(session->getClock().now()) ) return;
 
     Log* log = session->getLog();
 
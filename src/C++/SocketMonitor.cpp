@@ -29,11 +29,16 @@
 #include <set>
 #include <algorithm>
 #include <iostream>
+#ifdef HAVE_EPOLL
+#include <sys/epoll.h>
+#include <errno.h>
+#include <unistd.h>
+#endif
 
 namespace FIX
 {
 SocketMonitor::SocketMonitor( int timeout )
-: m_timeout( timeout )
+: m_timeout( timeout ), m_epoll( -1 )
 {
   socket_init();
 
@@ -59,6 +64,10 @@ SocketMonitor::~SocketMonitor()
   }
 
   socket_close( m_signal );
+#ifdef HAVE_EPOLL
+  if ( m_epoll != -1 )
+    ::close( m_epoll );
+#endif
   socket_term();
 }
 
@@ -69,6 +78,7 @@ bool SocketMonitor::addConnect(socket_handle s )
   if( i != m_connectSockets.end() ) return false;
 
   m_connectSockets.insert( s );
+  updateEpoll( s );
   return true;
 }
 
@@ -79,6 +89,7 @@ bool SocketMonitor::addRead(socket_handle s )
   if( i != m_readSockets.end() ) return false;
 
   m_readSockets.insert( s );
+  updateEpoll( s );
   return true;
 }
 
@@ -92,6 +103,7 @@ bool SocketMonitor::addWrite(socket_handle s )
   if( i != m_writeSockets.end() ) return false;
 
   m_writeSockets.insert( s );
+  updateEpoll( s );
   return true;
 }
 
@@ -105,10 +117,11 @@ bool SocketMonitor::drop(socket_handle s )
        j != m_writeSockets.end() ||
        k != m_connectSockets.end() )
   {
-    socket_close( s );
     m_readSockets.erase( s );
     m_writeSockets.erase( s );
     m_connectSockets.erase( s );
+    updateEpoll( s );
+    socket_close( s );
     m_dropped.push( s );
     return true;
   }
@@ -176,6 +189,7 @@ void SocketMonitor::unsignal(socket_handle s )
   if( i == m_writeSockets.end() ) return;
 
   m_writeSockets.erase( s );
+  updateEpoll( s );
 }
 
 void SocketMonitor::block( Strategy& strategy, bool poll, double timeout )
@@ -188,6 +202,18 @@ void SocketMonitor::block( Strategy& strategy, bool poll, double timeout )
       return ;
   }
 
+  if ( sleepIfEmpty(poll) )
+  {
+    strategy.onTimeout( *this );
+    return;
+  }
+
+  if ( isEpoll() )
+  {
+    blockEpoll( strategy, getTimeval(poll, timeout) );
+    return;
+  }
+
   fd_set readSet;
   FD_ZERO( &readSet );
   buildSet( m_readSockets, readSet );
@@ -199,12 +225,6 @@ void SocketMonitor::block( Strategy& strategy, bool poll, double timeout )
   FD_ZERO( &exceptSet );
   buildSet( m_connectSockets, exceptSet );
 
-  if ( sleepIfEmpty(poll) )
-  {
-    strategy.onTimeout( *this );
-    return;
-  }
-
   int result = select( FD_SETSIZE, &readSet, &writeSet, &exceptSet, getTimeval(poll, timeout) );
 
   if ( result == 0 )
@@ -325,6 +345,144 @@ void SocketMonitor::processExceptSet( Strategy& strategy, fd_set& exceptSet )
 #endif
 }
 
+bool SocketMonitor::useEpoll()
+{
+#ifdef HAVE_EPOLL
+  if ( m_epoll != -1 )
+    return true;
+
+  m_epoll = epoll_create1( EPOLL_CLOEXEC );
+  if ( m_epoll == -1 )
+    return false;
+
+  Sockets sockets = m_readSockets;
+  sockets.insert( m_writeSockets.begin(), m_writeSockets.end() );
+  sockets.insert( m_connectSockets.begin(), m_connectSockets.end() );
+  Sockets::iterator i;
+  for ( i = sockets.begin(); i != sockets.end(); ++i )
+    updateEpoll( *i );
+  return true;
+#else
+  return false;
+#endif
+}
+
+void SocketMonitor::updateEpoll( socket_handle s )
+{
+#ifdef HAVE_EPOLL
+  if ( m_epoll == -1 )
+    return;
+
+  epoll_event event;
+  event.events = 0;
+  event.data.fd = s;
+  if ( m_readSockets.find( s ) != m_readSockets.end() )
+    event.events |= EPOLLIN;
+  if ( m_writeSockets.find( s ) != m_writeSockets.end() )
+    event.events |= EPOLLOUT;
+  if ( m_connectSockets.find( s ) != m_connectSockets.end() )
+    event.events |= EPOLLOUT | EPOLLPRI;
+
+  if ( !event.events )
+    epoll_ctl( m_epoll, EPOLL_CTL_DEL, s, &event );
+  else if ( epoll_ctl( m_epoll, EPOLL_CTL_MOD, s, &event ) == -1
+            && errno == ENOENT )
+    epoll_ctl( m_epoll, EPOLL_CTL_ADD, s, &event );
+#endif
+}
+
+void SocketMonitor::blockEpoll( Strategy& strategy, timeval* pTimeval )
+{
+#ifdef HAVE_EPOLL
+  int timeout = -1;
+  if ( pTimeval )
+    timeout = (int)( pTimeval->tv_sec * 1000 + ( pTimeval->tv_usec + 999 ) / 1000 );
+
+#ifdef SELECT_MODIFIES_TIMEVAL
+  timeval start;
+  gettimeofday( &start, 0 );
+#endif
+
+  epoll_event events[ 256 ];
+  int result = epoll_wait( m_epoll, events, 256, timeout );
+
+#ifdef SELECT_MODIFIES_TIMEVAL
+  // count the timeout down the way select does
+  if ( pTimeval )
+  {
+    timeval now;
+    gettimeofday( &now, 0 );
+    long remaining = pTimeval->tv_sec * 1000000 + pTimeval->tv_usec
+      - ( now.tv_sec - start.tv_sec ) * 1000000 - ( now.tv_usec - start.tv_usec );
+    if ( result == 0 || remaining < 0 )
+      remaining = 0;
+    pTimeval->tv_sec = remaining / 1000000;
+    pTimeval->tv_usec = remaining % 1000000;
+  }
+#endif
+
+  if ( result == 0 )
+  {
+    strategy.onTimeout( *this );
+    return;
+  }
+  else if ( result < 0 )
+  {
+    strategy.onError( *this );
+    return;
+  }
+
+  // same order as select: failed connects, writes, then reads
+  int i;
+  for ( i = 0; i < result; ++i )
+  {
+    socket_handle s = events[ i ].data.fd;
+    if ( ( events[ i ].events & EPOLLPRI )
+         && m_connectSockets.find( s ) != m_connectSockets.end() )
+      strategy.onError( *this, s );
+  }
+
+  for ( i = 0; i < result; ++i )
+  {
+    socket_handle s = events[ i ].data.fd;
+    if ( !( events[ i ].events & ( EPOLLOUT | EPOLLERR | EPOLLHUP ) ) )
+      continue;
+    if ( m_connectSockets.find( s ) != m_connectSockets.end() )
+    {
+      m_connectSockets.erase( s );
+      m_readSockets.insert( s );
+      updateEpoll( s );
+      // select would not report it readable until the next block
+      events[ i ].events = 0;
+      strategy.onConnect( *this, s );
+    }
+    else if ( m_writeSockets.find( s ) != m_writeSockets.end() )
+    {
+      strategy.onWrite( *this, s );
+    }
+  }
+
+  for ( i = 0; i < result; ++i )
+  {
+    socket_handle s = events[ i ].data.fd;
+    if ( !( events[ i ].events & ( EPOLLIN | EPOLLERR | EPOLLHUP ) ) )
+      continue;
+    if ( m_readSockets.find( s ) == m_readSockets.end() )
+      continue;
+    if( s == m_interrupt )
+    {
+      socket_handle socket = 0;
+      socket_recv( s, (char*)&socket, sizeof(socket) );
+      addWrite( socket );
+    }
+    else
+    {
+      strategy.onEvent( *this, s );
+    }
+  }
+#endif
+}
+
 void SocketMonitor::buildSet( const Sockets& sockets, fd_set& watchSet )
 {
   Sockets::const_iterator iter;
@@ -45,7 +45,14 @@ typedef int socklen_t;
 
 namespace FIX
 {
-/// Monitors events on a collection of sockets.
+/**
+ * Monitors events on a collection of sockets.
+ *
+ * Sockets are watched with select unless useEpoll() is called.  With
+ * epoll, interest in a socket is registered once when it is added and
+ * each block only visits the sockets that are ready, so its cost does
+ * not grow with the number of idle connections.
+ */
 class SocketMonitor
 {
 public:
@@ -62,6 +69,10 @@ public:
   void unsignal(socket_handle socket );
   void block( Strategy& strategy, bool poll = 0, double timeout = 0.0 );
 
+  /// Watch sockets with epoll, false if it is not available
+  bool useEpoll();
+  bool isEpoll() const { return m_epoll != -1; }
+
   size_t numSockets() 
   { return m_readSockets.size() - 1; }
 
@@ -80,6 +91,9 @@ private:
   void processWriteSet( Strategy&, fd_set& );
   void processExceptSet( Strategy&, fd_set& );
 
+  void updateEpoll( socket_handle );
+  void blockEpoll( Strategy&, timeval* );
+
   int m_timeout;
   timeval m_timeval;
 #ifndef SELECT_DECREMENTS_TIME
@@ -92,6 +106,7 @@ private:
   Sockets m_readSockets;
   Sockets m_writeSockets;
   Queue m_dropped;
+  int m_epoll;
 
 public:
   class Strategy
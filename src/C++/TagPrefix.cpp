@@ -0,0 +1,51 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "TagPrefix.h"
+
+namespace FIX
+{
+TagPrefix::entry TagPrefix::s_entries[ TagPrefix::MAX_TAG + 1 ];
+
+struct TagPrefixRenderer
+{
+  TagPrefixRenderer()
+  {
+    for ( int tag = 0; tag <= TagPrefix::MAX_TAG; ++tag )
+    {
+      TagPrefix::entry& prefix = TagPrefix::s_entries[ tag ];
+      std::size_t length = TagPrefix::render( prefix.text, tag );
+      prefix.total = (unsigned short)TagPrefix::sum( prefix.text, length );
+      // written last, a zero length sends lookups down the slow path
+      prefix.length = (unsigned char)length;
+    }
+  }
+};
+
+namespace
+{
+TagPrefixRenderer s_renderer;
+}
+}
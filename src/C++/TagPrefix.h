@@ -0,0 +1,119 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifndef FIX_TAGPREFIX_H
+#define FIX_TAGPREFIX_H
+
+#include "FieldNumbers.h"
+#include "FieldConvertors.h"
+#include <cstring>
+#include <string>
+
+namespace FIX
+{
+/**
+ * Pre-rendered "tag=" prefixes used when serializing fields.
+ *
+ * Prefixes for every standard and user defined tag are rendered once at
+ * startup along with the sum of their bytes, so the encoder copies them
+ * instead of converting the tag for each field.  Other tags are rendered
+ * when they are used.
+ */
+class TagPrefix
+{
+public:
+  /// Largest tag with a pre-rendered prefix
+  static const int MAX_TAG = FIELD::UserMax;
+  /// Room needed by write() for any tag
+  static const int MAX_LENGTH = 12;
+
+  /// Length of "tag="
+  static std::size_t length( int tag )
+  {
+    if ( isRendered( tag ) )
+      return s_entries[ tag ].length;
+    return number_of_symbols_in( tag ) + 1;
+  }
+
+  /// Sum of the bytes in "tag="
+  static int total( int tag )
+  {
+    if ( isRendered( tag ) )
+      return s_entries[ tag ].total;
+    char buffer[ MAX_LENGTH ];
+    return sum( buffer, render( buffer, tag ) );
+  }
+
+  /// Write "tag=" to buffer and return its length
+  static std::size_t write( char* buffer, int tag )
+  {
+    if ( isRendered( tag ) )
+    {
+      const entry& prefix = s_entries[ tag ];
+      memcpy( buffer, prefix.text, prefix.length );
+      return prefix.length;
+    }
+    return render( buffer, tag );
+  }
+
+  /// Append "tag=" to result
+  static void appendTo( std::string& result, int tag )
+  {
+    char buffer[ MAX_LENGTH ];
+    result.append( buffer, write( buffer, tag ) );
+  }
+
+private:
+  struct entry
+  {
+    char text[ 5 ];
+    unsigned char length;
+    unsigned short total;
+  };
+
+  friend struct TagPrefixRenderer;
+
+  /// Entries are zero until rendered at startup
+  static bool isRendered( int tag )
+  { return tag >= 0 && tag <= MAX_TAG && s_entries[ tag ].length; }
+
+  static std::size_t render( char* buffer, int tag )
+  {
+    std::size_t tagLength = number_of_symbols_in( tag );
+    integer_to_string( buffer, tagLength, tag );
+    buffer[ tagLength ] = '=';
+    return tagLength + 1;
+  }
+
+  static int sum( const char* buffer, std::size_t length )
+  {
+    int result = 0;
+    for ( std::size_t i = 0; i < length; ++i )
+      result += (unsigned char)buffer[ i ];
+    return result;
+  }
+
+  static entry s_entries[ MAX_TAG + 1 ];
+};
+}
+
+#endif //FIX_TAGPREFIX_H
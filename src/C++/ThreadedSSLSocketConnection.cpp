@@ -246,7 +246,9 @@ bool ThreadedSSLSocketConnection::read()
         {
           Locker locker(m_mutex);
 
-          size = SSL_read(m_ssl, m_buffer, sizeof(m_buffer));
+          std::size_t length = 0;
+          char* buffer = m_parser.getBuffer(length);
+          size = SSL_read(m_ssl, buffer, (int)length);
           if (size <= 0)
             errCodeSSL = SSL_get_error(m_ssl, size);
           else if (SSL_pending(m_ssl) > 0)
@@ -285,7 +287,7 @@ bool ThreadedSSLSocketConnection::read()
           }
         }
 
-        m_parser.addToStream(m_buffer, size);
+        m_parser.commit(size);
       } while (pending);
     }
     else if (result == 0 && m_pSession) // Timeout
@@ -337,6 +339,10 @@ bool ThreadedSSLSocketConnection::readMessage(std::string &msg) EXCEPT (SocketRe
 
 void ThreadedSSLSocketConnection::processStream()
 {
+  // every message taken from one recv is processed with the same time,
+  // read once the session and so its clock is known
+  UtcTimeStamp now(0, 0, 0, 1, 1, 1970);
+  bool timed = false;
   std::string msg;
   while (readMessage(msg))
   {
@@ -348,9 +354,14 @@ void ThreadedSSLSocketConnection::processStream()
         continue;
       }
     }
+    if (!timed)
+    {
+      now = m_pSession->getClock().now();
+      timed = true;
+    }
     try
     {
-      m_pSession->next(msg, UtcTimeStamp());
+      m_pSession->next(msg, now);
     }
     catch (InvalidMessage &)
     {
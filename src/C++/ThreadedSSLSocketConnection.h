@@ -168,7 +168,6 @@ private:
 
   socket_handle m_socket;
   SSL *m_ssl;
-  char m_buffer[BUFSIZ];
 
   std::string m_address;
   int m_port;
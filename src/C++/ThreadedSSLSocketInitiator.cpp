@@ -286,7 +286,7 @@ void ThreadedSSLSocketInitiator::doConnect(const SessionID &s,
   try
   {
     Session *session = Session::lookupSession(s);
-    if (!session->isSessionTime(UtcTimeStamp()))
+    if (!session->isSessionTime(session->getClock().now()))
       return;
 
     Log *log = session->getLog();
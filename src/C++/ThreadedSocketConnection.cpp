@@ -71,7 +71,7 @@ bool ThreadedSocketConnection::send( const std::string& msg )
   int totalSent = 0;
   while(totalSent < (int)msg.length())
   {
-    ssize_t sent = socket_send( m_socket, msg.c_str() + totalSent, msg.length() );
+    ssize_t sent = socket_send( m_socket, msg.c_str() + totalSent, msg.length() - totalSent );
     if(sent < 0) return false;
     totalSent += sent;
   }
@@ -107,9 +107,11 @@ bool ThreadedSocketConnection::read()
     if( result > 0 ) // Something to read
     {
       // We can read without blocking
-      ssize_t size = socket_recv( m_socket, m_buffer, sizeof(m_buffer) );
+      std::size_t length = 0;
+      char* buffer = m_parser.getBuffer( length );
+      ssize_t size = socket_recv( m_socket, buffer, length );
       if ( size <= 0 ) { throw SocketRecvFailed( size ); }
-      m_parser.addToStream( m_buffer, size );
+      m_parser.commit( size );
     }
     else if( result == 0 && m_pSession ) // Timeout
     {
@@ -155,6 +157,10 @@ EXCEPT ( SocketRecvFailed )
 
 void ThreadedSocketConnection::processStream()
 {
+  // every message taken from one recv is processed with the same time,
+  // read once the session and so its clock is known
+  UtcTimeStamp now( 0, 0, 0, 1, 1, 1970 );
+  bool timed = false;
   std::string msg;
   while( readMessage(msg) )
   {
@@ -163,9 +169,14 @@ void ThreadedSocketConnection::processStream()
       if ( !setSession( msg ) )
       { disconnect(); continue; }
     }
+    if ( !timed )
+    {
+      now = m_pSession->getClock().now();
+      timed = true;
+    }
     try
     {
-      m_pSession->next( msg, UtcTimeStamp() );
+      m_pSession->next( msg, now );
     }
     catch( InvalidMessage& )
     {
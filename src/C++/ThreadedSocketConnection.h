@@ -66,7 +66,6 @@ private:
   bool setSession( const std::string& msg );
 
   socket_handle m_socket;
-  char m_buffer[BUFSIZ];
 
   std::string m_address;
   int m_port;
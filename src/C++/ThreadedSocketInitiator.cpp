@@ -135,7 +135,7 @@ void ThreadedSocketInitiator::doConnect( const SessionID& s, const Dictionary& d
   try
   {
     Session* session = Session::lookupSession( s );
-    if( !session->isSessionTime(UtcTimeStamp()) ) return;
+    if( !session->isSessionTime(session->getClock().now()) ) return;
 
     Log* log = session->getLog();
 
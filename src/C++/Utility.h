@@ -113,6 +113,15 @@ typedef int socket_handle;
 #include <cstdlib>
 #include <memory>
 
+#if !defined(HAVE_RVALUE_REFERENCES) \
+    && ( __cplusplus >= 201103L || ( defined(_MSC_VER) && _MSC_VER >= 1900 ) )
+#define HAVE_RVALUE_REFERENCES 1
+#endif
+
+#ifdef HAVE_RVALUE_REFERENCES
+#include <utility>
+#endif
+
 #if !defined(HAVE_STD_UNIQUE_PTR)
 #define SmartPtr std::auto_ptr
 #else
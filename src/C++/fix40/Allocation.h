@@ -12,7 +12,6 @@ namespace FIX40
     Allocation() : Message(MsgType()) {}
     Allocation(const FIX::Message& m) : Message(m) {}
     Allocation(const Message& m) : Message(m) {}
-    Allocation(const Allocation& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("J"); }
 
     Allocation(
@@ -61,7 +60,12 @@ namespace FIX40
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,37,66,105,0)) {}
+    NoOrders() : FIX::Group(73,11,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{11,1},{37,2},{66,3},{105,4}};
+      return order;
+    }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::OrderID);
       FIELD_SET(*this, FIX::ListID);
@@ -71,7 +75,12 @@ namespace FIX40
     class NoExecs: public FIX::Group
     {
     public:
-    NoExecs() : FIX::Group(124,17,FIX::message_order(17,32,31,30,0)) {}
+    NoExecs() : FIX::Group(124,17,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{17,1},{30,4},{31,3},{32,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::ExecID);
       FIELD_SET(*this, FIX::LastShares);
       FIELD_SET(*this, FIX::LastPx);
@@ -81,7 +90,12 @@ namespace FIX40
     class NoMiscFees: public FIX::Group
     {
     public:
-    NoMiscFees() : FIX::Group(136,137,FIX::message_order(137,138,139,0)) {}
+    NoMiscFees() : FIX::Group(136,137,FIX::message_order(fieldOrder(),3)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{137,1},{138,2},{139,3}};
+      return order;
+    }
       FIELD_SET(*this, FIX::MiscFeeAmt);
       FIELD_SET(*this, FIX::MiscFeeCurr);
       FIELD_SET(*this, FIX::MiscFeeType);
@@ -90,7 +104,12 @@ namespace FIX40
     class NoAllocs: public FIX::Group
     {
     public:
-    NoAllocs() : FIX::Group(78,79,FIX::message_order(79,80,81,76,109,12,13,85,92,86,0)) {}
+    NoAllocs() : FIX::Group(78,79,FIX::message_order(fieldOrder(),10)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{12,6},{13,7},{76,4},{79,1},{80,2},{81,3},{85,8},{86,10},{92,9},{109,5}};
+      return order;
+    }
       FIELD_SET(*this, FIX::AllocAccount);
       FIELD_SET(*this, FIX::AllocShares);
       FIELD_SET(*this, FIX::ProcessCode);
@@ -12,7 +12,6 @@ namespace FIX40
     Email() : Message(MsgType()) {}
     Email(const FIX::Message& m) : Message(m) {}
     Email(const Message& m) : Message(m) {}
-    Email(const Email& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("C"); }
 
     Email(
@@ -12,7 +12,6 @@ namespace FIX40
     ExecutionReport() : Message(MsgType()) {}
     ExecutionReport(const FIX::Message& m) : Message(m) {}
     ExecutionReport(const Message& m) : Message(m) {}
-    ExecutionReport(const ExecutionReport& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("8"); }
 
     ExecutionReport(
@@ -90,7 +89,12 @@ namespace FIX40
     class NoMiscFees: public FIX::Group
     {
     public:
-    NoMiscFees() : FIX::Group(136,137,FIX::message_order(137,138,139,0)) {}
+    NoMiscFees() : FIX::Group(136,137,FIX::message_order(fieldOrder(),3)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{137,1},{138,2},{139,3}};
+      return order;
+    }
       FIELD_SET(*this, FIX::MiscFeeAmt);
       FIELD_SET(*this, FIX::MiscFeeCurr);
       FIELD_SET(*this, FIX::MiscFeeType);
@@ -12,7 +12,6 @@ namespace FIX40
     IOI() : Message(MsgType()) {}
     IOI(const FIX::Message& m) : Message(m) {}
     IOI(const Message& m) : Message(m) {}
-    IOI(const IOI& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("6"); }
 
     IOI(
@@ -12,7 +12,6 @@ namespace FIX40
     Logon() : Message(MsgType()) {}
     Logon(const FIX::Message& m) : Message(m) {}
     Logon(const Message& m) : Message(m) {}
-    Logon(const Logon& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("A"); }
 
     Logon(
@@ -152,180 +152,131 @@ public:
   void crack( const Message& message, 
               const FIX::SessionID& sessionID )
   {
-    const std::string& msgTypeValue 
-      = message.getHeader().getField( FIX::FIELD::MsgType );
-    
-    if( msgTypeValue == "0" )
-      onMessage( (const Heartbeat&)message, sessionID );
-    else
-    if( msgTypeValue == "1" )
-      onMessage( (const TestRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "2" )
-      onMessage( (const ResendRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "3" )
-      onMessage( (const Reject&)message, sessionID );
-    else
-    if( msgTypeValue == "4" )
-      onMessage( (const SequenceReset&)message, sessionID );
-    else
-    if( msgTypeValue == "5" )
-      onMessage( (const Logout&)message, sessionID );
-    else
-    if( msgTypeValue == "6" )
-      onMessage( (const IOI&)message, sessionID );
-    else
-    if( msgTypeValue == "7" )
-      onMessage( (const Advertisement&)message, sessionID );
-    else
-    if( msgTypeValue == "8" )
-      onMessage( (const ExecutionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "9" )
-      onMessage( (const OrderCancelReject&)message, sessionID );
-    else
-    if( msgTypeValue == "A" )
-      onMessage( (const Logon&)message, sessionID );
-    else
-    if( msgTypeValue == "B" )
-      onMessage( (const News&)message, sessionID );
-    else
-    if( msgTypeValue == "C" )
-      onMessage( (const Email&)message, sessionID );
-    else
-    if( msgTypeValue == "D" )
-      onMessage( (const NewOrderSingle&)message, sessionID );
-    else
-    if( msgTypeValue == "E" )
-      onMessage( (const NewOrderList&)message, sessionID );
-    else
-    if( msgTypeValue == "F" )
-      onMessage( (const OrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "G" )
-      onMessage( (const OrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "H" )
-      onMessage( (const OrderStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "J" )
-      onMessage( (const Allocation&)message, sessionID );
-    else
-    if( msgTypeValue == "K" )
-      onMessage( (const ListCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "L" )
-      onMessage( (const ListExecute&)message, sessionID );
-    else
-    if( msgTypeValue == "M" )
-      onMessage( (const ListStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "N" )
-      onMessage( (const ListStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "P" )
-      onMessage( (const AllocationInstructionAck&)message, sessionID );
-    else
-    if( msgTypeValue == "Q" )
-      onMessage( (const DontKnowTrade&)message, sessionID );
-    else
-    if( msgTypeValue == "R" )
-      onMessage( (const QuoteRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "S" )
-      onMessage( (const Quote&)message, sessionID );
-    else onMessage( message, sessionID );
+    switch( FIX::Message::msgTypeId(
+      message.getHeader().getField( FIX::FIELD::MsgType ) ) )
+    {
+    case FIX_MSGTYPE_ID( '0', 0 ):
+      onMessage( (const Heartbeat&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '1', 0 ):
+      onMessage( (const TestRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '2', 0 ):
+      onMessage( (const ResendRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '3', 0 ):
+      onMessage( (const Reject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '4', 0 ):
+      onMessage( (const SequenceReset&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '5', 0 ):
+      onMessage( (const Logout&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '6', 0 ):
+      onMessage( (const IOI&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '7', 0 ):
+      onMessage( (const Advertisement&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '8', 0 ):
+      onMessage( (const ExecutionReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '9', 0 ):
+      onMessage( (const OrderCancelReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 0 ):
+      onMessage( (const Logon&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 0 ):
+      onMessage( (const News&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'C', 0 ):
+      onMessage( (const Email&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'D', 0 ):
+      onMessage( (const NewOrderSingle&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'E', 0 ):
+      onMessage( (const NewOrderList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'F', 0 ):
+      onMessage( (const OrderCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'G', 0 ):
+      onMessage( (const OrderCancelReplaceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'H', 0 ):
+      onMessage( (const OrderStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'J', 0 ):
+      onMessage( (const Allocation&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'K', 0 ):
+      onMessage( (const ListCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'L', 0 ):
+      onMessage( (const ListExecute&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'M', 0 ):
+      onMessage( (const ListStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'N', 0 ):
+      onMessage( (const ListStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'P', 0 ):
+      onMessage( (const AllocationInstructionAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Q', 0 ):
+      onMessage( (const DontKnowTrade&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'R', 0 ):
+      onMessage( (const QuoteRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'S', 0 ):
+      onMessage( (const Quote&)message, sessionID ); break;
+    default:
+      onMessage( message, sessionID );
+    }
   }
   
 void crack( Message& message, 
             const FIX::SessionID& sessionID )
   {
-    FIX::MsgType msgType;
-    message.getHeader().getField(msgType);
-    std::string msgTypeValue = msgType.getValue();
-    
-    if( msgTypeValue == "0" )
-      onMessage( (Heartbeat&)message, sessionID );
-    else
-    if( msgTypeValue == "1" )
-      onMessage( (TestRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "2" )
-      onMessage( (ResendRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "3" )
-      onMessage( (Reject&)message, sessionID );
-    else
-    if( msgTypeValue == "4" )
-      onMessage( (SequenceReset&)message, sessionID );
-    else
-    if( msgTypeValue == "5" )
-      onMessage( (Logout&)message, sessionID );
-    else
-    if( msgTypeValue == "6" )
-      onMessage( (IOI&)message, sessionID );
-    else
-    if( msgTypeValue == "7" )
-      onMessage( (Advertisement&)message, sessionID );
-    else
-    if( msgTypeValue == "8" )
-      onMessage( (ExecutionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "9" )
-      onMessage( (OrderCancelReject&)message, sessionID );
-    else
-    if( msgTypeValue == "A" )
-      onMessage( (Logon&)message, sessionID );
-    else
-    if( msgTypeValue == "B" )
-      onMessage( (News&)message, sessionID );
-    else
-    if( msgTypeValue == "C" )
-      onMessage( (Email&)message, sessionID );
-    else
-    if( msgTypeValue == "D" )
-      onMessage( (NewOrderSingle&)message, sessionID );
-    else
-    if( msgTypeValue == "E" )
-      onMessage( (NewOrderList&)message, sessionID );
-    else
-    if( msgTypeValue == "F" )
-      onMessage( (OrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "G" )
-      onMessage( (OrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "H" )
-      onMessage( (OrderStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "J" )
-      onMessage( (Allocation&)message, sessionID );
-    else
-    if( msgTypeValue == "K" )
-      onMessage( (ListCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "L" )
-      onMessage( (ListExecute&)message, sessionID );
-    else
-    if( msgTypeValue == "M" )
-      onMessage( (ListStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "N" )
-      onMessage( (ListStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "P" )
-      onMessage( (AllocationInstructionAck&)message, sessionID );
-    else
-    if( msgTypeValue == "Q" )
-      onMessage( (DontKnowTrade&)message, sessionID );
-    else
-    if( msgTypeValue == "R" )
-      onMessage( (QuoteRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "S" )
-      onMessage( (Quote&)message, sessionID );
-    else onMessage( message, sessionID );
+    switch( FIX::Message::msgTypeId(
+      message.getHeader().getField( FIX::FIELD::MsgType ) ) )
+    {
+    case FIX_MSGTYPE_ID( '0', 0 ):
+      onMessage( (Heartbeat&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '1', 0 ):
+      onMessage( (TestRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '2', 0 ):
+      onMessage( (ResendRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '3', 0 ):
+      onMessage( (Reject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '4', 0 ):
+      onMessage( (SequenceReset&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '5', 0 ):
+      onMessage( (Logout&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '6', 0 ):
+      onMessage( (IOI&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '7', 0 ):
+      onMessage( (Advertisement&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '8', 0 ):
+      onMessage( (ExecutionReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '9', 0 ):
+      onMessage( (OrderCancelReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 0 ):
+      onMessage( (Logon&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 0 ):
+      onMessage( (News&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'C', 0 ):
+      onMessage( (Email&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'D', 0 ):
+      onMessage( (NewOrderSingle&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'E', 0 ):
+      onMessage( (NewOrderList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'F', 0 ):
+      onMessage( (OrderCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'G', 0 ):
+      onMessage( (OrderCancelReplaceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'H', 0 ):
+      onMessage( (OrderStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'J', 0 ):
+      onMessage( (Allocation&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'K', 0 ):
+      onMessage( (ListCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'L', 0 ):
+      onMessage( (ListExecute&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'M', 0 ):
+      onMessage( (ListStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'N', 0 ):
+      onMessage( (ListStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'P', 0 ):
+      onMessage( (AllocationInstructionAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Q', 0 ):
+      onMessage( (DontKnowTrade&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'R', 0 ):
+      onMessage( (QuoteRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'S', 0 ):
+      onMessage( (Quote&)message, sessionID ); break;
+    default:
+      onMessage( message, sessionID );
+    }
   }
 
   };
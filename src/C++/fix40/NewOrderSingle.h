@@ -12,7 +12,6 @@ namespace FIX40
     NewOrderSingle() : Message(MsgType()) {}
     NewOrderSingle(const FIX::Message& m) : Message(m) {}
     NewOrderSingle(const Message& m) : Message(m) {}
-    NewOrderSingle(const NewOrderSingle& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("D"); }
 
     NewOrderSingle(
@@ -12,7 +12,6 @@ namespace FIX40
     News() : Message(MsgType()) {}
     News(const FIX::Message& m) : Message(m) {}
     News(const Message& m) : Message(m) {}
-    News(const News& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("B"); }
 
     News(
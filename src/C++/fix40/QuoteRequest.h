@@ -12,7 +12,6 @@ namespace FIX40
     QuoteRequest() : Message(MsgType()) {}
     QuoteRequest(const FIX::Message& m) : Message(m) {}
     QuoteRequest(const Message& m) : Message(m) {}
-    QuoteRequest(const QuoteRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("R"); }
 
     QuoteRequest(
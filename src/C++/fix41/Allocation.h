@@ -12,7 +12,6 @@ namespace FIX41
     Allocation() : Message(MsgType()) {}
     Allocation(const FIX::Message& m) : Message(m) {}
     Allocation(const Message& m) : Message(m) {}
-    Allocation(const Allocation& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("J"); }
 
     Allocation(
@@ -71,7 +70,12 @@ namespace FIX41
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,37,198,66,105,0)) {}
+    NoOrders() : FIX::Group(73,11,FIX::message_order(fieldOrder(),5)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{11,1},{37,2},{66,4},{105,5},{198,3}};
+      return order;
+    }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::OrderID);
       FIELD_SET(*this, FIX::SecondaryOrderID);
@@ -82,7 +86,12 @@ namespace FIX41
     class NoExecs: public FIX::Group
     {
     public:
-    NoExecs() : FIX::Group(124,32,FIX::message_order(32,17,31,29,0)) {}
+    NoExecs() : FIX::Group(124,32,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{17,2},{29,4},{31,3},{32,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::LastShares);
       FIELD_SET(*this, FIX::ExecID);
       FIELD_SET(*this, FIX::LastPx);
@@ -92,7 +101,12 @@ namespace FIX41
     class NoAllocs: public FIX::Group
     {
     public:
-    NoAllocs() : FIX::Group(78,79,FIX::message_order(79,80,81,92,208,209,161,76,109,12,13,153,154,119,120,155,156,159,160,136,0)) {}
+    NoAllocs() : FIX::Group(78,79,FIX::message_order(fieldOrder(),20)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{12,10},{13,11},{76,8},{79,1},{80,2},{81,3},{92,4},{109,9},{119,14},{120,15},{136,20},{153,12},{154,13},{155,16},{156,17},{159,18},{160,19},{161,7},{208,5},{209,6}};
+      return order;
+    }
       FIELD_SET(*this, FIX::AllocAccount);
       FIELD_SET(*this, FIX::AllocShares);
       FIELD_SET(*this, FIX::ProcessCode);
@@ -116,7 +130,12 @@ namespace FIX41
       class NoMiscFees: public FIX::Group
       {
       public:
-      NoMiscFees() : FIX::Group(136,137,FIX::message_order(137,138,139,0)) {}
+      NoMiscFees() : FIX::Group(136,137,FIX::message_order(fieldOrder(),3)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{137,1},{138,2},{139,3}};
+        return order;
+      }
         FIELD_SET(*this, FIX::MiscFeeAmt);
         FIELD_SET(*this, FIX::MiscFeeCurr);
         FIELD_SET(*this, FIX::MiscFeeType);
@@ -12,7 +12,6 @@ namespace FIX41
     AllocationInstructionAck() : Message(MsgType()) {}
     AllocationInstructionAck(const FIX::Message& m) : Message(m) {}
     AllocationInstructionAck(const Message& m) : Message(m) {}
-    AllocationInstructionAck(const AllocationInstructionAck& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("P"); }
 
     AllocationInstructionAck(
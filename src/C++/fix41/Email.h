@@ -12,7 +12,6 @@ namespace FIX41
     Email() : Message(MsgType()) {}
     Email(const FIX::Message& m) : Message(m) {}
     Email(const Message& m) : Message(m) {}
-    Email(const Email& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("C"); }
 
     Email(
@@ -38,7 +37,12 @@ namespace FIX41
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,46,FIX::message_order(46,65,48,22,167,200,205,201,202,206,207,106,107,0)) {}
+    NoRelatedSym() : FIX::Group(146,46,FIX::message_order(fieldOrder(),13)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{22,4},{46,1},{48,3},{65,2},{106,12},{107,13},{167,5},{200,6},{201,8},{202,9},{205,7},{206,10},{207,11}};
+      return order;
+    }
       FIELD_SET(*this, FIX::RelatdSym);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -57,7 +61,12 @@ namespace FIX41
     class LinesOfText: public FIX::Group
     {
     public:
-    LinesOfText() : FIX::Group(33,58,FIX::message_order(58,0)) {}
+    LinesOfText() : FIX::Group(33,58,FIX::message_order(fieldOrder(),1)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{58,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Text);
     };
   };
@@ -12,7 +12,6 @@ namespace FIX41
     ExecutionReport() : Message(MsgType()) {}
     ExecutionReport(const FIX::Message& m) : Message(m) {}
     ExecutionReport(const Message& m) : Message(m) {}
-    ExecutionReport(const ExecutionReport& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("8"); }
 
     ExecutionReport(
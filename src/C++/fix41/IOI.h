@@ -12,7 +12,6 @@ namespace FIX41
     IOI() : Message(MsgType()) {}
     IOI(const FIX::Message& m) : Message(m) {}
     IOI(const Message& m) : Message(m) {}
-    IOI(const IOI& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("6"); }
 
     IOI(
@@ -61,7 +60,12 @@ namespace FIX41
     class NoIOIQualifiers: public FIX::Group
     {
     public:
-    NoIOIQualifiers() : FIX::Group(199,104,FIX::message_order(104,0)) {}
+    NoIOIQualifiers() : FIX::Group(199,104,FIX::message_order(fieldOrder(),1)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{104,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::IOIQualifier);
     };
   };
@@ -12,7 +12,6 @@ namespace FIX41
     ListStatus() : Message(MsgType()) {}
     ListStatus(const FIX::Message& m) : Message(m) {}
     ListStatus(const Message& m) : Message(m) {}
-    ListStatus(const ListStatus& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("N"); }
 
     ListStatus(
@@ -34,7 +33,12 @@ namespace FIX41
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,14,151,84,6,0)) {}
+    NoOrders() : FIX::Group(73,11,FIX::message_order(fieldOrder(),5)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{6,5},{11,1},{14,2},{84,4},{151,3}};
+      return order;
+    }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::CumQty);
       FIELD_SET(*this, FIX::LeavesQty);
@@ -12,7 +12,6 @@ namespace FIX41
     ListStatusRequest() : Message(MsgType()) {}
     ListStatusRequest(const FIX::Message& m) : Message(m) {}
     ListStatusRequest(const Message& m) : Message(m) {}
-    ListStatusRequest(const ListStatusRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("M"); }
 
     ListStatusRequest(
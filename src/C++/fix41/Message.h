@@ -50,7 +50,6 @@ namespace FIX41
      {} 
 
     Message(const FIX::Message& m) : FIX::Message(m) {}
-    Message(const Message& m) : FIX::Message(m) {}
     Header& getHeader() { return (Header&)m_header; }
     const Header& getHeader() const { return (Header&)m_header; }
     Trailer& getTrailer() { return (Trailer&)m_trailer; }
@@ -12,7 +12,6 @@ namespace FIX41
     NewOrderList() : Message(MsgType()) {}
     NewOrderList(const FIX::Message& m) : Message(m) {}
     NewOrderList(const Message& m) : Message(m) {}
-    NewOrderList(const NewOrderList& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("E"); }
 
     NewOrderList(
@@ -12,7 +12,6 @@ namespace FIX41
     OrderCancelReject() : Message(MsgType()) {}
     OrderCancelReject(const FIX::Message& m) : Message(m) {}
     OrderCancelReject(const Message& m) : Message(m) {}
-    OrderCancelReject(const OrderCancelReject& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("9"); }
 
     OrderCancelReject(
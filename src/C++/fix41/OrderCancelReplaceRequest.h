@@ -12,7 +12,6 @@ namespace FIX41
     OrderCancelReplaceRequest() : Message(MsgType()) {}
     OrderCancelReplaceRequest(const FIX::Message& m) : Message(m) {}
     OrderCancelReplaceRequest(const Message& m) : Message(m) {}
-    OrderCancelReplaceRequest(const OrderCancelReplaceRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("G"); }
 
     OrderCancelReplaceRequest(
@@ -12,7 +12,6 @@ namespace FIX41
     OrderCancelRequest() : Message(MsgType()) {}
     OrderCancelRequest(const FIX::Message& m) : Message(m) {}
     OrderCancelRequest(const Message& m) : Message(m) {}
-    OrderCancelRequest(const OrderCancelRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("F"); }
 
     OrderCancelRequest(
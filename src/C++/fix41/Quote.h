@@ -12,7 +12,6 @@ namespace FIX41
     Quote() : Message(MsgType()) {}
     Quote(const FIX::Message& m) : Message(m) {}
     Quote(const Message& m) : Message(m) {}
-    Quote(const Quote& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("S"); }
 
     Quote(
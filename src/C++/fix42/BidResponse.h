@@ -12,7 +12,6 @@ namespace FIX42
     BidResponse() : Message(MsgType()) {}
     BidResponse(const FIX::Message& m) : Message(m) {}
     BidResponse(const Message& m) : Message(m) {}
-    BidResponse(const BidResponse& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("l"); }
 
     FIELD_SET(*this, FIX::BidID);
@@ -21,7 +20,12 @@ namespace FIX42
     class NoBidComponents: public FIX::Group
     {
     public:
-    NoBidComponents() : FIX::Group(420,12,FIX::message_order(12,13,66,421,54,44,423,406,430,63,64,336,58,354,355,0)) {}
+    NoBidComponents() : FIX::Group(420,12,FIX::message_order(fieldOrder(),15)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{12,1},{13,2},{44,6},{54,5},{58,13},{63,10},{64,11},{66,3},{336,12},{354,14},{355,15},{406,8},{421,4},{423,7},{430,9}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Commission);
       FIELD_SET(*this, FIX::CommType);
       FIELD_SET(*this, FIX::ListID);
@@ -12,7 +12,6 @@ namespace FIX42
     DontKnowTrade() : Message(MsgType()) {}
     DontKnowTrade(const FIX::Message& m) : Message(m) {}
     DontKnowTrade(const Message& m) : Message(m) {}
-    DontKnowTrade(const DontKnowTrade& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("Q"); }
 
     DontKnowTrade(
@@ -12,7 +12,6 @@ namespace FIX42
     Email() : Message(MsgType()) {}
     Email(const FIX::Message& m) : Message(m) {}
     Email(const Message& m) : Message(m) {}
-    Email(const Email& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("C"); }
 
     Email(
@@ -40,7 +39,12 @@ namespace FIX42
     class NoRoutingIDs: public FIX::Group
     {
     public:
-    NoRoutingIDs() : FIX::Group(215,216,FIX::message_order(216,217,0)) {}
+    NoRoutingIDs() : FIX::Group(215,216,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{216,1},{217,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::RoutingType);
       FIELD_SET(*this, FIX::RoutingID);
     };
@@ -48,7 +52,12 @@ namespace FIX42
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,46,FIX::message_order(46,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,0)) {}
+    NoRelatedSym() : FIX::Group(146,46,FIX::message_order(fieldOrder(),19)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{22,4},{46,1},{48,3},{65,2},{106,14},{107,17},{167,5},{200,6},{201,8},{202,9},{205,7},{206,10},{207,13},{223,12},{231,11},{348,15},{349,16},{350,18},{351,19}};
+      return order;
+    }
       FIELD_SET(*this, FIX::RelatdSym);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -73,7 +82,12 @@ namespace FIX42
     class LinesOfText: public FIX::Group
     {
     public:
-    LinesOfText() : FIX::Group(33,58,FIX::message_order(58,354,355,0)) {}
+    LinesOfText() : FIX::Group(33,58,FIX::message_order(fieldOrder(),3)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{58,1},{354,2},{355,3}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
@@ -12,7 +12,6 @@ namespace FIX42
     ExecutionReport() : Message(MsgType()) {}
     ExecutionReport(const FIX::Message& m) : Message(m) {}
     ExecutionReport(const Message& m) : Message(m) {}
-    ExecutionReport(const ExecutionReport& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("8"); }
 
     ExecutionReport(
@@ -135,7 +134,12 @@ namespace FIX42
     class NoContraBrokers: public FIX::Group
     {
     public:
-    NoContraBrokers() : FIX::Group(382,375,FIX::message_order(375,337,437,438,0)) {}
+    NoContraBrokers() : FIX::Group(382,375,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{337,2},{375,1},{437,3},{438,4}};
+      return order;
+    }
       FIELD_SET(*this, FIX::ContraBroker);
       FIELD_SET(*this, FIX::ContraTrader);
       FIELD_SET(*this, FIX::ContraTradeQty);
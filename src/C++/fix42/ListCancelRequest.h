@@ -12,7 +12,6 @@ namespace FIX42
     ListCancelRequest() : Message(MsgType()) {}
     ListCancelRequest(const FIX::Message& m) : Message(m) {}
     ListCancelRequest(const Message& m) : Message(m) {}
-    ListCancelRequest(const ListCancelRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("K"); }
 
     ListCancelRequest(
@@ -12,7 +12,6 @@ namespace FIX42
     ListStatus() : Message(MsgType()) {}
     ListStatus(const FIX::Message& m) : Message(m) {}
     ListStatus(const Message& m) : Message(m) {}
-    ListStatus(const ListStatus& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("N"); }
 
     ListStatus(
@@ -46,7 +45,12 @@ namespace FIX42
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,14,39,151,84,6,103,58,354,355,0)) {}
+    NoOrders() : FIX::Group(73,11,FIX::message_order(fieldOrder(),10)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{6,6},{11,1},{14,2},{39,3},{58,8},{84,5},{103,7},{151,4},{354,9},{355,10}};
+      return order;
+    }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::CumQty);
       FIELD_SET(*this, FIX::OrdStatus);
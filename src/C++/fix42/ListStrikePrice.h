@@ -12,7 +12,6 @@ namespace FIX42
     ListStrikePrice() : Message(MsgType()) {}
     ListStrikePrice(const FIX::Message& m) : Message(m) {}
     ListStrikePrice(const Message& m) : Message(m) {}
-    ListStrikePrice(const ListStrikePrice& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("m"); }
 
     ListStrikePrice(
@@ -30,7 +29,12 @@ namespace FIX42
     class NoStrikes: public FIX::Group
     {
     public:
-    NoStrikes() : FIX::Group(428,55,FIX::message_order(55,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,140,11,54,44,15,58,354,355,0)) {}
+    NoStrikes() : FIX::Group(428,55,FIX::message_order(fieldOrder(),27)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{11,21},{15,24},{22,4},{44,23},{48,3},{54,22},{55,1},{58,25},{65,2},{106,14},{107,17},{140,20},{167,5},{200,6},{201,8},{202,9},{205,7},{206,10},{207,13},{223,12},{231,11},{348,15},{349,16},{350,18},{351,19},{354,26},{355,27}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
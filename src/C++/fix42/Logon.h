@@ -12,7 +12,6 @@ namespace FIX42
     Logon() : Message(MsgType()) {}
     Logon(const FIX::Message& m) : Message(m) {}
     Logon(const Message& m) : Message(m) {}
-    Logon(const Logon& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("A"); }
 
     Logon(
@@ -34,7 +33,12 @@ namespace FIX42
     class NoMsgTypes: public FIX::Group
     {
     public:
-    NoMsgTypes() : FIX::Group(384,372,FIX::message_order(372,385,0)) {}
+    NoMsgTypes() : FIX::Group(384,372,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{372,1},{385,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::RefMsgType);
       FIELD_SET(*this, FIX::MsgDirection);
     };
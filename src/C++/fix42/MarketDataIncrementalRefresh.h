@@ -12,7 +12,6 @@ namespace FIX42
     MarketDataIncrementalRefresh() : Message(MsgType()) {}
     MarketDataIncrementalRefresh(const FIX::Message& m) : Message(m) {}
     MarketDataIncrementalRefresh(const Message& m) : Message(m) {}
-    MarketDataIncrementalRefresh(const MarketDataIncrementalRefresh& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("X"); }
 
     FIELD_SET(*this, FIX::MDReqID);
@@ -20,7 +19,12 @@ namespace FIX42
     class NoMDEntries: public FIX::Group
     {
     public:
-    NoMDEntries() : FIX::Group(268,279,FIX::message_order(279,285,269,278,280,55,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,291,292,270,15,271,272,273,274,275,336,276,277,282,283,284,286,59,432,126,110,18,287,37,299,288,289,346,290,387,58,354,355,0)) {}
+    NoMDEntries() : FIX::Group(268,279,FIX::message_order(fieldOrder(),56)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{15,28},{18,45},{22,9},{37,47},{48,8},{55,6},{58,54},{59,41},{65,7},{106,19},{107,22},{110,44},{126,43},{167,10},{200,11},{201,13},{202,14},{205,12},{206,15},{207,18},{223,17},{231,16},{269,3},{270,27},{271,29},{272,30},{273,31},{274,32},{275,33},{276,35},{277,36},{278,4},{279,1},{280,5},{282,37},{283,38},{284,39},{285,2},{286,40},{287,46},{288,49},{289,50},{290,52},{291,25},{292,26},{299,48},{336,34},{346,51},{348,20},{349,21},{350,23},{351,24},{354,55},{355,56},{387,53},{432,42}};
+      return order;
+    }
       FIELD_SET(*this, FIX::MDUpdateAction);
       FIELD_SET(*this, FIX::DeleteReason);
       FIELD_SET(*this, FIX::MDEntryType);
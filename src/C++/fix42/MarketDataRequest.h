@@ -12,7 +12,6 @@ namespace FIX42
     MarketDataRequest() : Message(MsgType()) {}
     MarketDataRequest(const FIX::Message& m) : Message(m) {}
     MarketDataRequest(const Message& m) : Message(m) {}
-    MarketDataRequest(const MarketDataRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("V"); }
 
     MarketDataRequest(
@@ -35,14 +34,24 @@ namespace FIX42
     class NoMDEntryTypes: public FIX::Group
     {
     public:
-    NoMDEntryTypes() : FIX::Group(267,269,FIX::message_order(269,0)) {}
+    NoMDEntryTypes() : FIX::Group(267,269,FIX::message_order(fieldOrder(),1)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{269,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::MDEntryType);
     };
     FIELD_SET(*this, FIX::NoRelatedSym);
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(55,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,336,0)) {}
+    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(fieldOrder(),20)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{22,4},{48,3},{55,1},{65,2},{106,14},{107,17},{167,5},{200,6},{201,8},{202,9},{205,7},{206,10},{207,13},{223,12},{231,11},{336,20},{348,15},{349,16},{350,18},{351,19}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -12,7 +12,6 @@ namespace FIX42
     MarketDataSnapshotFullRefresh() : Message(MsgType()) {}
     MarketDataSnapshotFullRefresh(const FIX::Message& m) : Message(m) {}
     MarketDataSnapshotFullRefresh(const Message& m) : Message(m) {}
-    MarketDataSnapshotFullRefresh(const MarketDataSnapshotFullRefresh& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("W"); }
 
     MarketDataSnapshotFullRefresh(
@@ -49,7 +48,12 @@ namespace FIX42
     class NoMDEntries: public FIX::Group
     {
     public:
-    NoMDEntries() : FIX::Group(268,269,FIX::message_order(269,270,15,271,272,273,274,275,336,276,277,282,283,284,286,59,432,126,110,18,287,37,299,288,289,346,290,58,354,355,0)) {}
+    NoMDEntries() : FIX::Group(268,269,FIX::message_order(fieldOrder(),30)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{15,3},{18,20},{37,22},{58,28},{59,16},{110,19},{126,18},{269,1},{270,2},{271,4},{272,5},{273,6},{274,7},{275,8},{276,10},{277,11},{282,12},{283,13},{284,14},{286,15},{287,21},{288,24},{289,25},{290,27},{299,23},{336,9},{346,26},{354,29},{355,30},{432,17}};
+      return order;
+    }
       FIELD_SET(*this, FIX::MDEntryType);
       FIELD_SET(*this, FIX::MDEntryPx);
       FIELD_SET(*this, FIX::Currency);
@@ -12,7 +12,6 @@ namespace FIX42
     MassQuote() : Message(MsgType()) {}
     MassQuote(const FIX::Message& m) : Message(m) {}
     MassQuote(const Message& m) : Message(m) {}
-    MassQuote(const MassQuote& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("i"); }
 
     MassQuote(
@@ -31,7 +30,12 @@ namespace FIX42
     class NoQuoteSets: public FIX::Group
     {
     public:
-    NoQuoteSets() : FIX::Group(296,302,FIX::message_order(302,311,312,309,305,310,313,314,315,316,317,436,435,308,306,362,363,307,364,365,367,304,295,0)) {}
+    NoQuoteSets() : FIX::Group(296,302,FIX::message_order(fieldOrder(),23)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{295,23},{302,1},{304,22},{305,5},{306,15},{307,18},{308,14},{309,4},{310,6},{311,2},{312,3},{313,7},{314,8},{315,9},{316,10},{317,11},{362,16},{363,17},{364,19},{365,20},{367,21},{435,13},{436,12}};
+      return order;
+    }
       FIELD_SET(*this, FIX::QuoteSetID);
       FIELD_SET(*this, FIX::UnderlyingSymbol);
       FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
@@ -58,7 +62,12 @@ namespace FIX42
       class NoQuoteEntries: public FIX::Group
       {
       public:
-      NoQuoteEntries() : FIX::Group(295,299,FIX::message_order(299,55,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,132,133,134,135,62,188,190,189,191,60,336,64,40,193,192,15,0)) {}
+      NoQuoteEntries() : FIX::Group(295,299,FIX::message_order(fieldOrder(),36)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{15,36},{22,5},{40,33},{48,4},{55,2},{60,30},{62,25},{64,32},{65,3},{106,15},{107,18},{132,21},{133,22},{134,23},{135,24},{167,6},{188,26},{189,28},{190,27},{191,29},{192,35},{193,34},{200,7},{201,9},{202,10},{205,8},{206,11},{207,14},{223,13},{231,12},{299,1},{336,31},{348,16},{349,17},{350,19},{351,20}};
+        return order;
+      }
         FIELD_SET(*this, FIX::QuoteEntryID);
         FIELD_SET(*this, FIX::Symbol);
         FIELD_SET(*this, FIX::SymbolSfx);
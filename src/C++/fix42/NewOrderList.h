@@ -12,7 +12,6 @@ namespace FIX42
     NewOrderList() : Message(MsgType()) {}
     NewOrderList(const FIX::Message& m) : Message(m) {}
     NewOrderList(const Message& m) : Message(m) {}
-    NewOrderList(const NewOrderList& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("E"); }
 
     NewOrderList(
@@ -41,7 +40,12 @@ namespace FIX42
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,67,160,109,76,1,78,63,64,21,18,110,111,100,386,81,55,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,140,54,401,114,60,38,152,40,44,99,15,376,377,23,117,59,168,432,126,427,12,13,47,121,120,58,354,355,193,192,77,203,204,210,211,388,389,439,440,0)) {}
+    NoOrders() : FIX::Group(73,11,FIX::message_order(fieldOrder(),74)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1,6},{11,1},{12,56},{13,57},{15,46},{18,11},{21,10},{22,20},{23,49},{38,41},{40,43},{44,44},{47,58},{48,19},{54,37},{55,17},{58,61},{59,51},{60,40},{63,8},{64,9},{65,18},{67,2},{76,5},{77,66},{78,7},{81,16},{99,45},{100,14},{106,30},{107,33},{109,4},{110,12},{111,13},{114,39},{117,50},{120,60},{121,59},{126,54},{140,36},{152,42},{160,3},{167,21},{168,52},{192,65},{193,64},{200,22},{201,24},{202,25},{203,67},{204,68},{205,23},{206,26},{207,29},{210,69},{211,70},{223,28},{231,27},{348,31},{349,32},{350,34},{351,35},{354,62},{355,63},{376,47},{377,48},{386,15},{388,71},{389,72},{401,38},{427,55},{432,53},{439,73},{440,74}};
+      return order;
+    }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::ListSeqNo);
       FIELD_SET(*this, FIX::SettlInstMode);
@@ -118,7 +122,12 @@ namespace FIX42
       class NoAllocs: public FIX::Group
       {
       public:
-      NoAllocs() : FIX::Group(78,79,FIX::message_order(79,80,0)) {}
+      NoAllocs() : FIX::Group(78,79,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{79,1},{80,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::AllocAccount);
         FIELD_SET(*this, FIX::AllocShares);
       };
@@ -126,7 +135,12 @@ namespace FIX42
       class NoTradingSessions: public FIX::Group
       {
       public:
-      NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,0)) {}
+      NoTradingSessions() : FIX::Group(386,336,FIX::message_order(fieldOrder(),1)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{336,1}};
+        return order;
+      }
         FIELD_SET(*this, FIX::TradingSessionID);
       };
     };
@@ -12,7 +12,6 @@ namespace FIX42
     NewOrderSingle() : Message(MsgType()) {}
     NewOrderSingle(const FIX::Message& m) : Message(m) {}
     NewOrderSingle(const Message& m) : Message(m) {}
-    NewOrderSingle(const NewOrderSingle& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("D"); }
 
     NewOrderSingle(
@@ -105,7 +104,12 @@ namespace FIX42
     class NoAllocs: public FIX::Group
     {
     public:
-    NoAllocs() : FIX::Group(78,79,FIX::message_order(79,80,0)) {}
+    NoAllocs() : FIX::Group(78,79,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{79,1},{80,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::AllocAccount);
       FIELD_SET(*this, FIX::AllocShares);
     };
@@ -113,7 +117,12 @@ namespace FIX42
     class NoTradingSessions: public FIX::Group
     {
     public:
-    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,0)) {}
+    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(fieldOrder(),1)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{336,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::TradingSessionID);
     };
   };
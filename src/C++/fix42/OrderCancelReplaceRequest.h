@@ -12,7 +12,6 @@ namespace FIX42
     OrderCancelReplaceRequest() : Message(MsgType()) {}
     OrderCancelReplaceRequest(const FIX::Message& m) : Message(m) {}
     OrderCancelReplaceRequest(const Message& m) : Message(m) {}
-    OrderCancelReplaceRequest(const OrderCancelReplaceRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("G"); }
 
     OrderCancelReplaceRequest(
@@ -106,7 +105,12 @@ namespace FIX42
     class NoAllocs: public FIX::Group
     {
     public:
-    NoAllocs() : FIX::Group(78,79,FIX::message_order(79,80,0)) {}
+    NoAllocs() : FIX::Group(78,79,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{79,1},{80,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::AllocAccount);
       FIELD_SET(*this, FIX::AllocShares);
     };
@@ -114,7 +118,12 @@ namespace FIX42
     class NoTradingSessions: public FIX::Group
     {
     public:
-    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,0)) {}
+    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(fieldOrder(),1)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{336,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::TradingSessionID);
     };
   };
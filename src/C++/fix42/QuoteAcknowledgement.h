@@ -12,7 +12,6 @@ namespace FIX42
     QuoteAcknowledgement() : Message(MsgType()) {}
     QuoteAcknowledgement(const FIX::Message& m) : Message(m) {}
     QuoteAcknowledgement(const Message& m) : Message(m) {}
-    QuoteAcknowledgement(const QuoteAcknowledgement& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("b"); }
 
     QuoteAcknowledgement(
@@ -33,7 +32,12 @@ namespace FIX42
     class NoQuoteSets: public FIX::Group
     {
     public:
-    NoQuoteSets() : FIX::Group(296,302,FIX::message_order(302,311,312,309,305,310,313,314,315,316,317,436,435,308,306,362,363,307,364,365,304,295,0)) {}
+    NoQuoteSets() : FIX::Group(296,302,FIX::message_order(fieldOrder(),22)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{295,22},{302,1},{304,21},{305,5},{306,15},{307,18},{308,14},{309,4},{310,6},{311,2},{312,3},{313,7},{314,8},{315,9},{316,10},{317,11},{362,16},{363,17},{364,19},{365,20},{435,13},{436,12}};
+      return order;
+    }
       FIELD_SET(*this, FIX::QuoteSetID);
       FIELD_SET(*this, FIX::UnderlyingSymbol);
       FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
@@ -59,7 +63,12 @@ namespace FIX42
       class NoQuoteEntries: public FIX::Group
       {
       public:
-      NoQuoteEntries() : FIX::Group(295,299,FIX::message_order(299,55,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,368,0)) {}
+      NoQuoteEntries() : FIX::Group(295,299,FIX::message_order(fieldOrder(),21)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{22,5},{48,4},{55,2},{65,3},{106,15},{107,18},{167,6},{200,7},{201,9},{202,10},{205,8},{206,11},{207,14},{223,13},{231,12},{299,1},{348,16},{349,17},{350,19},{351,20},{368,21}};
+        return order;
+      }
         FIELD_SET(*this, FIX::QuoteEntryID);
         FIELD_SET(*this, FIX::Symbol);
         FIELD_SET(*this, FIX::SymbolSfx);
@@ -12,7 +12,6 @@ namespace FIX42
     QuoteCancel() : Message(MsgType()) {}
     QuoteCancel(const FIX::Message& m) : Message(m) {}
     QuoteCancel(const Message& m) : Message(m) {}
-    QuoteCancel(const QuoteCancel& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("Z"); }
 
     QuoteCancel(
@@ -33,7 +32,12 @@ namespace FIX42
     class NoQuoteEntries: public FIX::Group
     {
     public:
-    NoQuoteEntries() : FIX::Group(295,55,FIX::message_order(55,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,311,0)) {}
+    NoQuoteEntries() : FIX::Group(295,55,FIX::message_order(fieldOrder(),20)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{22,4},{48,3},{55,1},{65,2},{106,14},{107,17},{167,5},{200,6},{201,8},{202,9},{205,7},{206,10},{207,13},{223,12},{231,11},{311,20},{348,15},{349,16},{350,18},{351,19}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
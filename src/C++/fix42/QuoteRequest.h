@@ -12,7 +12,6 @@ namespace FIX42
     QuoteRequest() : Message(MsgType()) {}
     QuoteRequest(const FIX::Message& m) : Message(m) {}
     QuoteRequest(const Message& m) : Message(m) {}
-    QuoteRequest(const QuoteRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("R"); }
 
     QuoteRequest(
@@ -27,7 +26,12 @@ namespace FIX42
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(55,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,140,303,336,54,38,64,40,193,192,126,60,15,0)) {}
+    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(fieldOrder(),31)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{15,31},{22,4},{38,24},{40,26},{48,3},{54,23},{55,1},{60,30},{64,25},{65,2},{106,14},{107,17},{126,29},{140,20},{167,5},{192,28},{193,27},{200,6},{201,8},{202,9},{205,7},{206,10},{207,13},{223,12},{231,11},{303,21},{336,22},{348,15},{349,16},{350,18},{351,19}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
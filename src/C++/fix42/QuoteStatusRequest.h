@@ -12,7 +12,6 @@ namespace FIX42
     QuoteStatusRequest() : Message(MsgType()) {}
     QuoteStatusRequest(const FIX::Message& m) : Message(m) {}
     QuoteStatusRequest(const Message& m) : Message(m) {}
-    QuoteStatusRequest(const QuoteStatusRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("a"); }
 
     QuoteStatusRequest(
@@ -12,7 +12,6 @@ namespace FIX42
     Reject() : Message(MsgType()) {}
     Reject(const FIX::Message& m) : Message(m) {}
     Reject(const Message& m) : Message(m) {}
-    Reject(const Reject& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("3"); }
 
     Reject(
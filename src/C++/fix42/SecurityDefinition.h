@@ -12,7 +12,6 @@ namespace FIX42
     SecurityDefinition() : Message(MsgType()) {}
     SecurityDefinition(const FIX::Message& m) : Message(m) {}
     SecurityDefinition(const Message& m) : Message(m) {}
-    SecurityDefinition(const SecurityDefinition& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("d"); }
 
     SecurityDefinition(
@@ -58,7 +57,12 @@ namespace FIX42
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,311,FIX::message_order(311,312,309,305,310,313,314,315,316,317,436,435,308,306,362,363,307,364,365,319,54,318,0)) {}
+    NoRelatedSym() : FIX::Group(146,311,FIX::message_order(fieldOrder(),22)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{54,21},{305,4},{306,14},{307,17},{308,13},{309,3},{310,5},{311,1},{312,2},{313,6},{314,7},{315,8},{316,9},{317,10},{318,22},{319,20},{362,15},{363,16},{364,18},{365,19},{435,12},{436,11}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UnderlyingSymbol);
       FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
       FIELD_SET(*this, FIX::UnderlyingSecurityID);
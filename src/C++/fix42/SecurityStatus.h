@@ -12,7 +12,6 @@ namespace FIX42
     SecurityStatus() : Message(MsgType()) {}
     SecurityStatus(const FIX::Message& m) : Message(m) {}
     SecurityStatus(const Message& m) : Message(m) {}
-    SecurityStatus(const SecurityStatus& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("f"); }
 
     SecurityStatus(
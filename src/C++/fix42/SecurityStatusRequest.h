@@ -12,7 +12,6 @@ namespace FIX42
     SecurityStatusRequest() : Message(MsgType()) {}
     SecurityStatusRequest(const FIX::Message& m) : Message(m) {}
     SecurityStatusRequest(const Message& m) : Message(m) {}
-    SecurityStatusRequest(const SecurityStatusRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("e"); }
 
     SecurityStatusRequest(
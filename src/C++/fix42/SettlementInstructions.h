@@ -12,7 +12,6 @@ namespace FIX42
     SettlementInstructions() : Message(MsgType()) {}
     SettlementInstructions(const FIX::Message& m) : Message(m) {}
     SettlementInstructions(const Message& m) : Message(m) {}
-    SettlementInstructions(const SettlementInstructions& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("T"); }
 
     SettlementInstructions(
@@ -12,7 +12,6 @@ namespace FIX42
     TradingSessionStatusRequest() : Message(MsgType()) {}
     TradingSessionStatusRequest(const FIX::Message& m) : Message(m) {}
     TradingSessionStatusRequest(const Message& m) : Message(m) {}
-    TradingSessionStatusRequest(const TradingSessionStatusRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("g"); }
 
     TradingSessionStatusRequest(
@@ -12,7 +12,6 @@ namespace FIX43
     Advertisement() : Message(MsgType()) {}
     Advertisement(const FIX::Message& m) : Message(m) {}
     Advertisement(const Message& m) : Message(m) {}
-    Advertisement(const Advertisement& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("7"); }
 
     Advertisement(
@@ -67,7 +66,12 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -12,7 +12,6 @@ namespace FIX43
     AllocationAck() : Message(MsgType()) {}
     AllocationAck(const FIX::Message& m) : Message(m) {}
     AllocationAck(const Message& m) : Message(m) {}
-    AllocationAck(const AllocationAck& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("P"); }
 
     AllocationAck(
@@ -30,7 +29,12 @@ namespace FIX43
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{447,2},{448,1},{452,3},{523,4}};
+      return order;
+    }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
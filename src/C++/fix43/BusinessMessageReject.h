@@ -12,7 +12,6 @@ namespace FIX43
     BusinessMessageReject() : Message(MsgType()) {}
     BusinessMessageReject(const FIX::Message& m) : Message(m) {}
     BusinessMessageReject(const Message& m) : Message(m) {}
-    BusinessMessageReject(const BusinessMessageReject& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("j"); }
 
     BusinessMessageReject(
@@ -12,7 +12,6 @@ namespace FIX43
     CrossOrderCancelReplaceRequest() : Message(MsgType()) {}
     CrossOrderCancelReplaceRequest(const FIX::Message& m) : Message(m) {}
     CrossOrderCancelReplaceRequest(const Message& m) : Message(m) {}
-    CrossOrderCancelReplaceRequest(const CrossOrderCancelReplaceRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("t"); }
 
     CrossOrderCancelReplaceRequest(
@@ -75,7 +74,12 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -94,7 +98,12 @@ namespace FIX43
     class NoStipulations: public FIX::Group
     {
     public:
-    NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
+    NoStipulations() : FIX::Group(232,233,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{233,1},{234,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::StipulationType);
       FIELD_SET(*this, FIX::StipulationValue);
     };
@@ -132,7 +141,12 @@ namespace FIX43
     class NoSides: public FIX::Group
     {
     public:
-    NoSides() : FIX::Group(552,54,FIX::message_order(54,41,11,526,583,586,453,229,1,581,589,590,591,78,465,38,152,516,468,469,12,13,479,497,528,529,582,121,120,58,354,355,77,203,544,635,377,659,0)) {}
+    NoSides() : FIX::Group(552,54,FIX::message_order(fieldOrder(),38)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1,9},{11,3},{12,21},{13,22},{38,16},{41,2},{54,1},{58,30},{77,33},{78,14},{120,29},{121,28},{152,17},{203,34},{229,8},{354,31},{355,32},{377,37},{453,7},{465,15},{468,19},{469,20},{479,23},{497,24},{516,18},{526,4},{528,25},{529,26},{544,35},{581,10},{582,27},{583,5},{586,6},{589,11},{590,12},{591,13},{635,36},{659,38}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Side);
       FIELD_SET(*this, FIX::OrigClOrdID);
       FIELD_SET(*this, FIX::ClOrdID);
@@ -143,7 +157,12 @@ namespace FIX43
       class NoPartyIDs: public FIX::Group
       {
       public:
-      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(fieldOrder(),4)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{447,2},{448,1},{452,3},{523,4}};
+        return order;
+      }
         FIELD_SET(*this, FIX::PartyID);
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
@@ -183,14 +202,24 @@ namespace FIX43
       class NoAllocs: public FIX::Group
       {
       public:
-      NoAllocs() : FIX::Group(78,79,FIX::message_order(79,467,539,80,0)) {}
+      NoAllocs() : FIX::Group(78,79,FIX::message_order(fieldOrder(),4)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{79,1},{80,4},{467,2},{539,3}};
+        return order;
+      }
         FIELD_SET(*this, FIX::AllocAccount);
         FIELD_SET(*this, FIX::IndividualAllocID);
         FIELD_SET(*this, FIX::NoNestedPartyIDs);
         class NoNestedPartyIDs: public FIX::Group
         {
         public:
-        NoNestedPartyIDs() : FIX::Group(539,524,FIX::message_order(524,525,538,545,0)) {}
+        NoNestedPartyIDs() : FIX::Group(539,524,FIX::message_order(fieldOrder(),4)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{524,1},{525,2},{538,3},{545,4}};
+          return order;
+        }
           FIELD_SET(*this, FIX::NestedPartyID);
           FIELD_SET(*this, FIX::NestedPartyIDSource);
           FIELD_SET(*this, FIX::NestedPartyRole);
@@ -203,7 +232,12 @@ namespace FIX43
     class NoTradingSessions: public FIX::Group
     {
     public:
-    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
+    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{336,1},{625,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
     };
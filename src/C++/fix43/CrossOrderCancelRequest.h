@@ -12,7 +12,6 @@ namespace FIX43
     CrossOrderCancelRequest() : Message(MsgType()) {}
     CrossOrderCancelRequest(const FIX::Message& m) : Message(m) {}
     CrossOrderCancelRequest(const Message& m) : Message(m) {}
-    CrossOrderCancelRequest(const CrossOrderCancelRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("u"); }
 
     CrossOrderCancelRequest(
@@ -71,7 +70,12 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -80,7 +84,12 @@ namespace FIX43
     class NoSides: public FIX::Group
     {
     public:
-    NoSides() : FIX::Group(552,54,FIX::message_order(54,41,11,526,583,586,453,229,38,152,516,468,469,376,58,354,355,0)) {}
+    NoSides() : FIX::Group(552,54,FIX::message_order(fieldOrder(),17)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{11,3},{38,9},{41,2},{54,1},{58,15},{152,10},{229,8},{354,16},{355,17},{376,14},{453,7},{468,12},{469,13},{516,11},{526,4},{583,5},{586,6}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Side);
       FIELD_SET(*this, FIX::OrigClOrdID);
       FIELD_SET(*this, FIX::ClOrdID);
@@ -91,7 +100,12 @@ namespace FIX43
       class NoPartyIDs: public FIX::Group
       {
       public:
-      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(fieldOrder(),4)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{447,2},{448,1},{452,3},{523,4}};
+        return order;
+      }
         FIELD_SET(*this, FIX::PartyID);
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
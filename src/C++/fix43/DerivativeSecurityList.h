@@ -12,7 +12,6 @@ namespace FIX43
     DerivativeSecurityList() : Message(MsgType()) {}
     DerivativeSecurityList(const FIX::Message& m) : Message(m) {}
     DerivativeSecurityList(const Message& m) : Message(m) {}
-    DerivativeSecurityList(const DerivativeSecurityList& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("AA"); }
 
     DerivativeSecurityList(
@@ -66,7 +65,12 @@ namespace FIX43
     class NoUnderlyingSecurityAltID: public FIX::Group
     {
     public:
-    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
+    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{458,1},{459,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
     };
@@ -75,7 +79,12 @@ namespace FIX43
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,15,555,336,625,58,354,355,0)) {}
+    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(fieldOrder(),40)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{15,34},{22,4},{48,3},{55,1},{58,38},{65,2},{106,28},{107,31},{167,8},{200,9},{202,23},{206,24},{207,27},{223,26},{224,11},{225,12},{226,14},{227,15},{228,16},{231,25},{239,13},{240,22},{255,17},{336,36},{348,29},{349,30},{350,32},{351,33},{354,39},{355,40},{454,5},{460,6},{461,7},{470,19},{471,20},{472,21},{541,10},{543,18},{555,35},{625,37}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -112,7 +121,12 @@ namespace FIX43
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
@@ -126,7 +140,12 @@ namespace FIX43
       class NoLegs: public FIX::Group
       {
       public:
-      NoLegs() : FIX::Group(555,600,FIX::message_order(600,601,602,603,604,607,608,609,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,613,614,615,616,617,618,619,620,621,622,623,624,556,0)) {}
+      NoLegs() : FIX::Group(555,600,FIX::message_order(fieldOrder(),36)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{248,11},{249,12},{250,13},{251,14},{252,15},{253,16},{254,22},{257,17},{556,36},{596,19},{597,20},{598,21},{599,18},{600,1},{601,2},{602,3},{603,4},{604,5},{607,6},{608,7},{609,8},{610,9},{611,10},{612,23},{613,24},{614,25},{615,26},{616,27},{617,28},{618,29},{619,30},{620,31},{621,32},{622,33},{623,34},{624,35}};
+        return order;
+      }
         FIELD_SET(*this, FIX::LegSymbol);
         FIELD_SET(*this, FIX::LegSymbolSfx);
         FIELD_SET(*this, FIX::LegSecurityID);
@@ -165,7 +184,12 @@ namespace FIX43
         class NoLegSecurityAltID: public FIX::Group
         {
         public:
-        NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
+        NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(fieldOrder(),2)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{605,1},{606,2}};
+          return order;
+        }
           FIELD_SET(*this, FIX::LegSecurityAltID);
           FIELD_SET(*this, FIX::LegSecurityAltIDSource);
         };
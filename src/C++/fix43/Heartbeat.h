@@ -12,7 +12,6 @@ namespace FIX43
     Heartbeat() : Message(MsgType()) {}
     Heartbeat(const FIX::Message& m) : Message(m) {}
     Heartbeat(const Message& m) : Message(m) {}
-    Heartbeat(const Heartbeat& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("0"); }
 
     FIELD_SET(*this, FIX::TestReqID);
@@ -12,7 +12,6 @@ namespace FIX43
     ListStatus() : Message(MsgType()) {}
     ListStatus(const FIX::Message& m) : Message(m) {}
     ListStatus(const Message& m) : Message(m) {}
-    ListStatus(const ListStatus& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("N"); }
 
     ListStatus(
@@ -46,7 +45,12 @@ namespace FIX43
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,526,14,39,636,151,84,6,103,58,354,355,0)) {}
+    NoOrders() : FIX::Group(73,11,FIX::message_order(fieldOrder(),12)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{6,8},{11,1},{14,3},{39,4},{58,10},{84,7},{103,9},{151,6},{354,11},{355,12},{526,2},{636,5}};
+      return order;
+    }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::SecondaryClOrdID);
       FIELD_SET(*this, FIX::CumQty);
@@ -12,7 +12,6 @@ namespace FIX43
     ListStrikePrice() : Message(MsgType()) {}
     ListStrikePrice(const FIX::Message& m) : Message(m) {}
     ListStrikePrice(const Message& m) : Message(m) {}
-    ListStrikePrice(const ListStrikePrice& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("m"); }
 
     ListStrikePrice(
@@ -30,7 +29,12 @@ namespace FIX43
     class NoStrikes: public FIX::Group
     {
     public:
-    NoStrikes() : FIX::Group(428,55,FIX::message_order(55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,140,11,526,54,44,15,58,354,355,0)) {}
+    NoStrikes() : FIX::Group(428,55,FIX::message_order(fieldOrder(),42)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{11,35},{15,39},{22,4},{44,38},{48,3},{54,37},{55,1},{58,40},{65,2},{106,28},{107,31},{140,34},{167,8},{200,9},{202,23},{206,24},{207,27},{223,26},{224,11},{225,12},{226,14},{227,15},{228,16},{231,25},{239,13},{240,22},{255,17},{348,29},{349,30},{350,32},{351,33},{354,41},{355,42},{454,5},{460,6},{461,7},{470,19},{471,20},{472,21},{526,36},{541,10},{543,18}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -67,7 +71,12 @@ namespace FIX43
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
@@ -12,7 +12,6 @@ namespace FIX43
     Logout() : Message(MsgType()) {}
     Logout(const FIX::Message& m) : Message(m) {}
     Logout(const Message& m) : Message(m) {}
-    Logout(const Logout& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("5"); }
 
     FIELD_SET(*this, FIX::Text);
@@ -12,7 +12,6 @@ namespace FIX43
     MarketDataIncrementalRefresh() : Message(MsgType()) {}
     MarketDataIncrementalRefresh(const FIX::Message& m) : Message(m) {}
     MarketDataIncrementalRefresh(const Message& m) : Message(m) {}
-    MarketDataIncrementalRefresh(const MarketDataIncrementalRefresh& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("X"); }
 
     FIELD_SET(*this, FIX::MDReqID);
@@ -20,7 +19,12 @@ namespace FIX43
     class NoMDEntries: public FIX::Group
     {
     public:
-    NoMDEntries() : FIX::Group(268,279,FIX::message_order(279,285,269,278,280,55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,291,292,270,15,271,272,273,274,275,336,625,276,277,282,283,284,286,59,432,126,110,18,287,37,299,288,289,346,290,546,387,449,450,451,58,354,355,0)) {}
+    NoMDEntries() : FIX::Group(268,279,FIX::message_order(fieldOrder(),75)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{15,42},{18,60},{22,9},{37,62},{48,8},{55,6},{58,73},{59,56},{65,7},{106,33},{107,36},{110,59},{126,58},{167,13},{200,14},{202,28},{206,29},{207,32},{223,31},{224,16},{225,17},{226,19},{227,20},{228,21},{231,30},{239,18},{240,27},{255,22},{269,3},{270,41},{271,43},{272,44},{273,45},{274,46},{275,47},{276,50},{277,51},{278,4},{279,1},{280,5},{282,52},{283,53},{284,54},{285,2},{286,55},{287,61},{288,64},{289,65},{290,67},{291,39},{292,40},{299,63},{336,48},{346,66},{348,34},{349,35},{350,37},{351,38},{354,74},{355,75},{387,69},{432,57},{449,70},{450,71},{451,72},{454,10},{460,11},{461,12},{470,24},{471,25},{472,26},{541,15},{543,23},{546,68},{625,49}};
+      return order;
+    }
       FIELD_SET(*this, FIX::MDUpdateAction);
       FIELD_SET(*this, FIX::DeleteReason);
       FIELD_SET(*this, FIX::MDEntryType);
@@ -62,7 +66,12 @@ namespace FIX43
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
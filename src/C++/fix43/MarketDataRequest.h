@@ -12,7 +12,6 @@ namespace FIX43
     MarketDataRequest() : Message(MsgType()) {}
     MarketDataRequest(const FIX::Message& m) : Message(m) {}
     MarketDataRequest(const Message& m) : Message(m) {}
-    MarketDataRequest(const MarketDataRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("V"); }
 
     MarketDataRequest(
@@ -38,14 +37,24 @@ namespace FIX43
     class NoMDEntryTypes: public FIX::Group
     {
     public:
-    NoMDEntryTypes() : FIX::Group(267,269,FIX::message_order(269,0)) {}
+    NoMDEntryTypes() : FIX::Group(267,269,FIX::message_order(fieldOrder(),1)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{269,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::MDEntryType);
     };
     FIELD_SET(*this, FIX::NoRelatedSym);
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,0)) {}
+    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(fieldOrder(),33)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{22,4},{48,3},{55,1},{65,2},{106,28},{107,31},{167,8},{200,9},{202,23},{206,24},{207,27},{223,26},{224,11},{225,12},{226,14},{227,15},{228,16},{231,25},{239,13},{240,22},{255,17},{348,29},{349,30},{350,32},{351,33},{454,5},{460,6},{461,7},{470,19},{471,20},{472,21},{541,10},{543,18}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -82,7 +91,12 @@ namespace FIX43
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
@@ -91,7 +105,12 @@ namespace FIX43
     class NoTradingSessions: public FIX::Group
     {
     public:
-    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
+    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{336,1},{625,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
     };
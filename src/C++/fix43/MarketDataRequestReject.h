@@ -12,7 +12,6 @@ namespace FIX43
     MarketDataRequestReject() : Message(MsgType()) {}
     MarketDataRequestReject(const FIX::Message& m) : Message(m) {}
     MarketDataRequestReject(const Message& m) : Message(m) {}
-    MarketDataRequestReject(const MarketDataRequestReject& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("Y"); }
 
     MarketDataRequestReject(
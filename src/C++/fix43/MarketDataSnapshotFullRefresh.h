@@ -12,7 +12,6 @@ namespace FIX43
     MarketDataSnapshotFullRefresh() : Message(MsgType()) {}
     MarketDataSnapshotFullRefresh(const FIX::Message& m) : Message(m) {}
     MarketDataSnapshotFullRefresh(const Message& m) : Message(m) {}
-    MarketDataSnapshotFullRefresh(const MarketDataSnapshotFullRefresh& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("W"); }
 
     FIELD_SET(*this, FIX::MDReqID);
@@ -52,7 +51,12 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -66,7 +70,12 @@ namespace FIX43
     class NoMDEntries: public FIX::Group
     {
     public:
-    NoMDEntries() : FIX::Group(268,269,FIX::message_order(269,270,15,271,272,273,274,275,336,625,276,277,282,283,284,286,59,432,126,110,18,287,37,299,288,289,346,290,546,58,354,355,0)) {}
+    NoMDEntries() : FIX::Group(268,269,FIX::message_order(fieldOrder(),32)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{15,3},{18,21},{37,23},{58,30},{59,17},{110,20},{126,19},{269,1},{270,2},{271,4},{272,5},{273,6},{274,7},{275,8},{276,11},{277,12},{282,13},{283,14},{284,15},{286,16},{287,22},{288,25},{289,26},{290,28},{299,24},{336,9},{346,27},{354,31},{355,32},{432,18},{546,29},{625,10}};
+      return order;
+    }
       FIELD_SET(*this, FIX::MDEntryType);
       FIELD_SET(*this, FIX::MDEntryPx);
       FIELD_SET(*this, FIX::Currency);
@@ -12,7 +12,6 @@ namespace FIX43
     MassQuoteAcknowledgement() : Message(MsgType()) {}
     MassQuoteAcknowledgement(const FIX::Message& m) : Message(m) {}
     MassQuoteAcknowledgement(const Message& m) : Message(m) {}
-    MassQuoteAcknowledgement(const MassQuoteAcknowledgement& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("b"); }
 
     MassQuoteAcknowledgement(
@@ -32,7 +31,12 @@ namespace FIX43
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{447,2},{448,1},{452,3},{523,4}};
+      return order;
+    }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -45,7 +49,12 @@ namespace FIX43
     class NoQuoteSets: public FIX::Group
     {
     public:
-    NoQuoteSets() : FIX::Group(296,302,FIX::message_order(302,311,312,309,305,457,462,463,310,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,317,436,435,308,306,362,363,307,364,365,304,295,0)) {}
+    NoQuoteSets() : FIX::Group(296,302,FIX::message_order(fieldOrder(),37)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{241,13},{242,14},{243,15},{244,16},{245,17},{246,18},{247,24},{256,19},{295,37},{302,1},{304,36},{305,5},{306,30},{307,33},{308,29},{309,4},{310,9},{311,2},{312,3},{313,10},{315,12},{316,25},{317,26},{362,31},{363,32},{364,34},{365,35},{435,28},{436,27},{457,6},{462,7},{463,8},{542,11},{592,21},{593,22},{594,23},{595,20}};
+      return order;
+    }
       FIELD_SET(*this, FIX::QuoteSetID);
       FIELD_SET(*this, FIX::UnderlyingSymbol);
       FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
@@ -84,7 +93,12 @@ namespace FIX43
       class NoUnderlyingSecurityAltID: public FIX::Group
       {
       public:
-      NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
+      NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{458,1},{459,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
         FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
       };
@@ -93,7 +107,12 @@ namespace FIX43
       class NoQuoteEntries: public FIX::Group
       {
       public:
-      NoQuoteEntries() : FIX::Group(295,299,FIX::message_order(299,55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,132,133,134,135,62,188,190,189,191,631,632,633,634,60,336,625,64,40,193,192,642,643,15,368,0)) {}
+      NoQuoteEntries() : FIX::Group(295,299,FIX::message_order(fieldOrder(),58)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{15,57},{22,5},{40,52},{48,4},{55,2},{60,48},{62,39},{64,51},{65,3},{106,29},{107,32},{132,35},{133,36},{134,37},{135,38},{167,9},{188,40},{189,42},{190,41},{191,43},{192,54},{193,53},{200,10},{202,24},{206,25},{207,28},{223,27},{224,12},{225,13},{226,15},{227,16},{228,17},{231,26},{239,14},{240,23},{255,18},{299,1},{336,49},{348,30},{349,31},{350,33},{351,34},{368,58},{454,6},{460,7},{461,8},{470,20},{471,21},{472,22},{541,11},{543,19},{625,50},{631,44},{632,45},{633,46},{634,47},{642,55},{643,56}};
+        return order;
+      }
         FIELD_SET(*this, FIX::QuoteEntryID);
         FIELD_SET(*this, FIX::Symbol);
         FIELD_SET(*this, FIX::SymbolSfx);
@@ -131,7 +150,12 @@ namespace FIX43
         class NoSecurityAltID: public FIX::Group
         {
         public:
-        NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+        NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+          return order;
+        }
           FIELD_SET(*this, FIX::SecurityAltID);
           FIELD_SET(*this, FIX::SecurityAltIDSource);
         };
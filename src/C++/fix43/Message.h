@@ -40,7 +40,12 @@ namespace FIX43
     class NoHops: public FIX::Group
     {
     public:
-    NoHops() : FIX::Group(627,628,FIX::message_order(628,629,630,0)) {}
+    NoHops() : FIX::Group(627,628,FIX::message_order(fieldOrder(),3)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{628,1},{629,2},{630,3}};
+      return order;
+    }
       FIELD_SET(*this, FIX::HopCompID);
       FIELD_SET(*this, FIX::HopSendingTime);
       FIELD_SET(*this, FIX::HopRefID);
@@ -64,7 +69,6 @@ namespace FIX43
      {} 
 
     Message(const FIX::Message& m) : FIX::Message(m) {}
-    Message(const Message& m) : FIX::Message(m) {}
     Header& getHeader() { return (Header&)m_header; }
     const Header& getHeader() const { return (Header&)m_header; }
     Trailer& getTrailer() { return (Trailer&)m_trailer; }
@@ -316,426 +316,295 @@ public:
   void crack( const Message& message, 
               const FIX::SessionID& sessionID )
   {
-    const std::string& msgTypeValue 
-      = message.getHeader().getField( FIX::FIELD::MsgType );
-    
-    if( msgTypeValue == "0" )
-      onMessage( (const Heartbeat&)message, sessionID );
-    else
-    if( msgTypeValue == "1" )
-      onMessage( (const TestRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "2" )
-      onMessage( (const ResendRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "3" )
-      onMessage( (const Reject&)message, sessionID );
-    else
-    if( msgTypeValue == "4" )
-      onMessage( (const SequenceReset&)message, sessionID );
-    else
-    if( msgTypeValue == "5" )
-      onMessage( (const Logout&)message, sessionID );
-    else
-    if( msgTypeValue == "6" )
-      onMessage( (const IOI&)message, sessionID );
-    else
-    if( msgTypeValue == "7" )
-      onMessage( (const Advertisement&)message, sessionID );
-    else
-    if( msgTypeValue == "8" )
-      onMessage( (const ExecutionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "9" )
-      onMessage( (const OrderCancelReject&)message, sessionID );
-    else
-    if( msgTypeValue == "A" )
-      onMessage( (const Logon&)message, sessionID );
-    else
-    if( msgTypeValue == "B" )
-      onMessage( (const News&)message, sessionID );
-    else
-    if( msgTypeValue == "C" )
-      onMessage( (const Email&)message, sessionID );
-    else
-    if( msgTypeValue == "D" )
-      onMessage( (const NewOrderSingle&)message, sessionID );
-    else
-    if( msgTypeValue == "E" )
-      onMessage( (const NewOrderList&)message, sessionID );
-    else
-    if( msgTypeValue == "F" )
-      onMessage( (const OrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "G" )
-      onMessage( (const OrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "H" )
-      onMessage( (const OrderStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "J" )
-      onMessage( (const Allocation&)message, sessionID );
-    else
-    if( msgTypeValue == "K" )
-      onMessage( (const ListCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "L" )
-      onMessage( (const ListExecute&)message, sessionID );
-    else
-    if( msgTypeValue == "M" )
-      onMessage( (const ListStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "N" )
-      onMessage( (const ListStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "P" )
-      onMessage( (const AllocationAck&)message, sessionID );
-    else
-    if( msgTypeValue == "Q" )
-      onMessage( (const DontKnowTrade&)message, sessionID );
-    else
-    if( msgTypeValue == "R" )
-      onMessage( (const QuoteRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "S" )
-      onMessage( (const Quote&)message, sessionID );
-    else
-    if( msgTypeValue == "T" )
-      onMessage( (const SettlementInstructions&)message, sessionID );
-    else
-    if( msgTypeValue == "V" )
-      onMessage( (const MarketDataRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "W" )
-      onMessage( (const MarketDataSnapshotFullRefresh&)message, sessionID );
-    else
-    if( msgTypeValue == "X" )
-      onMessage( (const MarketDataIncrementalRefresh&)message, sessionID );
-    else
-    if( msgTypeValue == "Y" )
-      onMessage( (const MarketDataRequestReject&)message, sessionID );
-    else
-    if( msgTypeValue == "Z" )
-      onMessage( (const QuoteCancel&)message, sessionID );
-    else
-    if( msgTypeValue == "a" )
-      onMessage( (const QuoteStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "b" )
-      onMessage( (const MassQuoteAcknowledgement&)message, sessionID );
-    else
-    if( msgTypeValue == "c" )
-      onMessage( (const SecurityDefinitionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "d" )
-      onMessage( (const SecurityDefinition&)message, sessionID );
-    else
-    if( msgTypeValue == "e" )
-      onMessage( (const SecurityStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "f" )
-      onMessage( (const SecurityStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "g" )
-      onMessage( (const TradingSessionStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "h" )
-      onMessage( (const TradingSessionStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "i" )
-      onMessage( (const MassQuote&)message, sessionID );
-    else
-    if( msgTypeValue == "j" )
-      onMessage( (const BusinessMessageReject&)message, sessionID );
-    else
-    if( msgTypeValue == "k" )
-      onMessage( (const BidRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "l" )
-      onMessage( (const BidResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "m" )
-      onMessage( (const ListStrikePrice&)message, sessionID );
-    else
-    if( msgTypeValue == "n" )
-      onMessage( (const XMLnonFIX&)message, sessionID );
-    else
-    if( msgTypeValue == "o" )
-      onMessage( (const RegistrationInstructions&)message, sessionID );
-    else
-    if( msgTypeValue == "p" )
-      onMessage( (const RegistrationInstructionsResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "q" )
-      onMessage( (const OrderMassCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "r" )
-      onMessage( (const OrderMassCancelReport&)message, sessionID );
-    else
-    if( msgTypeValue == "s" )
-      onMessage( (const NewOrderCross&)message, sessionID );
-    else
-    if( msgTypeValue == "u" )
-      onMessage( (const CrossOrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "t" )
-      onMessage( (const CrossOrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "v" )
-      onMessage( (const SecurityTypeRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "w" )
-      onMessage( (const SecurityTypes&)message, sessionID );
-    else
-    if( msgTypeValue == "x" )
-      onMessage( (const SecurityListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "y" )
-      onMessage( (const SecurityList&)message, sessionID );
-    else
-    if( msgTypeValue == "z" )
-      onMessage( (const DerivativeSecurityListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AA" )
-      onMessage( (const DerivativeSecurityList&)message, sessionID );
-    else
-    if( msgTypeValue == "AB" )
-      onMessage( (const NewOrderMultileg&)message, sessionID );
-    else
-    if( msgTypeValue == "AC" )
-      onMessage( (const MultilegOrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AD" )
-      onMessage( (const TradeCaptureReportRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AE" )
-      onMessage( (const TradeCaptureReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AF" )
-      onMessage( (const OrderMassStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AG" )
-      onMessage( (const QuoteRequestReject&)message, sessionID );
-    else
-    if( msgTypeValue == "AH" )
-      onMessage( (const RFQRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AI" )
-      onMessage( (const QuoteStatusReport&)message, sessionID );
-    else onMessage( message, sessionID );
+    switch( FIX::Message::msgTypeId(
+      message.getHeader().getField( FIX::FIELD::MsgType ) ) )
+    {
+    case FIX_MSGTYPE_ID( '0', 0 ):
+      onMessage( (const Heartbeat&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '1', 0 ):
+      onMessage( (const TestRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '2', 0 ):
+      onMessage( (const ResendRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '3', 0 ):
+      onMessage( (const Reject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '4', 0 ):
+      onMessage( (const SequenceReset&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '5', 0 ):
+      onMessage( (const Logout&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '6', 0 ):
+      onMessage( (const IOI&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '7', 0 ):
+      onMessage( (const Advertisement&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '8', 0 ):
+      onMessage( (const ExecutionReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '9', 0 ):
+      onMessage( (const OrderCancelReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 0 ):
+      onMessage( (const Logon&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 0 ):
+      onMessage( (const News&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'C', 0 ):
+      onMessage( (const Email&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'D', 0 ):
+      onMessage( (const NewOrderSingle&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'E', 0 ):
+      onMessage( (const NewOrderList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'F', 0 ):
+      onMessage( (const OrderCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'G', 0 ):
+      onMessage( (const OrderCancelReplaceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'H', 0 ):
+      onMessage( (const OrderStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'J', 0 ):
+      onMessage( (const Allocation&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'K', 0 ):
+      onMessage( (const ListCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'L', 0 ):
+      onMessage( (const ListExecute&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'M', 0 ):
+      onMessage( (const ListStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'N', 0 ):
+      onMessage( (const ListStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'P', 0 ):
+      onMessage( (const AllocationAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Q', 0 ):
+      onMessage( (const DontKnowTrade&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'R', 0 ):
+      onMessage( (const QuoteRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'S', 0 ):
+      onMessage( (const Quote&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'T', 0 ):
+      onMessage( (const SettlementInstructions&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'V', 0 ):
+      onMessage( (const MarketDataRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'W', 0 ):
+      onMessage( (const MarketDataSnapshotFullRefresh&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'X', 0 ):
+      onMessage( (const MarketDataIncrementalRefresh&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Y', 0 ):
+      onMessage( (const MarketDataRequestReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Z', 0 ):
+      onMessage( (const QuoteCancel&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'a', 0 ):
+      onMessage( (const QuoteStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'b', 0 ):
+      onMessage( (const MassQuoteAcknowledgement&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'c', 0 ):
+      onMessage( (const SecurityDefinitionRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'd', 0 ):
+      onMessage( (const SecurityDefinition&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'e', 0 ):
+      onMessage( (const SecurityStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'f', 0 ):
+      onMessage( (const SecurityStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'g', 0 ):
+      onMessage( (const TradingSessionStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'h', 0 ):
+      onMessage( (const TradingSessionStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'i', 0 ):
+      onMessage( (const MassQuote&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'j', 0 ):
+      onMessage( (const BusinessMessageReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'k', 0 ):
+      onMessage( (const BidRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'l', 0 ):
+      onMessage( (const BidResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'm', 0 ):
+      onMessage( (const ListStrikePrice&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'n', 0 ):
+      onMessage( (const XMLnonFIX&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'o', 0 ):
+      onMessage( (const RegistrationInstructions&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'p', 0 ):
+      onMessage( (const RegistrationInstructionsResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'q', 0 ):
+      onMessage( (const OrderMassCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'r', 0 ):
+      onMessage( (const OrderMassCancelReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 's', 0 ):
+      onMessage( (const NewOrderCross&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'u', 0 ):
+      onMessage( (const CrossOrderCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 't', 0 ):
+      onMessage( (const CrossOrderCancelReplaceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'v', 0 ):
+      onMessage( (const SecurityTypeRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'w', 0 ):
+      onMessage( (const SecurityTypes&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'x', 0 ):
+      onMessage( (const SecurityListRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'y', 0 ):
+      onMessage( (const SecurityList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'z', 0 ):
+      onMessage( (const DerivativeSecurityListRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'A' ):
+      onMessage( (const DerivativeSecurityList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'B' ):
+      onMessage( (const NewOrderMultileg&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'C' ):
+      onMessage( (const MultilegOrderCancelReplaceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'D' ):
+      onMessage( (const TradeCaptureReportRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'E' ):
+      onMessage( (const TradeCaptureReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'F' ):
+      onMessage( (const OrderMassStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'G' ):
+      onMessage( (const QuoteRequestReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'H' ):
+      onMessage( (const RFQRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'I' ):
+      onMessage( (const QuoteStatusReport&)message, sessionID ); break;
+    default:
+      onMessage( message, sessionID );
+    }
   }
   
 void crack( Message& message, 
             const FIX::SessionID& sessionID )
   {
-    FIX::MsgType msgType;
-    message.getHeader().getField(msgType);
-    std::string msgTypeValue = msgType.getValue();
-    
-    if( msgTypeValue == "0" )
-      onMessage( (Heartbeat&)message, sessionID );
-    else
-    if( msgTypeValue == "1" )
-      onMessage( (TestRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "2" )
-      onMessage( (ResendRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "3" )
-      onMessage( (Reject&)message, sessionID );
-    else
-    if( msgTypeValue == "4" )
-      onMessage( (SequenceReset&)message, sessionID );
-    else
-    if( msgTypeValue == "5" )
-      onMessage( (Logout&)message, sessionID );
-    else
-    if( msgTypeValue == "6" )
-      onMessage( (IOI&)message, sessionID );
-    else
-    if( msgTypeValue == "7" )
-      onMessage( (Advertisement&)message, sessionID );
-    else
-    if( msgTypeValue == "8" )
-      onMessage( (ExecutionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "9" )
-      onMessage( (OrderCancelReject&)message, sessionID );
-    else
-    if( msgTypeValue == "A" )
-      onMessage( (Logon&)message, sessionID );
-    else
-    if( msgTypeValue == "B" )
-      onMessage( (News&)message, sessionID );
-    else
-    if( msgTypeValue == "C" )
-      onMessage( (Email&)message, sessionID );
-    else
-    if( msgTypeValue == "D" )
-      onMessage( (NewOrderSingle&)message, sessionID );
-    else
-    if( msgTypeValue == "E" )
-      onMessage( (NewOrderList&)message, sessionID );
-    else
-    if( msgTypeValue == "F" )
-      onMessage( (OrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "G" )
-      onMessage( (OrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "H" )
-      onMessage( (OrderStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "J" )
-      onMessage( (Allocation&)message, sessionID );
-    else
-    if( msgTypeValue == "K" )
-      onMessage( (ListCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "L" )
-      onMessage( (ListExecute&)message, sessionID );
-    else
-    if( msgTypeValue == "M" )
-      onMessage( (ListStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "N" )
-      onMessage( (ListStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "P" )
-      onMessage( (AllocationAck&)message, sessionID );
-    else
-    if( msgTypeValue == "Q" )
-      onMessage( (DontKnowTrade&)message, sessionID );
-    else
-    if( msgTypeValue == "R" )
-      onMessage( (QuoteRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "S" )
-      onMessage( (Quote&)message, sessionID );
-    else
-    if( msgTypeValue == "T" )
-      onMessage( (SettlementInstructions&)message, sessionID );
-    else
-    if( msgTypeValue == "V" )
-      onMessage( (MarketDataRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "W" )
-      onMessage( (MarketDataSnapshotFullRefresh&)message, sessionID );
-    else
-    if( msgTypeValue == "X" )
-      onMessage( (MarketDataIncrementalRefresh&)message, sessionID );
-    else
-    if( msgTypeValue == "Y" )
-      onMessage( (MarketDataRequestReject&)message, sessionID );
-    else
-    if( msgTypeValue == "Z" )
-      onMessage( (QuoteCancel&)message, sessionID );
-    else
-    if( msgTypeValue == "a" )
-      onMessage( (QuoteStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "b" )
-      onMessage( (MassQuoteAcknowledgement&)message, sessionID );
-    else
-    if( msgTypeValue == "c" )
-      onMessage( (SecurityDefinitionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "d" )
-      onMessage( (SecurityDefinition&)message, sessionID );
-    else
-    if( msgTypeValue == "e" )
-      onMessage( (SecurityStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "f" )
-      onMessage( (SecurityStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "g" )
-      onMessage( (TradingSessionStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "h" )
-      onMessage( (TradingSessionStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "i" )
-      onMessage( (MassQuote&)message, sessionID );
-    else
-    if( msgTypeValue == "j" )
-      onMessage( (BusinessMessageReject&)message, sessionID );
-    else
-    if( msgTypeValue == "k" )
-      onMessage( (BidRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "l" )
-      onMessage( (BidResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "m" )
-      onMessage( (ListStrikePrice&)message, sessionID );
-    else
-    if( msgTypeValue == "n" )
-      onMessage( (XMLnonFIX&)message, sessionID );
-    else
-    if( msgTypeValue == "o" )
-      onMessage( (RegistrationInstructions&)message, sessionID );
-    else
-    if( msgTypeValue == "p" )
-      onMessage( (RegistrationInstructionsResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "q" )
-      onMessage( (OrderMassCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "r" )
-      onMessage( (OrderMassCancelReport&)message, sessionID );
-    else
-    if( msgTypeValue == "s" )
-      onMessage( (NewOrderCross&)message, sessionID );
-    else
-    if( msgTypeValue == "u" )
-      onMessage( (CrossOrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "t" )
-      onMessage( (CrossOrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "v" )
-      onMessage( (SecurityTypeRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "w" )
-      onMessage( (SecurityTypes&)message, sessionID );
-    else
-    if( msgTypeValue == "x" )
-      onMessage( (SecurityListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "y" )
-      onMessage( (SecurityList&)message, sessionID );
-    else
-    if( msgTypeValue == "z" )
-      onMessage( (DerivativeSecurityListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AA" )
-      onMessage( (DerivativeSecurityList&)message, sessionID );
-    else
-    if( msgTypeValue == "AB" )
-      onMessage( (NewOrderMultileg&)message, sessionID );
-    else
-    if( msgTypeValue == "AC" )
-      onMessage( (MultilegOrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AD" )
-      onMessage( (TradeCaptureReportRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AE" )
-      onMessage( (TradeCaptureReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AF" )
-      onMessage( (OrderMassStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AG" )
-      onMessage( (QuoteRequestReject&)message, sessionID );
-    else
-    if( msgTypeValue == "AH" )
-      onMessage( (RFQRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AI" )
-      onMessage( (QuoteStatusReport&)message, sessionID );
-    else onMessage( message, sessionID );
+    switch( FIX::Message::msgTypeId(
+      message.getHeader().getField( FIX::FIELD::MsgType ) ) )
+    {
+    case FIX_MSGTYPE_ID( '0', 0 ):
+      onMessage( (Heartbeat&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '1', 0 ):
+      onMessage( (TestRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '2', 0 ):
+      onMessage( (ResendRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '3', 0 ):
+      onMessage( (Reject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '4', 0 ):
+      onMessage( (SequenceReset&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '5', 0 ):
+      onMessage( (Logout&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '6', 0 ):
+      onMessage( (IOI&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '7', 0 ):
+      onMessage( (Advertisement&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '8', 0 ):
+      onMessage( (ExecutionReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '9', 0 ):
+      onMessage( (OrderCancelReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 0 ):
+      onMessage( (Logon&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 0 ):
+      onMessage( (News&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'C', 0 ):
+      onMessage( (Email&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'D', 0 ):
+      onMessage( (NewOrderSingle&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'E', 0 ):
+      onMessage( (NewOrderList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'F', 0 ):
+      onMessage( (OrderCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'G', 0 ):
+      onMessage( (OrderCancelReplaceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'H', 0 ):
+      onMessage( (OrderStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'J', 0 ):
+      onMessage( (Allocation&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'K', 0 ):
+      onMessage( (ListCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'L', 0 ):
+      onMessage( (ListExecute&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'M', 0 ):
+      onMessage( (ListStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'N', 0 ):
+      onMessage( (ListStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'P', 0 ):
+      onMessage( (AllocationAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Q', 0 ):
+      onMessage( (DontKnowTrade&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'R', 0 ):
+      onMessage( (QuoteRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'S', 0 ):
+      onMessage( (Quote&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'T', 0 ):
+      onMessage( (SettlementInstructions&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'V', 0 ):
+      onMessage( (MarketDataRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'W', 0 ):
+      onMessage( (MarketDataSnapshotFullRefresh&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'X', 0 ):
+      onMessage( (MarketDataIncrementalRefresh&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Y', 0 ):
+      onMessage( (MarketDataRequestReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Z', 0 ):
+      onMessage( (QuoteCancel&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'a', 0 ):
+      onMessage( (QuoteStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'b', 0 ):
+      onMessage( (MassQuoteAcknowledgement&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'c', 0 ):
+      onMessage( (SecurityDefinitionRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'd', 0 ):
+      onMessage( (SecurityDefinition&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'e', 0 ):
+      onMessage( (SecurityStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'f', 0 ):
+      onMessage( (SecurityStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'g', 0 ):
+      onMessage( (TradingSessionStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'h', 0 ):
+      onMessage( (TradingSessionStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'i', 0 ):
+      onMessage( (MassQuote&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'j', 0 ):
+      onMessage( (BusinessMessageReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'k', 0 ):
+      onMessage( (BidRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'l', 0 ):
+      onMessage( (BidResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'm', 0 ):
+      onMessage( (ListStrikePrice&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'n', 0 ):
+      onMessage( (XMLnonFIX&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'o', 0 ):
+      onMessage( (RegistrationInstructions&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'p', 0 ):
+      onMessage( (RegistrationInstructionsResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'q', 0 ):
+      onMessage( (OrderMassCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'r', 0 ):
+      onMessage( (OrderMassCancelReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 's', 0 ):
+      onMessage( (NewOrderCross&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'u', 0 ):
+      onMessage( (CrossOrderCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 't', 0 ):
+      onMessage( (CrossOrderCancelReplaceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'v', 0 ):
+      onMessage( (SecurityTypeRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'w', 0 ):
+      onMessage( (SecurityTypes&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'x', 0 ):
+      onMessage( (SecurityListRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'y', 0 ):
+      onMessage( (SecurityList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'z', 0 ):
+      onMessage( (DerivativeSecurityListRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'A' ):
+      onMessage( (DerivativeSecurityList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'B' ):
+      onMessage( (NewOrderMultileg&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'C' ):
+      onMessage( (MultilegOrderCancelReplaceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'D' ):
+      onMessage( (TradeCaptureReportRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'E' ):
+      onMessage( (TradeCaptureReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'F' ):
+      onMessage( (OrderMassStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'G' ):
+      onMessage( (QuoteRequestReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'H' ):
+      onMessage( (RFQRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'I' ):
+      onMessage( (QuoteStatusReport&)message, sessionID ); break;
+    default:
+      onMessage( message, sessionID );
+    }
   }
 
   };
@@ -12,7 +12,6 @@ namespace FIX43
     NewOrderList() : Message(MsgType()) {}
     NewOrderList(const FIX::Message& m) : Message(m) {}
     NewOrderList(const Message& m) : Message(m) {}
-    NewOrderList(const NewOrderList& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("E"); }
 
     NewOrderList(
@@ -44,7 +43,12 @@ namespace FIX43
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,526,67,583,160,453,229,1,581,589,590,591,78,63,64,544,635,21,18,110,111,100,386,81,55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,140,54,401,114,60,232,465,38,152,516,468,469,40,423,44,99,218,220,221,222,235,236,15,376,377,23,117,59,168,432,126,427,12,13,479,497,528,529,582,47,121,120,58,354,355,193,192,640,77,203,210,211,388,389,494,158,159,118,0)) {}
+    NoOrders() : FIX::Group(73,11,FIX::message_order(fieldOrder(),115)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1,8},{11,1},{12,90},{13,91},{15,80},{18,19},{21,18},{22,28},{23,83},{38,65},{40,70},{44,72},{47,97},{48,27},{54,59},{55,25},{58,100},{59,85},{60,62},{63,14},{64,15},{65,26},{67,3},{77,106},{78,13},{81,24},{99,73},{100,22},{106,52},{107,55},{110,20},{111,21},{114,61},{117,84},{118,115},{120,99},{121,98},{126,88},{140,58},{152,66},{158,113},{159,114},{160,5},{167,32},{168,86},{192,104},{193,103},{200,33},{202,47},{203,107},{206,48},{207,51},{210,108},{211,109},{218,74},{220,75},{221,76},{222,77},{223,50},{224,35},{225,36},{226,38},{227,39},{228,40},{229,7},{231,49},{232,63},{235,78},{236,79},{239,37},{240,46},{255,41},{348,53},{349,54},{350,56},{351,57},{354,101},{355,102},{376,81},{377,82},{386,23},{388,110},{389,111},{401,60},{423,71},{427,89},{432,87},{453,6},{454,29},{460,30},{461,31},{465,64},{468,68},{469,69},{470,43},{471,44},{472,45},{479,92},{494,112},{497,93},{516,67},{526,2},{528,94},{529,95},{541,34},{543,42},{544,16},{581,9},{582,96},{583,4},{589,10},{590,11},{591,12},{635,17},{640,105}};
+      return order;
+    }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::SecondaryClOrdID);
       FIELD_SET(*this, FIX::ListSeqNo);
@@ -54,7 +58,12 @@ namespace FIX43
       class NoPartyIDs: public FIX::Group
       {
       public:
-      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(fieldOrder(),4)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{447,2},{448,1},{452,3},{523,4}};
+        return order;
+      }
         FIELD_SET(*this, FIX::PartyID);
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
@@ -112,7 +121,12 @@ namespace FIX43
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
@@ -125,7 +139,12 @@ namespace FIX43
       class NoStipulations: public FIX::Group
       {
       public:
-      NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
+      NoStipulations() : FIX::Group(232,233,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{233,1},{234,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::StipulationType);
         FIELD_SET(*this, FIX::StipulationValue);
       };
@@ -185,14 +204,24 @@ namespace FIX43
       class NoAllocs: public FIX::Group
       {
       public:
-      NoAllocs() : FIX::Group(78,79,FIX::message_order(79,467,539,80,0)) {}
+      NoAllocs() : FIX::Group(78,79,FIX::message_order(fieldOrder(),4)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{79,1},{80,4},{467,2},{539,3}};
+        return order;
+      }
         FIELD_SET(*this, FIX::AllocAccount);
         FIELD_SET(*this, FIX::IndividualAllocID);
         FIELD_SET(*this, FIX::NoNestedPartyIDs);
         class NoNestedPartyIDs: public FIX::Group
         {
         public:
-        NoNestedPartyIDs() : FIX::Group(539,524,FIX::message_order(524,525,538,545,0)) {}
+        NoNestedPartyIDs() : FIX::Group(539,524,FIX::message_order(fieldOrder(),4)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{524,1},{525,2},{538,3},{545,4}};
+          return order;
+        }
           FIELD_SET(*this, FIX::NestedPartyID);
           FIELD_SET(*this, FIX::NestedPartyIDSource);
           FIELD_SET(*this, FIX::NestedPartyRole);
@@ -204,7 +233,12 @@ namespace FIX43
       class NoTradingSessions: public FIX::Group
       {
       public:
-      NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
+      NoTradingSessions() : FIX::Group(386,336,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{336,1},{625,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::TradingSessionID);
         FIELD_SET(*this, FIX::TradingSessionSubID);
       };
@@ -12,7 +12,6 @@ namespace FIX43
     OrderMassCancelRequest() : Message(MsgType()) {}
     OrderMassCancelRequest(const FIX::Message& m) : Message(m) {}
     OrderMassCancelRequest(const Message& m) : Message(m) {}
-    OrderMassCancelRequest(const OrderMassCancelRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("q"); }
 
     OrderMassCancelRequest(
@@ -67,7 +66,12 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -108,7 +112,12 @@ namespace FIX43
     class NoUnderlyingSecurityAltID: public FIX::Group
     {
     public:
-    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
+    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{458,1},{459,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
     };
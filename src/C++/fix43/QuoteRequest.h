@@ -12,7 +12,6 @@ namespace FIX43
     QuoteRequest() : Message(MsgType()) {}
     QuoteRequest(const FIX::Message& m) : Message(m) {}
     QuoteRequest(const Message& m) : Message(m) {}
-    QuoteRequest(const QuoteRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("R"); }
 
     QuoteRequest(
@@ -31,7 +30,12 @@ namespace FIX43
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,140,303,537,336,625,229,232,54,465,38,152,63,64,40,193,192,126,60,15,218,220,221,222,423,44,640,235,236,0)) {}
+    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(fieldOrder(),61)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{15,52},{22,4},{38,43},{40,47},{44,58},{48,3},{54,41},{55,1},{60,51},{63,45},{64,46},{65,2},{106,28},{107,31},{126,50},{140,34},{152,44},{167,8},{192,49},{193,48},{200,9},{202,23},{206,24},{207,27},{218,53},{220,54},{221,55},{222,56},{223,26},{224,11},{225,12},{226,14},{227,15},{228,16},{229,39},{231,25},{232,40},{235,60},{236,61},{239,13},{240,22},{255,17},{303,35},{336,37},{348,29},{349,30},{350,32},{351,33},{423,57},{454,5},{460,6},{461,7},{465,42},{470,19},{471,20},{472,21},{537,36},{541,10},{543,18},{625,38},{640,59}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -68,7 +72,12 @@ namespace FIX43
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
@@ -82,7 +91,12 @@ namespace FIX43
       class NoStipulations: public FIX::Group
       {
       public:
-      NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
+      NoStipulations() : FIX::Group(232,233,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{233,1},{234,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::StipulationType);
         FIELD_SET(*this, FIX::StipulationValue);
       };
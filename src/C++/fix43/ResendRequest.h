@@ -12,7 +12,6 @@ namespace FIX43
     ResendRequest() : Message(MsgType()) {}
     ResendRequest(const FIX::Message& m) : Message(m) {}
     ResendRequest(const Message& m) : Message(m) {}
-    ResendRequest(const ResendRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("2"); }
 
     ResendRequest(
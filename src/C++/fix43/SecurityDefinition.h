@@ -12,7 +12,6 @@ namespace FIX43
     SecurityDefinition() : Message(MsgType()) {}
     SecurityDefinition(const FIX::Message& m) : Message(m) {}
     SecurityDefinition(const Message& m) : Message(m) {}
-    SecurityDefinition(const SecurityDefinition& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("d"); }
 
     SecurityDefinition(
@@ -65,7 +64,12 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -81,7 +85,12 @@ namespace FIX43
     class NoLegs: public FIX::Group
     {
     public:
-    NoLegs() : FIX::Group(555,600,FIX::message_order(600,601,602,603,604,607,608,609,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,613,614,615,616,617,618,619,620,621,622,623,624,556,0)) {}
+    NoLegs() : FIX::Group(555,600,FIX::message_order(fieldOrder(),36)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{248,11},{249,12},{250,13},{251,14},{252,15},{253,16},{254,22},{257,17},{556,36},{596,19},{597,20},{598,21},{599,18},{600,1},{601,2},{602,3},{603,4},{604,5},{607,6},{608,7},{609,8},{610,9},{611,10},{612,23},{613,24},{614,25},{615,26},{616,27},{617,28},{618,29},{619,30},{620,31},{621,32},{622,33},{623,34},{624,35}};
+      return order;
+    }
       FIELD_SET(*this, FIX::LegSymbol);
       FIELD_SET(*this, FIX::LegSymbolSfx);
       FIELD_SET(*this, FIX::LegSecurityID);
@@ -120,7 +129,12 @@ namespace FIX43
       class NoLegSecurityAltID: public FIX::Group
       {
       public:
-      NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
+      NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{605,1},{606,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::LegSecurityAltID);
         FIELD_SET(*this, FIX::LegSecurityAltIDSource);
       };
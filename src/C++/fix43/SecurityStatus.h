@@ -12,7 +12,6 @@ namespace FIX43
     SecurityStatus() : Message(MsgType()) {}
     SecurityStatus(const FIX::Message& m) : Message(m) {}
     SecurityStatus(const Message& m) : Message(m) {}
-    SecurityStatus(const SecurityStatus& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("f"); }
 
     FIELD_SET(*this, FIX::SecurityStatusReqID);
@@ -52,7 +51,12 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -12,7 +12,6 @@ namespace FIX43
     SecurityTypes() : Message(MsgType()) {}
     SecurityTypes(const FIX::Message& m) : Message(m) {}
     SecurityTypes(const Message& m) : Message(m) {}
-    SecurityTypes(const SecurityTypes& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("w"); }
 
     SecurityTypes(
@@ -40,7 +39,12 @@ namespace FIX43
     class NoSecurityTypes: public FIX::Group
     {
     public:
-    NoSecurityTypes() : FIX::Group(558,167,FIX::message_order(167,460,461,0)) {}
+    NoSecurityTypes() : FIX::Group(558,167,FIX::message_order(fieldOrder(),3)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{167,1},{460,2},{461,3}};
+      return order;
+    }
       FIELD_SET(*this, FIX::SecurityType);
       FIELD_SET(*this, FIX::Product);
       FIELD_SET(*this, FIX::CFICode);
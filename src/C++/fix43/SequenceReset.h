@@ -12,7 +12,6 @@ namespace FIX43
     SequenceReset() : Message(MsgType()) {}
     SequenceReset(const FIX::Message& m) : Message(m) {}
     SequenceReset(const Message& m) : Message(m) {}
-    SequenceReset(const SequenceReset& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("4"); }
 
     SequenceReset(
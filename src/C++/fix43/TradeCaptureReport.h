@@ -12,7 +12,6 @@ namespace FIX43
     TradeCaptureReport() : Message(MsgType()) {}
     TradeCaptureReport(const FIX::Message& m) : Message(m) {}
     TradeCaptureReport(const Message& m) : Message(m) {}
-    TradeCaptureReport(const TradeCaptureReport& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("AE"); }
 
     TradeCaptureReport(
@@ -79,7 +78,12 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -103,7 +107,12 @@ namespace FIX43
     class NoSides: public FIX::Group
     {
     public:
-    NoSides() : FIX::Group(552,54,FIX::message_order(54,37,198,11,453,1,581,81,575,576,635,578,579,15,376,377,528,529,582,483,336,625,12,13,479,497,381,157,230,158,159,238,237,118,119,120,155,156,77,58,354,355,442,518,136,0)) {}
+    NoSides() : FIX::Group(552,54,FIX::message_order(fieldOrder(),45)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1,6},{11,4},{12,23},{13,24},{15,14},{37,2},{54,1},{58,40},{77,39},{81,8},{118,34},{119,35},{120,36},{136,45},{155,37},{156,38},{157,28},{158,30},{159,31},{198,3},{230,29},{237,33},{238,32},{336,21},{354,41},{355,42},{376,15},{377,16},{381,27},{442,43},{453,5},{479,25},{483,20},{497,26},{518,44},{528,17},{529,18},{575,9},{576,10},{578,12},{579,13},{581,7},{582,19},{625,22},{635,11}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Side);
       FIELD_SET(*this, FIX::OrderID);
       FIELD_SET(*this, FIX::SecondaryOrderID);
@@ -112,7 +121,12 @@ namespace FIX43
       class NoPartyIDs: public FIX::Group
       {
       public:
-      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(fieldOrder(),4)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{447,2},{448,1},{452,3},{523,4}};
+        return order;
+      }
         FIELD_SET(*this, FIX::PartyID);
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
@@ -159,14 +173,24 @@ namespace FIX43
       class NoClearingInstructions: public FIX::Group
       {
       public:
-      NoClearingInstructions() : FIX::Group(576,577,FIX::message_order(577,0)) {}
+      NoClearingInstructions() : FIX::Group(576,577,FIX::message_order(fieldOrder(),1)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{577,1}};
+        return order;
+      }
         FIELD_SET(*this, FIX::ClearingInstruction);
       };
       FIELD_SET(*this, FIX::NoContAmts);
       class NoContAmts: public FIX::Group
       {
       public:
-      NoContAmts() : FIX::Group(518,519,FIX::message_order(519,520,521,0)) {}
+      NoContAmts() : FIX::Group(518,519,FIX::message_order(fieldOrder(),3)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{519,1},{520,2},{521,3}};
+        return order;
+      }
         FIELD_SET(*this, FIX::ContAmtType);
         FIELD_SET(*this, FIX::ContAmtValue);
         FIELD_SET(*this, FIX::ContAmtCurr);
@@ -175,7 +199,12 @@ namespace FIX43
       class NoMiscFees: public FIX::Group
       {
       public:
-      NoMiscFees() : FIX::Group(136,137,FIX::message_order(137,138,139,0)) {}
+      NoMiscFees() : FIX::Group(136,137,FIX::message_order(fieldOrder(),3)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{137,1},{138,2},{139,3}};
+        return order;
+      }
         FIELD_SET(*this, FIX::MiscFeeAmt);
         FIELD_SET(*this, FIX::MiscFeeCurr);
         FIELD_SET(*this, FIX::MiscFeeType);
@@ -12,7 +12,6 @@ namespace FIX43
     XMLnonFIX() : Message(MsgType()) {}
     XMLnonFIX(const FIX::Message& m) : Message(m) {}
     XMLnonFIX(const Message& m) : Message(m) {}
-    XMLnonFIX(const XMLnonFIX& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("n"); }
 
   };
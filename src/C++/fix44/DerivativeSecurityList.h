@@ -12,7 +12,6 @@ namespace FIX44
     DerivativeSecurityList() : Message(MsgType()) {}
     DerivativeSecurityList(const FIX::Message& m) : Message(m) {}
     DerivativeSecurityList(const Message& m) : Message(m) {}
-    DerivativeSecurityList(const DerivativeSecurityList& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("AA"); }
 
     DerivativeSecurityList(
@@ -37,7 +36,12 @@ namespace FIX44
     class NoUnderlyingSecurityAltID: public FIX::Group
     {
     public:
-    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
+    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{458,1},{459,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
     };
@@ -86,7 +90,12 @@ namespace FIX44
     class NoUnderlyingStips: public FIX::Group
     {
     public:
-    NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
+    NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{888,1},{889,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UnderlyingStipType);
       FIELD_SET(*this, FIX::UnderlyingStipValue);
     };
@@ -96,7 +105,12 @@ namespace FIX44
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(55,65,48,22,460,461,167,762,200,541,201,224,225,239,226,227,228,255,543,470,471,472,240,202,947,206,231,223,207,106,348,349,107,350,351,691,667,875,876,873,874,15,827,668,869,555,336,625,58,354,355,0)) {}
+    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(fieldOrder(),51)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{15,42},{22,4},{48,3},{55,1},{58,49},{65,2},{106,30},{107,33},{167,7},{200,9},{201,11},{202,24},{206,26},{207,29},{223,28},{224,12},{225,13},{226,15},{227,16},{228,17},{231,27},{239,14},{240,23},{255,18},{336,47},{348,31},{349,32},{350,34},{351,35},{354,50},{355,51},{460,5},{461,6},{470,20},{471,21},{472,22},{541,10},{543,19},{555,46},{625,48},{667,37},{668,44},{691,36},{762,8},{827,43},{869,45},{873,40},{874,41},{875,38},{876,39},{947,25}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -105,7 +119,12 @@ namespace FIX44
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
@@ -148,7 +167,12 @@ namespace FIX44
       class NoEvents: public FIX::Group
       {
       public:
-      NoEvents() : FIX::Group(864,865,FIX::message_order(865,866,867,868,0)) {}
+      NoEvents() : FIX::Group(864,865,FIX::message_order(fieldOrder(),4)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{865,1},{866,2},{867,3},{868,4}};
+        return order;
+      }
         FIELD_SET(*this, FIX::EventType);
         FIELD_SET(*this, FIX::EventDate);
         FIELD_SET(*this, FIX::EventPx);
@@ -164,7 +188,12 @@ namespace FIX44
       class NoInstrAttrib: public FIX::Group
       {
       public:
-      NoInstrAttrib() : FIX::Group(870,871,FIX::message_order(871,872,0)) {}
+      NoInstrAttrib() : FIX::Group(870,871,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{871,1},{872,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::InstrAttribType);
         FIELD_SET(*this, FIX::InstrAttribValue);
       };
@@ -172,7 +201,12 @@ namespace FIX44
       class NoLegs: public FIX::Group
       {
       public:
-      NoLegs() : FIX::Group(555,600,FIX::message_order(600,601,602,603,607,608,609,764,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,0)) {}
+      NoLegs() : FIX::Group(555,600,FIX::message_order(fieldOrder(),41)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{248,11},{249,12},{250,13},{251,14},{252,15},{253,16},{254,22},{257,17},{556,37},{596,19},{597,20},{598,21},{599,18},{600,1},{601,2},{602,3},{603,4},{607,5},{608,6},{609,7},{610,9},{611,10},{612,23},{613,25},{614,26},{615,27},{616,28},{617,29},{618,30},{619,31},{620,32},{621,33},{622,34},{623,35},{624,36},{739,39},{740,38},{764,8},{942,24},{955,40},{956,41}};
+        return order;
+      }
         FIELD_SET(*this, FIX::LegSymbol);
         FIELD_SET(*this, FIX::LegSymbolSfx);
         FIELD_SET(*this, FIX::LegSecurityID);
@@ -181,7 +215,12 @@ namespace FIX44
         class NoLegSecurityAltID: public FIX::Group
         {
         public:
-        NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
+        NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(fieldOrder(),2)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{605,1},{606,2}};
+          return order;
+        }
           FIELD_SET(*this, FIX::LegSecurityAltID);
           FIELD_SET(*this, FIX::LegSecurityAltIDSource);
         };
@@ -12,7 +12,6 @@ namespace FIX44
     DerivativeSecurityListRequest() : Message(MsgType()) {}
     DerivativeSecurityListRequest(const FIX::Message& m) : Message(m) {}
     DerivativeSecurityListRequest(const Message& m) : Message(m) {}
-    DerivativeSecurityListRequest(const DerivativeSecurityListRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("z"); }
 
     DerivativeSecurityListRequest(
@@ -34,7 +33,12 @@ namespace FIX44
     class NoUnderlyingSecurityAltID: public FIX::Group
     {
     public:
-    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
+    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{458,1},{459,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
     };
@@ -83,7 +87,12 @@ namespace FIX44
     class NoUnderlyingStips: public FIX::Group
     {
     public:
-    NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
+    NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{888,1},{889,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UnderlyingStipType);
       FIELD_SET(*this, FIX::UnderlyingStipValue);
     };
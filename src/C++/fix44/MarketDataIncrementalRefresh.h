@@ -12,7 +12,6 @@ namespace FIX44
     MarketDataIncrementalRefresh() : Message(MsgType()) {}
     MarketDataIncrementalRefresh(const FIX::Message& m) : Message(m) {}
     MarketDataIncrementalRefresh(const Message& m) : Message(m) {}
-    MarketDataIncrementalRefresh(const MarketDataIncrementalRefresh& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("X"); }
 
     FIELD_SET(*this, FIX::MDReqID);
@@ -20,7 +19,12 @@ namespace FIX44
     class NoMDEntries: public FIX::Group
     {
     public:
-    NoMDEntries() : FIX::Group(268,279,FIX::message_order(279,285,269,278,280,55,65,48,22,460,461,167,762,200,541,201,224,225,239,226,227,228,255,543,470,471,472,240,202,947,206,231,223,207,106,348,349,107,350,351,691,667,875,876,873,874,711,555,291,292,270,15,271,272,273,274,275,336,625,276,277,282,283,284,286,59,432,126,110,18,287,37,299,288,289,346,290,546,811,451,58,354,355,0)) {}
+    NoMDEntries() : FIX::Group(268,279,FIX::message_order(fieldOrder(),83)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{15,52},{18,70},{22,9},{37,72},{48,8},{55,6},{58,81},{59,66},{65,7},{106,35},{107,38},{110,69},{126,68},{167,12},{200,14},{201,16},{202,29},{206,31},{207,34},{223,33},{224,17},{225,18},{226,20},{227,21},{228,22},{231,32},{239,19},{240,28},{255,23},{269,3},{270,51},{271,53},{272,54},{273,55},{274,56},{275,57},{276,60},{277,61},{278,4},{279,1},{280,5},{282,62},{283,63},{284,64},{285,2},{286,65},{287,71},{288,74},{289,75},{290,77},{291,49},{292,50},{299,73},{336,58},{346,76},{348,36},{349,37},{350,39},{351,40},{354,82},{355,83},{432,67},{451,80},{460,10},{461,11},{470,25},{471,26},{472,27},{541,15},{543,24},{546,78},{555,48},{625,59},{667,42},{691,41},{711,47},{762,13},{811,79},{873,45},{874,46},{875,43},{876,44},{947,30}};
+      return order;
+    }
       FIELD_SET(*this, FIX::MDUpdateAction);
       FIELD_SET(*this, FIX::DeleteReason);
       FIELD_SET(*this, FIX::MDEntryType);
@@ -34,7 +38,12 @@ namespace FIX44
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
@@ -77,7 +86,12 @@ namespace FIX44
       class NoEvents: public FIX::Group
       {
       public:
-      NoEvents() : FIX::Group(864,865,FIX::message_order(865,866,867,868,0)) {}
+      NoEvents() : FIX::Group(864,865,FIX::message_order(fieldOrder(),4)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{865,1},{866,2},{867,3},{868,4}};
+        return order;
+      }
         FIELD_SET(*this, FIX::EventType);
         FIELD_SET(*this, FIX::EventDate);
         FIELD_SET(*this, FIX::EventPx);
@@ -89,7 +103,12 @@ namespace FIX44
       class NoUnderlyings: public FIX::Group
       {
       public:
-      NoUnderlyings() : FIX::Group(711,311,FIX::message_order(311,312,309,305,462,463,310,763,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,435,308,306,362,363,307,364,365,877,878,318,879,810,882,883,884,885,886,0)) {}
+      NoUnderlyings() : FIX::Group(711,311,FIX::message_order(fieldOrder(),45)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{241,12},{242,13},{243,14},{244,15},{245,16},{246,17},{247,23},{256,18},{305,4},{306,30},{307,33},{308,29},{309,3},{310,7},{311,1},{312,2},{313,9},{315,11},{316,24},{317,26},{318,38},{362,31},{363,32},{364,34},{365,35},{435,28},{436,27},{462,5},{463,6},{542,10},{592,20},{593,21},{594,22},{595,19},{763,8},{810,40},{877,36},{878,37},{879,39},{882,41},{883,42},{884,43},{885,44},{886,45},{941,25}};
+        return order;
+      }
         FIELD_SET(*this, FIX::UnderlyingSymbol);
         FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
         FIELD_SET(*this, FIX::UnderlyingSecurityID);
@@ -98,7 +117,12 @@ namespace FIX44
         class NoUnderlyingSecurityAltID: public FIX::Group
         {
         public:
-        NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
+        NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(fieldOrder(),2)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{458,1},{459,2}};
+          return order;
+        }
           FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
           FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
         };
@@ -147,7 +171,12 @@ namespace FIX44
         class NoUnderlyingStips: public FIX::Group
         {
         public:
-        NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
+        NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(fieldOrder(),2)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{888,1},{889,2}};
+          return order;
+        }
           FIELD_SET(*this, FIX::UnderlyingStipType);
           FIELD_SET(*this, FIX::UnderlyingStipValue);
         };
@@ -156,7 +185,12 @@ namespace FIX44
       class NoLegs: public FIX::Group
       {
       public:
-      NoLegs() : FIX::Group(555,600,FIX::message_order(600,601,602,603,607,608,609,764,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,0)) {}
+      NoLegs() : FIX::Group(555,600,FIX::message_order(fieldOrder(),41)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{248,11},{249,12},{250,13},{251,14},{252,15},{253,16},{254,22},{257,17},{556,37},{596,19},{597,20},{598,21},{599,18},{600,1},{601,2},{602,3},{603,4},{607,5},{608,6},{609,7},{610,9},{611,10},{612,23},{613,25},{614,26},{615,27},{616,28},{617,29},{618,30},{619,31},{620,32},{621,33},{622,34},{623,35},{624,36},{739,39},{740,38},{764,8},{942,24},{955,40},{956,41}};
+        return order;
+      }
         FIELD_SET(*this, FIX::LegSymbol);
         FIELD_SET(*this, FIX::LegSymbolSfx);
         FIELD_SET(*this, FIX::LegSecurityID);
@@ -165,7 +199,12 @@ namespace FIX44
         class NoLegSecurityAltID: public FIX::Group
         {
         public:
-        NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
+        NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(fieldOrder(),2)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{605,1},{606,2}};
+          return order;
+        }
           FIELD_SET(*this, FIX::LegSecurityAltID);
           FIELD_SET(*this, FIX::LegSecurityAltIDSource);
         };
@@ -12,7 +12,6 @@ namespace FIX44
     MarketDataRequestReject() : Message(MsgType()) {}
     MarketDataRequestReject(const FIX::Message& m) : Message(m) {}
     MarketDataRequestReject(const Message& m) : Message(m) {}
-    MarketDataRequestReject(const MarketDataRequestReject& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("Y"); }
 
     MarketDataRequestReject(
@@ -28,7 +27,12 @@ namespace FIX44
     class NoAltMDSource: public FIX::Group
     {
     public:
-    NoAltMDSource() : FIX::Group(816,817,FIX::message_order(817,0)) {}
+    NoAltMDSource() : FIX::Group(816,817,FIX::message_order(fieldOrder(),1)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{817,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::AltMDSourceID);
     };
     FIELD_SET(*this, FIX::Text);
@@ -12,7 +12,6 @@ namespace FIX44
     MassQuote() : Message(MsgType()) {}
     MassQuote(const FIX::Message& m) : Message(m) {}
     MassQuote(const Message& m) : Message(m) {}
-    MassQuote(const MassQuote& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("i"); }
 
     MassQuote(
@@ -30,7 +29,12 @@ namespace FIX44
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,802,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{447,2},{448,1},{452,3},{802,4}};
+      return order;
+    }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -38,7 +42,12 @@ namespace FIX44
       class NoPartySubIDs: public FIX::Group
       {
       public:
-      NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
+      NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{523,1},{803,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
       };
@@ -52,7 +61,12 @@ namespace FIX44
     class NoQuoteSets: public FIX::Group
     {
     public:
-    NoQuoteSets() : FIX::Group(296,302,FIX::message_order(302,311,312,309,305,462,463,310,763,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,435,308,306,362,363,307,364,365,877,878,318,879,810,882,883,884,885,886,367,304,893,295,0)) {}
+    NoQuoteSets() : FIX::Group(296,302,FIX::message_order(fieldOrder(),50)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{241,13},{242,14},{243,15},{244,16},{245,17},{246,18},{247,24},{256,19},{295,50},{302,1},{304,48},{305,5},{306,31},{307,34},{308,30},{309,4},{310,8},{311,2},{312,3},{313,10},{315,12},{316,25},{317,27},{318,39},{362,32},{363,33},{364,35},{365,36},{367,47},{435,29},{436,28},{462,6},{463,7},{542,11},{592,21},{593,22},{594,23},{595,20},{763,9},{810,41},{877,37},{878,38},{879,40},{882,42},{883,43},{884,44},{885,45},{886,46},{893,49},{941,26}};
+      return order;
+    }
       FIELD_SET(*this, FIX::QuoteSetID);
       FIELD_SET(*this, FIX::UnderlyingSymbol);
       FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
@@ -62,7 +76,12 @@ namespace FIX44
       class NoUnderlyingSecurityAltID: public FIX::Group
       {
       public:
-      NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
+      NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{458,1},{459,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
         FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
       };
@@ -111,7 +130,12 @@ namespace FIX44
       class NoUnderlyingStips: public FIX::Group
       {
       public:
-      NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
+      NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{888,1},{889,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::UnderlyingStipType);
         FIELD_SET(*this, FIX::UnderlyingStipValue);
       };
@@ -122,7 +146,12 @@ namespace FIX44
       class NoQuoteEntries: public FIX::Group
       {
       public:
-      NoQuoteEntries() : FIX::Group(295,299,FIX::message_order(299,55,65,48,22,460,461,167,762,200,541,201,224,225,239,226,227,228,255,543,470,471,472,240,202,947,206,231,223,207,106,348,349,107,350,351,691,667,875,876,873,874,555,132,133,134,135,62,188,190,189,191,631,632,633,634,60,336,625,64,40,193,192,642,643,15,0)) {}
+      NoQuoteEntries() : FIX::Group(295,299,FIX::message_order(fieldOrder(),66)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{15,66},{22,5},{40,61},{48,4},{55,2},{60,57},{62,48},{64,60},{65,3},{106,31},{107,34},{132,44},{133,45},{134,46},{135,47},{167,8},{188,49},{189,51},{190,50},{191,52},{192,63},{193,62},{200,10},{201,12},{202,25},{206,27},{207,30},{223,29},{224,13},{225,14},{226,16},{227,17},{228,18},{231,28},{239,15},{240,24},{255,19},{299,1},{336,58},{348,32},{349,33},{350,35},{351,36},{460,6},{461,7},{470,21},{471,22},{472,23},{541,11},{543,20},{555,43},{625,59},{631,53},{632,54},{633,55},{634,56},{642,64},{643,65},{667,38},{691,37},{762,9},{873,41},{874,42},{875,39},{876,40},{947,26}};
+        return order;
+      }
         FIELD_SET(*this, FIX::QuoteEntryID);
         FIELD_SET(*this, FIX::Symbol);
         FIELD_SET(*this, FIX::SymbolSfx);
@@ -132,7 +161,12 @@ namespace FIX44
         class NoSecurityAltID: public FIX::Group
         {
         public:
-        NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+        NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+          return order;
+        }
           FIELD_SET(*this, FIX::SecurityAltID);
           FIELD_SET(*this, FIX::SecurityAltIDSource);
         };
@@ -175,7 +209,12 @@ namespace FIX44
         class NoEvents: public FIX::Group
         {
         public:
-        NoEvents() : FIX::Group(864,865,FIX::message_order(865,866,867,868,0)) {}
+        NoEvents() : FIX::Group(864,865,FIX::message_order(fieldOrder(),4)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{865,1},{866,2},{867,3},{868,4}};
+          return order;
+        }
           FIELD_SET(*this, FIX::EventType);
           FIELD_SET(*this, FIX::EventDate);
           FIELD_SET(*this, FIX::EventPx);
@@ -187,7 +226,12 @@ namespace FIX44
         class NoLegs: public FIX::Group
         {
         public:
-        NoLegs() : FIX::Group(555,600,FIX::message_order(600,601,602,603,607,608,609,764,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,0)) {}
+        NoLegs() : FIX::Group(555,600,FIX::message_order(fieldOrder(),41)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{248,11},{249,12},{250,13},{251,14},{252,15},{253,16},{254,22},{257,17},{556,37},{596,19},{597,20},{598,21},{599,18},{600,1},{601,2},{602,3},{603,4},{607,5},{608,6},{609,7},{610,9},{611,10},{612,23},{613,25},{614,26},{615,27},{616,28},{617,29},{618,30},{619,31},{620,32},{621,33},{622,34},{623,35},{624,36},{739,39},{740,38},{764,8},{942,24},{955,40},{956,41}};
+          return order;
+        }
           FIELD_SET(*this, FIX::LegSymbol);
           FIELD_SET(*this, FIX::LegSymbolSfx);
           FIELD_SET(*this, FIX::LegSecurityID);
@@ -196,7 +240,12 @@ namespace FIX44
           class NoLegSecurityAltID: public FIX::Group
           {
           public:
-          NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
+          NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(fieldOrder(),2)) {}
+          static const FIX::message_order::field_position* fieldOrder()
+          {
+            static const FIX::message_order::field_position order[] = {{605,1},{606,2}};
+            return order;
+          }
             FIELD_SET(*this, FIX::LegSecurityAltID);
             FIELD_SET(*this, FIX::LegSecurityAltIDSource);
           };
@@ -12,7 +12,6 @@ namespace FIX44
     UserResponse() : Message(MsgType()) {}
     UserResponse(const FIX::Message& m) : Message(m) {}
     UserResponse(const Message& m) : Message(m) {}
-    UserResponse(const UserResponse& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("BF"); }
 
     UserResponse(
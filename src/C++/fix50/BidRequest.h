@@ -12,7 +12,6 @@ namespace FIX50
     BidRequest() : Message(MsgType()) {}
     BidRequest(const FIX::Message& m) : Message(m) {}
     BidRequest(const Message& m) : Message(m) {}
-    BidRequest(const BidRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("k"); }
 
     BidRequest(
@@ -46,7 +45,12 @@ namespace FIX50
     class NoBidDescriptors: public FIX::Group
     {
     public:
-    NoBidDescriptors() : FIX::Group(398,399,FIX::message_order(399,400,401,404,441,402,403,405,406,407,408,0)) {}
+    NoBidDescriptors() : FIX::Group(398,399,FIX::message_order(fieldOrder(),11)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{399,1},{400,2},{401,3},{402,6},{403,7},{404,4},{405,8},{406,9},{407,10},{408,11},{441,5}};
+      return order;
+    }
       FIELD_SET(*this, FIX::BidDescriptorType);
       FIELD_SET(*this, FIX::BidDescriptor);
       FIELD_SET(*this, FIX::SideValueInd);
@@ -63,7 +67,12 @@ namespace FIX50
     class NoBidComponents: public FIX::Group
     {
     public:
-    NoBidComponents() : FIX::Group(420,66,FIX::message_order(66,54,336,625,430,63,64,1,660,0)) {}
+    NoBidComponents() : FIX::Group(420,66,FIX::message_order(fieldOrder(),9)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1,8},{54,2},{63,6},{64,7},{66,1},{336,3},{430,5},{625,4},{660,9}};
+      return order;
+    }
       FIELD_SET(*this, FIX::ListID);
       FIELD_SET(*this, FIX::Side);
       FIELD_SET(*this, FIX::TradingSessionID);
@@ -12,7 +12,6 @@ namespace FIX50
     BidResponse() : Message(MsgType()) {}
     BidResponse(const FIX::Message& m) : Message(m) {}
     BidResponse(const Message& m) : Message(m) {}
-    BidResponse(const BidResponse& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("l"); }
 
     FIELD_SET(*this, FIX::BidID);
@@ -21,7 +20,12 @@ namespace FIX50
     class NoBidComponents: public FIX::Group
     {
     public:
-    NoBidComponents() : FIX::Group(420,12,FIX::message_order(12,13,479,497,66,421,54,44,423,406,430,63,64,336,625,58,354,355,0)) {}
+    NoBidComponents() : FIX::Group(420,12,FIX::message_order(fieldOrder(),18)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{12,1},{13,2},{44,8},{54,7},{58,16},{63,12},{64,13},{66,5},{336,14},{354,17},{355,18},{406,10},{421,6},{423,9},{430,11},{479,3},{497,4},{625,15}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Commission);
       FIELD_SET(*this, FIX::CommType);
       FIELD_SET(*this, FIX::CommCurrency);
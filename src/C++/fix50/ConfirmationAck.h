@@ -12,7 +12,6 @@ namespace FIX50
     ConfirmationAck() : Message(MsgType()) {}
     ConfirmationAck(const FIX::Message& m) : Message(m) {}
     ConfirmationAck(const Message& m) : Message(m) {}
-    ConfirmationAck(const ConfirmationAck& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("AU"); }
 
     ConfirmationAck(
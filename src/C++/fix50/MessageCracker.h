@@ -416,576 +416,395 @@ public:
   void crack( const Message& message, 
               const FIX::SessionID& sessionID )
   {
-    const std::string& msgTypeValue 
-      = message.getHeader().getField( FIX::FIELD::MsgType );
-    
-    if( msgTypeValue == "6" )
-      onMessage( (const IOI&)message, sessionID );
-    else
-    if( msgTypeValue == "7" )
-      onMessage( (const Advertisement&)message, sessionID );
-    else
-    if( msgTypeValue == "8" )
-      onMessage( (const ExecutionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "9" )
-      onMessage( (const OrderCancelReject&)message, sessionID );
-    else
-    if( msgTypeValue == "B" )
-      onMessage( (const News&)message, sessionID );
-    else
-    if( msgTypeValue == "C" )
-      onMessage( (const Email&)message, sessionID );
-    else
-    if( msgTypeValue == "D" )
-      onMessage( (const NewOrderSingle&)message, sessionID );
-    else
-    if( msgTypeValue == "E" )
-      onMessage( (const NewOrderList&)message, sessionID );
-    else
-    if( msgTypeValue == "F" )
-      onMessage( (const OrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "G" )
-      onMessage( (const OrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "H" )
-      onMessage( (const OrderStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "J" )
-      onMessage( (const AllocationInstruction&)message, sessionID );
-    else
-    if( msgTypeValue == "K" )
-      onMessage( (const ListCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "L" )
-      onMessage( (const ListExecute&)message, sessionID );
-    else
-    if( msgTypeValue == "M" )
-      onMessage( (const ListStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "N" )
-      onMessage( (const ListStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "P" )
-      onMessage( (const AllocationInstructionAck&)message, sessionID );
-    else
-    if( msgTypeValue == "Q" )
-      onMessage( (const DontKnowTrade&)message, sessionID );
-    else
-    if( msgTypeValue == "R" )
-      onMessage( (const QuoteRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "S" )
-      onMessage( (const Quote&)message, sessionID );
-    else
-    if( msgTypeValue == "T" )
-      onMessage( (const SettlementInstructions&)message, sessionID );
-    else
-    if( msgTypeValue == "V" )
-      onMessage( (const MarketDataRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "W" )
-      onMessage( (const MarketDataSnapshotFullRefresh&)message, sessionID );
-    else
-    if( msgTypeValue == "X" )
-      onMessage( (const MarketDataIncrementalRefresh&)message, sessionID );
-    else
-    if( msgTypeValue == "Y" )
-      onMessage( (const MarketDataRequestReject&)message, sessionID );
-    else
-    if( msgTypeValue == "Z" )
-      onMessage( (const QuoteCancel&)message, sessionID );
-    else
-    if( msgTypeValue == "a" )
-      onMessage( (const QuoteStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "b" )
-      onMessage( (const MassQuoteAcknowledgement&)message, sessionID );
-    else
-    if( msgTypeValue == "c" )
-      onMessage( (const SecurityDefinitionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "d" )
-      onMessage( (const SecurityDefinition&)message, sessionID );
-    else
-    if( msgTypeValue == "e" )
-      onMessage( (const SecurityStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "f" )
-      onMessage( (const SecurityStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "g" )
-      onMessage( (const TradingSessionStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "h" )
-      onMessage( (const TradingSessionStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "i" )
-      onMessage( (const MassQuote&)message, sessionID );
-    else
-    if( msgTypeValue == "j" )
-      onMessage( (const BusinessMessageReject&)message, sessionID );
-    else
-    if( msgTypeValue == "k" )
-      onMessage( (const BidRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "l" )
-      onMessage( (const BidResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "m" )
-      onMessage( (const ListStrikePrice&)message, sessionID );
-    else
-    if( msgTypeValue == "o" )
-      onMessage( (const RegistrationInstructions&)message, sessionID );
-    else
-    if( msgTypeValue == "p" )
-      onMessage( (const RegistrationInstructionsResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "q" )
-      onMessage( (const OrderMassCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "r" )
-      onMessage( (const OrderMassCancelReport&)message, sessionID );
-    else
-    if( msgTypeValue == "s" )
-      onMessage( (const NewOrderCross&)message, sessionID );
-    else
-    if( msgTypeValue == "t" )
-      onMessage( (const CrossOrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "u" )
-      onMessage( (const CrossOrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "v" )
-      onMessage( (const SecurityTypeRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "w" )
-      onMessage( (const SecurityTypes&)message, sessionID );
-    else
-    if( msgTypeValue == "x" )
-      onMessage( (const SecurityListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "y" )
-      onMessage( (const SecurityList&)message, sessionID );
-    else
-    if( msgTypeValue == "z" )
-      onMessage( (const DerivativeSecurityListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AA" )
-      onMessage( (const DerivativeSecurityList&)message, sessionID );
-    else
-    if( msgTypeValue == "AB" )
-      onMessage( (const NewOrderMultileg&)message, sessionID );
-    else
-    if( msgTypeValue == "AC" )
-      onMessage( (const MultilegOrderCancelReplace&)message, sessionID );
-    else
-    if( msgTypeValue == "AD" )
-      onMessage( (const TradeCaptureReportRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AE" )
-      onMessage( (const TradeCaptureReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AF" )
-      onMessage( (const OrderMassStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AG" )
-      onMessage( (const QuoteRequestReject&)message, sessionID );
-    else
-    if( msgTypeValue == "AH" )
-      onMessage( (const RFQRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AI" )
-      onMessage( (const QuoteStatusReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AJ" )
-      onMessage( (const QuoteResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "AK" )
-      onMessage( (const Confirmation&)message, sessionID );
-    else
-    if( msgTypeValue == "AL" )
-      onMessage( (const PositionMaintenanceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AM" )
-      onMessage( (const PositionMaintenanceReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AN" )
-      onMessage( (const RequestForPositions&)message, sessionID );
-    else
-    if( msgTypeValue == "AO" )
-      onMessage( (const RequestForPositionsAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AP" )
-      onMessage( (const PositionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AQ" )
-      onMessage( (const TradeCaptureReportRequestAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AR" )
-      onMessage( (const TradeCaptureReportAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AS" )
-      onMessage( (const AllocationReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AT" )
-      onMessage( (const AllocationReportAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AU" )
-      onMessage( (const ConfirmationAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AV" )
-      onMessage( (const SettlementInstructionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AW" )
-      onMessage( (const AssignmentReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AX" )
-      onMessage( (const CollateralRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AY" )
-      onMessage( (const CollateralAssignment&)message, sessionID );
-    else
-    if( msgTypeValue == "AZ" )
-      onMessage( (const CollateralResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "BA" )
-      onMessage( (const CollateralReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BB" )
-      onMessage( (const CollateralInquiry&)message, sessionID );
-    else
-    if( msgTypeValue == "BC" )
-      onMessage( (const NetworkCounterpartySystemStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BD" )
-      onMessage( (const NetworkCounterpartySystemStatusResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "BE" )
-      onMessage( (const UserRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BF" )
-      onMessage( (const UserResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "BG" )
-      onMessage( (const CollateralInquiryAck&)message, sessionID );
-    else
-    if( msgTypeValue == "BH" )
-      onMessage( (const ConfirmationRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BO" )
-      onMessage( (const ContraryIntentionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BP" )
-      onMessage( (const SecurityDefinitionUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BK" )
-      onMessage( (const SecurityListUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BL" )
-      onMessage( (const AdjustedPositionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BM" )
-      onMessage( (const AllocationInstructionAlert&)message, sessionID );
-    else
-    if( msgTypeValue == "BN" )
-      onMessage( (const ExecutionAcknowledgement&)message, sessionID );
-    else
-    if( msgTypeValue == "BJ" )
-      onMessage( (const TradingSessionList&)message, sessionID );
-    else
-    if( msgTypeValue == "BI" )
-      onMessage( (const TradingSessionListRequest&)message, sessionID );
-    else onMessage( message, sessionID );
+    switch( FIX::Message::msgTypeId(
+      message.getHeader().getField( FIX::FIELD::MsgType ) ) )
+    {
+    case FIX_MSGTYPE_ID( '6', 0 ):
+      onMessage( (const IOI&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '7', 0 ):
+      onMessage( (const Advertisement&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '8', 0 ):
+      onMessage( (const ExecutionReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '9', 0 ):
+      onMessage( (const OrderCancelReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 0 ):
+      onMessage( (const News&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'C', 0 ):
+      onMessage( (const Email&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'D', 0 ):
+      onMessage( (const NewOrderSingle&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'E', 0 ):
+      onMessage( (const NewOrderList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'F', 0 ):
+      onMessage( (const OrderCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'G', 0 ):
+      onMessage( (const OrderCancelReplaceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'H', 0 ):
+      onMessage( (const OrderStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'J', 0 ):
+      onMessage( (const AllocationInstruction&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'K', 0 ):
+      onMessage( (const ListCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'L', 0 ):
+      onMessage( (const ListExecute&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'M', 0 ):
+      onMessage( (const ListStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'N', 0 ):
+      onMessage( (const ListStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'P', 0 ):
+      onMessage( (const AllocationInstructionAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Q', 0 ):
+      onMessage( (const DontKnowTrade&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'R', 0 ):
+      onMessage( (const QuoteRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'S', 0 ):
+      onMessage( (const Quote&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'T', 0 ):
+      onMessage( (const SettlementInstructions&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'V', 0 ):
+      onMessage( (const MarketDataRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'W', 0 ):
+      onMessage( (const MarketDataSnapshotFullRefresh&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'X', 0 ):
+      onMessage( (const MarketDataIncrementalRefresh&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Y', 0 ):
+      onMessage( (const MarketDataRequestReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Z', 0 ):
+      onMessage( (const QuoteCancel&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'a', 0 ):
+      onMessage( (const QuoteStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'b', 0 ):
+      onMessage( (const MassQuoteAcknowledgement&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'c', 0 ):
+      onMessage( (const SecurityDefinitionRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'd', 0 ):
+      onMessage( (const SecurityDefinition&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'e', 0 ):
+      onMessage( (const SecurityStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'f', 0 ):
+      onMessage( (const SecurityStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'g', 0 ):
+      onMessage( (const TradingSessionStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'h', 0 ):
+      onMessage( (const TradingSessionStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'i', 0 ):
+      onMessage( (const MassQuote&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'j', 0 ):
+      onMessage( (const BusinessMessageReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'k', 0 ):
+      onMessage( (const BidRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'l', 0 ):
+      onMessage( (const BidResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'm', 0 ):
+      onMessage( (const ListStrikePrice&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'o', 0 ):
+      onMessage( (const RegistrationInstructions&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'p', 0 ):
+      onMessage( (const RegistrationInstructionsResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'q', 0 ):
+      onMessage( (const OrderMassCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'r', 0 ):
+      onMessage( (const OrderMassCancelReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 's', 0 ):
+      onMessage( (const NewOrderCross&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 't', 0 ):
+      onMessage( (const CrossOrderCancelReplaceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'u', 0 ):
+      onMessage( (const CrossOrderCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'v', 0 ):
+      onMessage( (const SecurityTypeRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'w', 0 ):
+      onMessage( (const SecurityTypes&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'x', 0 ):
+      onMessage( (const SecurityListRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'y', 0 ):
+      onMessage( (const SecurityList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'z', 0 ):
+      onMessage( (const DerivativeSecurityListRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'A' ):
+      onMessage( (const DerivativeSecurityList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'B' ):
+      onMessage( (const NewOrderMultileg&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'C' ):
+      onMessage( (const MultilegOrderCancelReplace&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'D' ):
+      onMessage( (const TradeCaptureReportRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'E' ):
+      onMessage( (const TradeCaptureReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'F' ):
+      onMessage( (const OrderMassStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'G' ):
+      onMessage( (const QuoteRequestReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'H' ):
+      onMessage( (const RFQRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'I' ):
+      onMessage( (const QuoteStatusReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'J' ):
+      onMessage( (const QuoteResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'K' ):
+      onMessage( (const Confirmation&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'L' ):
+      onMessage( (const PositionMaintenanceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'M' ):
+      onMessage( (const PositionMaintenanceReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'N' ):
+      onMessage( (const RequestForPositions&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'O' ):
+      onMessage( (const RequestForPositionsAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'P' ):
+      onMessage( (const PositionReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'Q' ):
+      onMessage( (const TradeCaptureReportRequestAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'R' ):
+      onMessage( (const TradeCaptureReportAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'S' ):
+      onMessage( (const AllocationReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'T' ):
+      onMessage( (const AllocationReportAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'U' ):
+      onMessage( (const ConfirmationAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'V' ):
+      onMessage( (const SettlementInstructionRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'W' ):
+      onMessage( (const AssignmentReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'X' ):
+      onMessage( (const CollateralRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'Y' ):
+      onMessage( (const CollateralAssignment&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'Z' ):
+      onMessage( (const CollateralResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'A' ):
+      onMessage( (const CollateralReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'B' ):
+      onMessage( (const CollateralInquiry&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'C' ):
+      onMessage( (const NetworkCounterpartySystemStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'D' ):
+      onMessage( (const NetworkCounterpartySystemStatusResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'E' ):
+      onMessage( (const UserRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'F' ):
+      onMessage( (const UserResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'G' ):
+      onMessage( (const CollateralInquiryAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'H' ):
+      onMessage( (const ConfirmationRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'O' ):
+      onMessage( (const ContraryIntentionReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'P' ):
+      onMessage( (const SecurityDefinitionUpdateReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'K' ):
+      onMessage( (const SecurityListUpdateReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'L' ):
+      onMessage( (const AdjustedPositionReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'M' ):
+      onMessage( (const AllocationInstructionAlert&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'N' ):
+      onMessage( (const ExecutionAcknowledgement&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'J' ):
+      onMessage( (const TradingSessionList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'I' ):
+      onMessage( (const TradingSessionListRequest&)message, sessionID ); break;
+    default:
+      onMessage( message, sessionID );
+    }
   }
   
 void crack( Message& message, 
             const FIX::SessionID& sessionID )
   {
-    FIX::MsgType msgType;
-    message.getHeader().getField(msgType);
-    std::string msgTypeValue = msgType.getValue();
-    
-    if( msgTypeValue == "6" )
-      onMessage( (IOI&)message, sessionID );
-    else
-    if( msgTypeValue == "7" )
-      onMessage( (Advertisement&)message, sessionID );
-    else
-    if( msgTypeValue == "8" )
-      onMessage( (ExecutionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "9" )
-      onMessage( (OrderCancelReject&)message, sessionID );
-    else
-    if( msgTypeValue == "B" )
-      onMessage( (News&)message, sessionID );
-    else
-    if( msgTypeValue == "C" )
-      onMessage( (Email&)message, sessionID );
-    else
-    if( msgTypeValue == "D" )
-      onMessage( (NewOrderSingle&)message, sessionID );
-    else
-    if( msgTypeValue == "E" )
-      onMessage( (NewOrderList&)message, sessionID );
-    else
-    if( msgTypeValue == "F" )
-      onMessage( (OrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "G" )
-      onMessage( (OrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "H" )
-      onMessage( (OrderStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "J" )
-      onMessage( (AllocationInstruction&)message, sessionID );
-    else
-    if( msgTypeValue == "K" )
-      onMessage( (ListCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "L" )
-      onMessage( (ListExecute&)message, sessionID );
-    else
-    if( msgTypeValue == "M" )
-      onMessage( (ListStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "N" )
-      onMessage( (ListStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "P" )
-      onMessage( (AllocationInstructionAck&)message, sessionID );
-    else
-    if( msgTypeValue == "Q" )
-      onMessage( (DontKnowTrade&)message, sessionID );
-    else
-    if( msgTypeValue == "R" )
-      onMessage( (QuoteRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "S" )
-      onMessage( (Quote&)message, sessionID );
-    else
-    if( msgTypeValue == "T" )
-      onMessage( (SettlementInstructions&)message, sessionID );
-    else
-    if( msgTypeValue == "V" )
-      onMessage( (MarketDataRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "W" )
-      onMessage( (MarketDataSnapshotFullRefresh&)message, sessionID );
-    else
-    if( msgTypeValue == "X" )
-      onMessage( (MarketDataIncrementalRefresh&)message, sessionID );
-    else
-    if( msgTypeValue == "Y" )
-      onMessage( (MarketDataRequestReject&)message, sessionID );
-    else
-    if( msgTypeValue == "Z" )
-      onMessage( (QuoteCancel&)message, sessionID );
-    else
-    if( msgTypeValue == "a" )
-      onMessage( (QuoteStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "b" )
-      onMessage( (MassQuoteAcknowledgement&)message, sessionID );
-    else
-    if( msgTypeValue == "c" )
-      onMessage( (SecurityDefinitionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "d" )
-      onMessage( (SecurityDefinition&)message, sessionID );
-    else
-    if( msgTypeValue == "e" )
-      onMessage( (SecurityStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "f" )
-      onMessage( (SecurityStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "g" )
-      onMessage( (TradingSessionStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "h" )
-      onMessage( (TradingSessionStatus&)message, sessionID );
-    else
-    if( msgTypeValue == "i" )
-      onMessage( (MassQuote&)message, sessionID );
-    else
-    if( msgTypeValue == "j" )
-      onMessage( (BusinessMessageReject&)message, sessionID );
-    else
-    if( msgTypeValue == "k" )
-      onMessage( (BidRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "l" )
-      onMessage( (BidResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "m" )
-      onMessage( (ListStrikePrice&)message, sessionID );
-    else
-    if( msgTypeValue == "o" )
-      onMessage( (RegistrationInstructions&)message, sessionID );
-    else
-    if( msgTypeValue == "p" )
-      onMessage( (RegistrationInstructionsResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "q" )
-      onMessage( (OrderMassCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "r" )
-      onMessage( (OrderMassCancelReport&)message, sessionID );
-    else
-    if( msgTypeValue == "s" )
-      onMessage( (NewOrderCross&)message, sessionID );
-    else
-    if( msgTypeValue == "t" )
-      onMessage( (CrossOrderCancelReplaceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "u" )
-      onMessage( (CrossOrderCancelRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "v" )
-      onMessage( (SecurityTypeRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "w" )
-      onMessage( (SecurityTypes&)message, sessionID );
-    else
-    if( msgTypeValue == "x" )
-      onMessage( (SecurityListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "y" )
-      onMessage( (SecurityList&)message, sessionID );
-    else
-    if( msgTypeValue == "z" )
-      onMessage( (DerivativeSecurityListRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AA" )
-      onMessage( (DerivativeSecurityList&)message, sessionID );
-    else
-    if( msgTypeValue == "AB" )
-      onMessage( (NewOrderMultileg&)message, sessionID );
-    else
-    if( msgTypeValue == "AC" )
-      onMessage( (MultilegOrderCancelReplace&)message, sessionID );
-    else
-    if( msgTypeValue == "AD" )
-      onMessage( (TradeCaptureReportRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AE" )
-      onMessage( (TradeCaptureReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AF" )
-      onMessage( (OrderMassStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AG" )
-      onMessage( (QuoteRequestReject&)message, sessionID );
-    else
-    if( msgTypeValue == "AH" )
-      onMessage( (RFQRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AI" )
-      onMessage( (QuoteStatusReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AJ" )
-      onMessage( (QuoteResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "AK" )
-      onMessage( (Confirmation&)message, sessionID );
-    else
-    if( msgTypeValue == "AL" )
-      onMessage( (PositionMaintenanceRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AM" )
-      onMessage( (PositionMaintenanceReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AN" )
-      onMessage( (RequestForPositions&)message, sessionID );
-    else
-    if( msgTypeValue == "AO" )
-      onMessage( (RequestForPositionsAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AP" )
-      onMessage( (PositionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AQ" )
-      onMessage( (TradeCaptureReportRequestAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AR" )
-      onMessage( (TradeCaptureReportAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AS" )
-      onMessage( (AllocationReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AT" )
-      onMessage( (AllocationReportAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AU" )
-      onMessage( (ConfirmationAck&)message, sessionID );
-    else
-    if( msgTypeValue == "AV" )
-      onMessage( (SettlementInstructionRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AW" )
-      onMessage( (AssignmentReport&)message, sessionID );
-    else
-    if( msgTypeValue == "AX" )
-      onMessage( (CollateralRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "AY" )
-      onMessage( (CollateralAssignment&)message, sessionID );
-    else
-    if( msgTypeValue == "AZ" )
-      onMessage( (CollateralResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "BA" )
-      onMessage( (CollateralReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BB" )
-      onMessage( (CollateralInquiry&)message, sessionID );
-    else
-    if( msgTypeValue == "BC" )
-      onMessage( (NetworkCounterpartySystemStatusRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BD" )
-      onMessage( (NetworkCounterpartySystemStatusResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "BE" )
-      onMessage( (UserRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BF" )
-      onMessage( (UserResponse&)message, sessionID );
-    else
-    if( msgTypeValue == "BG" )
-      onMessage( (CollateralInquiryAck&)message, sessionID );
-    else
-    if( msgTypeValue == "BH" )
-      onMessage( (ConfirmationRequest&)message, sessionID );
-    else
-    if( msgTypeValue == "BO" )
-      onMessage( (ContraryIntentionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BP" )
-      onMessage( (SecurityDefinitionUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BK" )
-      onMessage( (SecurityListUpdateReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BL" )
-      onMessage( (AdjustedPositionReport&)message, sessionID );
-    else
-    if( msgTypeValue == "BM" )
-      onMessage( (AllocationInstructionAlert&)message, sessionID );
-    else
-    if( msgTypeValue == "BN" )
-      onMessage( (ExecutionAcknowledgement&)message, sessionID );
-    else
-    if( msgTypeValue == "BJ" )
-      onMessage( (TradingSessionList&)message, sessionID );
-    else
-    if( msgTypeValue == "BI" )
-      onMessage( (TradingSessionListRequest&)message, sessionID );
-    else onMessage( message, sessionID );
+    switch( FIX::Message::msgTypeId(
+      message.getHeader().getField( FIX::FIELD::MsgType ) ) )
+    {
+    case FIX_MSGTYPE_ID( '6', 0 ):
+      onMessage( (IOI&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '7', 0 ):
+      onMessage( (Advertisement&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '8', 0 ):
+      onMessage( (ExecutionReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( '9', 0 ):
+      onMessage( (OrderCancelReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 0 ):
+      onMessage( (News&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'C', 0 ):
+      onMessage( (Email&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'D', 0 ):
+      onMessage( (NewOrderSingle&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'E', 0 ):
+      onMessage( (NewOrderList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'F', 0 ):
+      onMessage( (OrderCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'G', 0 ):
+      onMessage( (OrderCancelReplaceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'H', 0 ):
+      onMessage( (OrderStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'J', 0 ):
+      onMessage( (AllocationInstruction&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'K', 0 ):
+      onMessage( (ListCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'L', 0 ):
+      onMessage( (ListExecute&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'M', 0 ):
+      onMessage( (ListStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'N', 0 ):
+      onMessage( (ListStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'P', 0 ):
+      onMessage( (AllocationInstructionAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Q', 0 ):
+      onMessage( (DontKnowTrade&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'R', 0 ):
+      onMessage( (QuoteRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'S', 0 ):
+      onMessage( (Quote&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'T', 0 ):
+      onMessage( (SettlementInstructions&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'V', 0 ):
+      onMessage( (MarketDataRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'W', 0 ):
+      onMessage( (MarketDataSnapshotFullRefresh&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'X', 0 ):
+      onMessage( (MarketDataIncrementalRefresh&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Y', 0 ):
+      onMessage( (MarketDataRequestReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'Z', 0 ):
+      onMessage( (QuoteCancel&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'a', 0 ):
+      onMessage( (QuoteStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'b', 0 ):
+      onMessage( (MassQuoteAcknowledgement&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'c', 0 ):
+      onMessage( (SecurityDefinitionRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'd', 0 ):
+      onMessage( (SecurityDefinition&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'e', 0 ):
+      onMessage( (SecurityStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'f', 0 ):
+      onMessage( (SecurityStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'g', 0 ):
+      onMessage( (TradingSessionStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'h', 0 ):
+      onMessage( (TradingSessionStatus&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'i', 0 ):
+      onMessage( (MassQuote&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'j', 0 ):
+      onMessage( (BusinessMessageReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'k', 0 ):
+      onMessage( (BidRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'l', 0 ):
+      onMessage( (BidResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'm', 0 ):
+      onMessage( (ListStrikePrice&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'o', 0 ):
+      onMessage( (RegistrationInstructions&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'p', 0 ):
+      onMessage( (RegistrationInstructionsResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'q', 0 ):
+      onMessage( (OrderMassCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'r', 0 ):
+      onMessage( (OrderMassCancelReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 's', 0 ):
+      onMessage( (NewOrderCross&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 't', 0 ):
+      onMessage( (CrossOrderCancelReplaceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'u', 0 ):
+      onMessage( (CrossOrderCancelRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'v', 0 ):
+      onMessage( (SecurityTypeRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'w', 0 ):
+      onMessage( (SecurityTypes&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'x', 0 ):
+      onMessage( (SecurityListRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'y', 0 ):
+      onMessage( (SecurityList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'z', 0 ):
+      onMessage( (DerivativeSecurityListRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'A' ):
+      onMessage( (DerivativeSecurityList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'B' ):
+      onMessage( (NewOrderMultileg&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'C' ):
+      onMessage( (MultilegOrderCancelReplace&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'D' ):
+      onMessage( (TradeCaptureReportRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'E' ):
+      onMessage( (TradeCaptureReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'F' ):
+      onMessage( (OrderMassStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'G' ):
+      onMessage( (QuoteRequestReject&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'H' ):
+      onMessage( (RFQRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'I' ):
+      onMessage( (QuoteStatusReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'J' ):
+      onMessage( (QuoteResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'K' ):
+      onMessage( (Confirmation&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'L' ):
+      onMessage( (PositionMaintenanceRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'M' ):
+      onMessage( (PositionMaintenanceReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'N' ):
+      onMessage( (RequestForPositions&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'O' ):
+      onMessage( (RequestForPositionsAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'P' ):
+      onMessage( (PositionReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'Q' ):
+      onMessage( (TradeCaptureReportRequestAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'R' ):
+      onMessage( (TradeCaptureReportAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'S' ):
+      onMessage( (AllocationReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'T' ):
+      onMessage( (AllocationReportAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'U' ):
+      onMessage( (ConfirmationAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'V' ):
+      onMessage( (SettlementInstructionRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'W' ):
+      onMessage( (AssignmentReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'X' ):
+      onMessage( (CollateralRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'Y' ):
+      onMessage( (CollateralAssignment&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'A', 'Z' ):
+      onMessage( (CollateralResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'A' ):
+      onMessage( (CollateralReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'B' ):
+      onMessage( (CollateralInquiry&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'C' ):
+      onMessage( (NetworkCounterpartySystemStatusRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'D' ):
+      onMessage( (NetworkCounterpartySystemStatusResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'E' ):
+      onMessage( (UserRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'F' ):
+      onMessage( (UserResponse&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'G' ):
+      onMessage( (CollateralInquiryAck&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'H' ):
+      onMessage( (ConfirmationRequest&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'O' ):
+      onMessage( (ContraryIntentionReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'P' ):
+      onMessage( (SecurityDefinitionUpdateReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'K' ):
+      onMessage( (SecurityListUpdateReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'L' ):
+      onMessage( (AdjustedPositionReport&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'M' ):
+      onMessage( (AllocationInstructionAlert&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'N' ):
+      onMessage( (ExecutionAcknowledgement&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'J' ):
+      onMessage( (TradingSessionList&)message, sessionID ); break;
+    case FIX_MSGTYPE_ID( 'B', 'I' ):
+      onMessage( (TradingSessionListRequest&)message, sessionID ); break;
+    default:
+      onMessage( message, sessionID );
+    }
   }
 
   };
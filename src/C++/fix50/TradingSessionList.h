@@ -12,7 +12,6 @@ namespace FIX50
     TradingSessionList() : Message(MsgType()) {}
     TradingSessionList(const FIX::Message& m) : Message(m) {}
     TradingSessionList(const Message& m) : Message(m) {}
-    TradingSessionList(const TradingSessionList& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("BJ"); }
 
     FIELD_SET(*this, FIX::TradSesReqID);
@@ -20,7 +19,12 @@ namespace FIX50
     class NoTradingSessions: public FIX::Group
     {
     public:
-    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,207,338,339,325,340,567,341,342,343,344,345,387,58,354,355,0)) {}
+    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(fieldOrder(),17)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{58,15},{207,3},{325,6},{336,1},{338,4},{339,5},{340,7},{341,9},{342,10},{343,11},{344,12},{345,13},{354,16},{355,17},{387,14},{567,8},{625,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
       FIELD_SET(*this, FIX::SecurityExchange);
@@ -12,7 +12,6 @@ namespace FIX50
     TradingSessionListRequest() : Message(MsgType()) {}
     TradingSessionListRequest(const FIX::Message& m) : Message(m) {}
     TradingSessionListRequest(const Message& m) : Message(m) {}
-    TradingSessionListRequest(const TradingSessionListRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("BI"); }
 
     TradingSessionListRequest(
@@ -12,7 +12,6 @@ namespace FIX50
     UserRequest() : Message(MsgType()) {}
     UserRequest(const FIX::Message& m) : Message(m) {}
     UserRequest(const Message& m) : Message(m) {}
-    UserRequest(const UserRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("BE"); }
 
     UserRequest(
@@ -12,7 +12,6 @@ namespace FIX50SP1
     ApplicationMessageReport() : Message(MsgType()) {}
     ApplicationMessageReport(const FIX::Message& m) : Message(m) {}
     ApplicationMessageReport(const Message& m) : Message(m) {}
-    ApplicationMessageReport(const ApplicationMessageReport& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("BY"); }
 
     ApplicationMessageReport(
@@ -30,7 +29,12 @@ namespace FIX50SP1
     class NoApplIDs: public FIX::Group
     {
     public:
-    NoApplIDs() : FIX::Group(1351,1355,FIX::message_order(1355,1399,1357,0)) {}
+    NoApplIDs() : FIX::Group(1351,1355,FIX::message_order(fieldOrder(),3)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1355,1},{1357,3},{1399,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::RefApplID);
       FIELD_SET(*this, FIX::ApplNewSeqNum);
       FIELD_SET(*this, FIX::RefApplLastSeqNum);
@@ -12,7 +12,6 @@ namespace FIX50SP1
     ApplicationMessageRequest() : Message(MsgType()) {}
     ApplicationMessageRequest(const FIX::Message& m) : Message(m) {}
     ApplicationMessageRequest(const Message& m) : Message(m) {}
-    ApplicationMessageRequest(const ApplicationMessageRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("BW"); }
 
     ApplicationMessageRequest(
@@ -30,7 +29,12 @@ namespace FIX50SP1
     class NoApplIDs: public FIX::Group
     {
     public:
-    NoApplIDs() : FIX::Group(1351,1355,FIX::message_order(1355,1182,1183,0)) {}
+    NoApplIDs() : FIX::Group(1351,1355,FIX::message_order(fieldOrder(),3)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1182,2},{1183,3},{1355,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::RefApplID);
       FIELD_SET(*this, FIX::ApplBegSeqNum);
       FIELD_SET(*this, FIX::ApplEndSeqNum);
@@ -12,7 +12,6 @@ namespace FIX50SP1
     ApplicationMessageRequestAck() : Message(MsgType()) {}
     ApplicationMessageRequestAck(const FIX::Message& m) : Message(m) {}
     ApplicationMessageRequestAck(const Message& m) : Message(m) {}
-    ApplicationMessageRequestAck(const ApplicationMessageRequestAck& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("BX"); }
 
     ApplicationMessageRequestAck(
@@ -31,7 +30,12 @@ namespace FIX50SP1
     class NoApplIDs: public FIX::Group
     {
     public:
-    NoApplIDs() : FIX::Group(1351,1355,FIX::message_order(1355,1182,1183,1357,1354,0)) {}
+    NoApplIDs() : FIX::Group(1351,1355,FIX::message_order(fieldOrder(),5)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1182,2},{1183,3},{1354,5},{1355,1},{1357,4}};
+      return order;
+    }
       FIELD_SET(*this, FIX::RefApplID);
       FIELD_SET(*this, FIX::ApplBegSeqNum);
       FIELD_SET(*this, FIX::ApplEndSeqNum);
@@ -12,7 +12,6 @@ namespace FIX50SP1
     DerivativeSecurityList() : Message(MsgType()) {}
     DerivativeSecurityList(const FIX::Message& m) : Message(m) {}
     DerivativeSecurityList(const Message& m) : Message(m) {}
-    DerivativeSecurityList(const DerivativeSecurityList& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("AA"); }
 
     DerivativeSecurityList(
@@ -37,7 +36,12 @@ namespace FIX50SP1
     class NoUnderlyingSecurityAltID: public FIX::Group
     {
     public:
-    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
+    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{458,1},{459,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
     };
@@ -96,7 +100,12 @@ namespace FIX50SP1
     class NoUnderlyingStips: public FIX::Group
     {
     public:
-    NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
+    NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{888,1},{889,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UnderlyingStipType);
       FIELD_SET(*this, FIX::UnderlyingStipValue);
     };
@@ -108,7 +117,12 @@ namespace FIX50SP1
     class NoUndlyInstrumentParties: public FIX::Group
     {
     public:
-    NoUndlyInstrumentParties() : FIX::Group(1058,1059,FIX::message_order(1059,1060,1061,1062,0)) {}
+    NoUndlyInstrumentParties() : FIX::Group(1058,1059,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1059,1},{1060,2},{1061,3},{1062,4}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UndlyInstrumentPartyID);
       FIELD_SET(*this, FIX::UndlyInstrumentPartyIDSource);
       FIELD_SET(*this, FIX::UndlyInstrumentPartyRole);
@@ -116,7 +130,12 @@ namespace FIX50SP1
       class NoUndlyInstrumentPartySubIDs: public FIX::Group
       {
       public:
-      NoUndlyInstrumentPartySubIDs() : FIX::Group(1062,1063,FIX::message_order(1063,1064,0)) {}
+      NoUndlyInstrumentPartySubIDs() : FIX::Group(1062,1063,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{1063,1},{1064,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::UndlyInstrumentPartySubID);
         FIELD_SET(*this, FIX::UndlyInstrumentPartySubIDType);
       };
@@ -131,7 +150,12 @@ namespace FIX50SP1
     class NoDerivativeSecurityAltID: public FIX::Group
     {
     public:
-    NoDerivativeSecurityAltID() : FIX::Group(1218,1219,FIX::message_order(1219,1220,0)) {}
+    NoDerivativeSecurityAltID() : FIX::Group(1218,1219,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1219,1},{1220,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::DerivativeSecurityAltID);
       FIELD_SET(*this, FIX::DerivativeSecurityAltIDSource);
     };
@@ -192,7 +216,12 @@ namespace FIX50SP1
     class NoDerivativeEvents: public FIX::Group
     {
     public:
-    NoDerivativeEvents() : FIX::Group(1286,1287,FIX::message_order(1287,1288,1289,1290,1291,0)) {}
+    NoDerivativeEvents() : FIX::Group(1286,1287,FIX::message_order(fieldOrder(),5)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1287,1},{1288,2},{1289,3},{1290,4},{1291,5}};
+      return order;
+    }
       FIELD_SET(*this, FIX::DerivativeEventType);
       FIELD_SET(*this, FIX::DerivativeEventDate);
       FIELD_SET(*this, FIX::DerivativeEventTime);
@@ -203,7 +232,12 @@ namespace FIX50SP1
     class NoDerivativeInstrumentParties: public FIX::Group
     {
     public:
-    NoDerivativeInstrumentParties() : FIX::Group(1292,1293,FIX::message_order(1293,1294,1295,1296,0)) {}
+    NoDerivativeInstrumentParties() : FIX::Group(1292,1293,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1293,1},{1294,2},{1295,3},{1296,4}};
+      return order;
+    }
       FIELD_SET(*this, FIX::DerivativeInstrumentPartyID);
       FIELD_SET(*this, FIX::DerivativeInstrumentPartyIDSource);
       FIELD_SET(*this, FIX::DerivativeInstrumentPartyRole);
@@ -211,7 +245,12 @@ namespace FIX50SP1
       class NoDerivativeInstrumentPartySubIDs: public FIX::Group
       {
       public:
-      NoDerivativeInstrumentPartySubIDs() : FIX::Group(1296,1297,FIX::message_order(1297,1298,0)) {}
+      NoDerivativeInstrumentPartySubIDs() : FIX::Group(1296,1297,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{1297,1},{1298,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::DerivativeInstrumentPartySubID);
         FIELD_SET(*this, FIX::DerivativeInstrumentPartySubIDType);
       };
@@ -220,7 +259,12 @@ namespace FIX50SP1
     class NoDerivativeInstrAttrib: public FIX::Group
     {
     public:
-    NoDerivativeInstrAttrib() : FIX::Group(1311,1313,FIX::message_order(1313,1314,0)) {}
+    NoDerivativeInstrAttrib() : FIX::Group(1311,1313,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1313,1},{1314,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::DerivativeInstrAttribType);
       FIELD_SET(*this, FIX::DerivativeInstrAttribValue);
     };
@@ -228,14 +272,24 @@ namespace FIX50SP1
     class NoMarketSegments: public FIX::Group
     {
     public:
-    NoMarketSegments() : FIX::Group(1310,1301,FIX::message_order(1301,1300,1201,0)) {}
+    NoMarketSegments() : FIX::Group(1310,1301,FIX::message_order(fieldOrder(),3)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1201,3},{1300,2},{1301,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::MarketID);
       FIELD_SET(*this, FIX::MarketSegmentID);
       FIELD_SET(*this, FIX::NoTickRules);
       class NoTickRules: public FIX::Group
       {
       public:
-      NoTickRules() : FIX::Group(1205,1206,FIX::message_order(1206,1207,1208,1209,0)) {}
+      NoTickRules() : FIX::Group(1205,1206,FIX::message_order(fieldOrder(),4)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{1206,1},{1207,2},{1208,3},{1209,4}};
+        return order;
+      }
         FIELD_SET(*this, FIX::StartTickPriceRange);
         FIELD_SET(*this, FIX::EndTickPriceRange);
         FIELD_SET(*this, FIX::TickIncrement);
@@ -245,7 +299,12 @@ namespace FIX50SP1
       class NoLotTypeRules: public FIX::Group
       {
       public:
-      NoLotTypeRules() : FIX::Group(1234,1093,FIX::message_order(1093,1231,0)) {}
+      NoLotTypeRules() : FIX::Group(1234,1093,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{1093,1},{1231,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::LotType);
         FIELD_SET(*this, FIX::MinLotSize);
       };
@@ -267,35 +326,60 @@ namespace FIX50SP1
       class NoTradingSessionRules: public FIX::Group
       {
       public:
-      NoTradingSessionRules() : FIX::Group(1309,336,FIX::message_order(336,625,0)) {}
+      NoTradingSessionRules() : FIX::Group(1309,336,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{336,1},{625,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::TradingSessionID);
         FIELD_SET(*this, FIX::TradingSessionSubID);
         FIELD_SET(*this, FIX::NoOrdTypeRules);
         class NoOrdTypeRules: public FIX::Group
         {
         public:
-        NoOrdTypeRules() : FIX::Group(1237,40,FIX::message_order(40,0)) {}
+        NoOrdTypeRules() : FIX::Group(1237,40,FIX::message_order(fieldOrder(),1)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{40,1}};
+          return order;
+        }
           FIELD_SET(*this, FIX::OrdType);
         };
         FIELD_SET(*this, FIX::NoTimeInForceRules);
         class NoTimeInForceRules: public FIX::Group
         {
         public:
-        NoTimeInForceRules() : FIX::Group(1239,59,FIX::message_order(59,0)) {}
+        NoTimeInForceRules() : FIX::Group(1239,59,FIX::message_order(fieldOrder(),1)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{59,1}};
+          return order;
+        }
           FIELD_SET(*this, FIX::TimeInForce);
         };
         FIELD_SET(*this, FIX::NoExecInstRules);
         class NoExecInstRules: public FIX::Group
         {
         public:
-        NoExecInstRules() : FIX::Group(1232,1308,FIX::message_order(1308,0)) {}
+        NoExecInstRules() : FIX::Group(1232,1308,FIX::message_order(fieldOrder(),1)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{1308,1}};
+          return order;
+        }
           FIELD_SET(*this, FIX::ExecInstValue);
         };
         FIELD_SET(*this, FIX::NoMatchRules);
         class NoMatchRules: public FIX::Group
         {
         public:
-        NoMatchRules() : FIX::Group(1235,1142,FIX::message_order(1142,574,0)) {}
+        NoMatchRules() : FIX::Group(1235,1142,FIX::message_order(fieldOrder(),2)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{574,2},{1142,1}};
+          return order;
+        }
           FIELD_SET(*this, FIX::MatchAlgorithm);
           FIELD_SET(*this, FIX::MatchType);
         };
@@ -303,7 +387,12 @@ namespace FIX50SP1
         class NoMDFeedTypes: public FIX::Group
         {
         public:
-        NoMDFeedTypes() : FIX::Group(1141,1022,FIX::message_order(1022,264,1021,0)) {}
+        NoMDFeedTypes() : FIX::Group(1141,1022,FIX::message_order(fieldOrder(),3)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{264,2},{1021,3},{1022,1}};
+          return order;
+        }
           FIELD_SET(*this, FIX::MDFeedType);
           FIELD_SET(*this, FIX::MarketDepth);
           FIELD_SET(*this, FIX::MDBookType);
@@ -313,7 +402,12 @@ namespace FIX50SP1
       class NoNestedInstrAttrib: public FIX::Group
       {
       public:
-      NoNestedInstrAttrib() : FIX::Group(1312,1210,FIX::message_order(1210,1211,0)) {}
+      NoNestedInstrAttrib() : FIX::Group(1312,1210,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{1210,1},{1211,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::NestedInstrAttribType);
         FIELD_SET(*this, FIX::NestedInstrAttribValue);
       };
@@ -321,7 +415,12 @@ namespace FIX50SP1
       class NoStrikeRules: public FIX::Group
       {
       public:
-      NoStrikeRules() : FIX::Group(1201,1223,FIX::message_order(1223,1202,1203,1204,1304,1236,0)) {}
+      NoStrikeRules() : FIX::Group(1201,1223,FIX::message_order(fieldOrder(),6)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{1202,2},{1203,3},{1204,4},{1223,1},{1236,6},{1304,5}};
+        return order;
+      }
         FIELD_SET(*this, FIX::StrikeRuleID);
         FIELD_SET(*this, FIX::StartStrikePxRange);
         FIELD_SET(*this, FIX::EndStrikePxRange);
@@ -331,7 +430,12 @@ namespace FIX50SP1
         class NoMaturityRules: public FIX::Group
         {
         public:
-        NoMaturityRules() : FIX::Group(1236,1222,FIX::message_order(1222,1303,1302,1241,1226,1229,0)) {}
+        NoMaturityRules() : FIX::Group(1236,1222,FIX::message_order(fieldOrder(),6)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{1222,1},{1226,5},{1229,6},{1241,4},{1302,3},{1303,2}};
+          return order;
+        }
           FIELD_SET(*this, FIX::MaturityRuleID);
           FIELD_SET(*this, FIX::MaturityMonthYearFormat);
           FIELD_SET(*this, FIX::MaturityMonthYearIncrementUnits);
@@ -347,7 +451,12 @@ namespace FIX50SP1
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(55,65,48,22,460,1227,1151,461,167,762,200,541,1079,966,1049,965,224,225,239,226,227,228,255,543,470,471,472,240,202,947,967,968,206,231,969,1146,996,1147,1191,1192,1193,1194,1195,1196,1197,1198,1199,1200,201,1244,1242,997,223,207,970,971,106,348,349,107,350,351,691,667,875,876,873,874,1305,1221,1230,1240,15,292,668,869,555,58,354,355,0)) {}
+    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(fieldOrder(),80)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{15,73},{22,4},{48,3},{55,1},{58,78},{65,2},{106,57},{107,60},{167,9},{200,11},{201,49},{202,29},{206,33},{207,54},{223,53},{224,17},{225,18},{226,20},{227,21},{228,22},{231,34},{239,19},{240,28},{255,23},{292,74},{348,58},{349,59},{350,61},{351,62},{354,79},{355,80},{460,5},{461,8},{470,25},{471,26},{472,27},{541,12},{543,24},{555,77},{667,64},{668,75},{691,63},{762,10},{869,76},{873,67},{874,68},{875,65},{876,66},{947,30},{965,16},{966,14},{967,31},{968,32},{969,35},{970,55},{971,56},{996,37},{997,52},{1049,15},{1079,13},{1146,36},{1147,38},{1151,7},{1191,39},{1192,40},{1193,41},{1194,42},{1195,43},{1196,44},{1197,45},{1198,46},{1199,47},{1200,48},{1221,70},{1227,6},{1230,71},{1240,72},{1242,51},{1244,50},{1305,69}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -356,7 +465,12 @@ namespace FIX50SP1
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{455,1},{456,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
@@ -429,7 +543,12 @@ namespace FIX50SP1
       class NoEvents: public FIX::Group
       {
       public:
-      NoEvents() : FIX::Group(864,865,FIX::message_order(865,866,1145,867,868,0)) {}
+      NoEvents() : FIX::Group(864,865,FIX::message_order(fieldOrder(),5)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{865,1},{866,2},{867,4},{868,5},{1145,3}};
+        return order;
+      }
         FIELD_SET(*this, FIX::EventType);
         FIELD_SET(*this, FIX::EventDate);
         FIELD_SET(*this, FIX::EventTime);
@@ -442,7 +561,12 @@ namespace FIX50SP1
       class NoInstrumentParties: public FIX::Group
       {
       public:
-      NoInstrumentParties() : FIX::Group(1018,1019,FIX::message_order(1019,1050,1051,1052,0)) {}
+      NoInstrumentParties() : FIX::Group(1018,1019,FIX::message_order(fieldOrder(),4)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{1019,1},{1050,2},{1051,3},{1052,4}};
+        return order;
+      }
         FIELD_SET(*this, FIX::InstrumentPartyID);
         FIELD_SET(*this, FIX::InstrumentPartyIDSource);
         FIELD_SET(*this, FIX::InstrumentPartyRole);
@@ -450,7 +574,12 @@ namespace FIX50SP1
         class NoInstrumentPartySubIDs: public FIX::Group
         {
         public:
-        NoInstrumentPartySubIDs() : FIX::Group(1052,1053,FIX::message_order(1053,1054,0)) {}
+        NoInstrumentPartySubIDs() : FIX::Group(1052,1053,FIX::message_order(fieldOrder(),2)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{1053,1},{1054,2}};
+          return order;
+        }
           FIELD_SET(*this, FIX::InstrumentPartySubID);
           FIELD_SET(*this, FIX::InstrumentPartySubIDType);
         };
@@ -467,7 +596,12 @@ namespace FIX50SP1
       class NoInstrAttrib: public FIX::Group
       {
       public:
-      NoInstrAttrib() : FIX::Group(870,871,FIX::message_order(871,872,0)) {}
+      NoInstrAttrib() : FIX::Group(870,871,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{871,1},{872,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::InstrAttribType);
         FIELD_SET(*this, FIX::InstrAttribValue);
       };
@@ -475,7 +609,12 @@ namespace FIX50SP1
       class NoLegs: public FIX::Group
       {
       public:
-      NoLegs() : FIX::Group(555,600,FIX::message_order(600,601,602,603,607,608,609,764,610,611,1212,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,999,1224,1421,1422,1001,1420,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,1358,1017,0)) {}
+      NoLegs() : FIX::Group(555,600,FIX::message_order(fieldOrder(),50)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{248,12},{249,13},{250,14},{251,15},{252,16},{253,17},{254,23},{257,18},{556,44},{596,20},{597,21},{598,22},{599,19},{600,1},{601,2},{602,3},{603,4},{607,5},{608,6},{609,7},{610,9},{611,10},{612,24},{613,26},{614,27},{615,34},{616,35},{617,36},{618,37},{619,38},{620,39},{621,40},{622,41},{623,42},{624,43},{739,46},{740,45},{764,8},{942,25},{955,47},{956,48},{999,28},{1001,32},{1017,50},{1212,11},{1224,29},{1358,49},{1420,33},{1421,30},{1422,31}};
+        return order;
+      }
         FIELD_SET(*this, FIX::LegSymbol);
         FIELD_SET(*this, FIX::LegSymbolSfx);
         FIELD_SET(*this, FIX::LegSecurityID);
@@ -484,7 +623,12 @@ namespace FIX50SP1
         class NoLegSecurityAltID: public FIX::Group
         {
         public:
-        NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(605,606,0)) {}
+        NoLegSecurityAltID() : FIX::Group(604,605,FIX::message_order(fieldOrder(),2)) {}
+        static const FIX::message_order::field_position* fieldOrder()
+        {
+          static const FIX::message_order::field_position order[] = {{605,1},{606,2}};
+          return order;
+        }
           FIELD_SET(*this, FIX::LegSecurityAltID);
           FIELD_SET(*this, FIX::LegSecurityAltIDSource);
         };
@@ -12,7 +12,6 @@ namespace FIX50SP1
     MarketDefinition() : Message(MsgType()) {}
     MarketDefinition(const FIX::Message& m) : Message(m) {}
     MarketDefinition(const Message& m) : Message(m) {}
-    MarketDefinition(const MarketDefinition& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("BU"); }
 
     MarketDefinition(
@@ -41,7 +40,12 @@ namespace FIX50SP1
     class NoTickRules: public FIX::Group
     {
     public:
-    NoTickRules() : FIX::Group(1205,1206,FIX::message_order(1206,1207,1208,1209,0)) {}
+    NoTickRules() : FIX::Group(1205,1206,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1206,1},{1207,2},{1208,3},{1209,4}};
+      return order;
+    }
       FIELD_SET(*this, FIX::StartTickPriceRange);
       FIELD_SET(*this, FIX::EndTickPriceRange);
       FIELD_SET(*this, FIX::TickIncrement);
@@ -51,7 +55,12 @@ namespace FIX50SP1
     class NoLotTypeRules: public FIX::Group
     {
     public:
-    NoLotTypeRules() : FIX::Group(1234,1093,FIX::message_order(1093,1231,0)) {}
+    NoLotTypeRules() : FIX::Group(1234,1093,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1093,1},{1231,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::LotType);
       FIELD_SET(*this, FIX::MinLotSize);
     };
@@ -73,21 +82,36 @@ namespace FIX50SP1
     class NoOrdTypeRules: public FIX::Group
     {
     public:
-    NoOrdTypeRules() : FIX::Group(1237,40,FIX::message_order(40,0)) {}
+    NoOrdTypeRules() : FIX::Group(1237,40,FIX::message_order(fieldOrder(),1)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{40,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::OrdType);
     };
     FIELD_SET(*this, FIX::NoTimeInForceRules);
     class NoTimeInForceRules: public FIX::Group
     {
     public:
-    NoTimeInForceRules() : FIX::Group(1239,59,FIX::message_order(59,0)) {}
+    NoTimeInForceRules() : FIX::Group(1239,59,FIX::message_order(fieldOrder(),1)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{59,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::TimeInForce);
     };
     FIELD_SET(*this, FIX::NoExecInstRules);
     class NoExecInstRules: public FIX::Group
     {
     public:
-    NoExecInstRules() : FIX::Group(1232,1308,FIX::message_order(1308,0)) {}
+    NoExecInstRules() : FIX::Group(1232,1308,FIX::message_order(fieldOrder(),1)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1308,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::ExecInstValue);
     };
     FIELD_SET(*this, FIX::TransactTime);
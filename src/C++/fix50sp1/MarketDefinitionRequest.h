@@ -12,7 +12,6 @@ namespace FIX50SP1
     MarketDefinitionRequest() : Message(MsgType()) {}
     MarketDefinitionRequest(const FIX::Message& m) : Message(m) {}
     MarketDefinitionRequest(const Message& m) : Message(m) {}
-    MarketDefinitionRequest(const MarketDefinitionRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("BT"); }
 
     MarketDefinitionRequest(
@@ -12,7 +12,6 @@ namespace FIX50SP1
     NetworkCounterpartySystemStatusRequest() : Message(MsgType()) {}
     NetworkCounterpartySystemStatusRequest(const FIX::Message& m) : Message(m) {}
     NetworkCounterpartySystemStatusRequest(const Message& m) : Message(m) {}
-    NetworkCounterpartySystemStatusRequest(const NetworkCounterpartySystemStatusRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("BC"); }
 
     NetworkCounterpartySystemStatusRequest(
@@ -30,7 +29,12 @@ namespace FIX50SP1
     class NoCompIDs: public FIX::Group
     {
     public:
-    NoCompIDs() : FIX::Group(936,930,FIX::message_order(930,931,283,284,0)) {}
+    NoCompIDs() : FIX::Group(936,930,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{283,3},{284,4},{930,1},{931,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::RefCompID);
       FIELD_SET(*this, FIX::RefSubID);
       FIELD_SET(*this, FIX::LocationID);
@@ -12,7 +12,6 @@ namespace FIX50SP1
     SecurityTypeRequest() : Message(MsgType()) {}
     SecurityTypeRequest(const FIX::Message& m) : Message(m) {}
     SecurityTypeRequest(const Message& m) : Message(m) {}
-    SecurityTypeRequest(const SecurityTypeRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("v"); }
 
     SecurityTypeRequest(
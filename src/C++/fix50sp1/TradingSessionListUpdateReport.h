@@ -12,7 +12,6 @@ namespace FIX50SP1
     TradingSessionListUpdateReport() : Message(MsgType()) {}
     TradingSessionListUpdateReport(const FIX::Message& m) : Message(m) {}
     TradingSessionListUpdateReport(const Message& m) : Message(m) {}
-    TradingSessionListUpdateReport(const TradingSessionListUpdateReport& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("BS"); }
 
     FIELD_SET(*this, FIX::ApplID);
@@ -25,7 +24,12 @@ namespace FIX50SP1
     class NoTradingSessions: public FIX::Group
     {
     public:
-    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,207,1301,1300,1326,338,339,325,340,567,341,342,343,344,345,387,58,354,355,0)) {}
+    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(fieldOrder(),20)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{58,18},{207,3},{325,9},{336,1},{338,7},{339,8},{340,10},{341,12},{342,13},{343,14},{344,15},{345,16},{354,19},{355,20},{387,17},{567,11},{625,2},{1300,5},{1301,4},{1326,6}};
+      return order;
+    }
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
       FIELD_SET(*this, FIX::SecurityExchange);
@@ -47,28 +51,48 @@ namespace FIX50SP1
       class NoOrdTypeRules: public FIX::Group
       {
       public:
-      NoOrdTypeRules() : FIX::Group(1237,40,FIX::message_order(40,0)) {}
+      NoOrdTypeRules() : FIX::Group(1237,40,FIX::message_order(fieldOrder(),1)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{40,1}};
+        return order;
+      }
         FIELD_SET(*this, FIX::OrdType);
       };
       FIELD_SET(*this, FIX::NoTimeInForceRules);
       class NoTimeInForceRules: public FIX::Group
       {
       public:
-      NoTimeInForceRules() : FIX::Group(1239,59,FIX::message_order(59,0)) {}
+      NoTimeInForceRules() : FIX::Group(1239,59,FIX::message_order(fieldOrder(),1)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{59,1}};
+        return order;
+      }
         FIELD_SET(*this, FIX::TimeInForce);
       };
       FIELD_SET(*this, FIX::NoExecInstRules);
       class NoExecInstRules: public FIX::Group
       {
       public:
-      NoExecInstRules() : FIX::Group(1232,1308,FIX::message_order(1308,0)) {}
+      NoExecInstRules() : FIX::Group(1232,1308,FIX::message_order(fieldOrder(),1)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{1308,1}};
+        return order;
+      }
         FIELD_SET(*this, FIX::ExecInstValue);
       };
       FIELD_SET(*this, FIX::NoMatchRules);
       class NoMatchRules: public FIX::Group
       {
       public:
-      NoMatchRules() : FIX::Group(1235,1142,FIX::message_order(1142,574,0)) {}
+      NoMatchRules() : FIX::Group(1235,1142,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{574,2},{1142,1}};
+        return order;
+      }
         FIELD_SET(*this, FIX::MatchAlgorithm);
         FIELD_SET(*this, FIX::MatchType);
       };
@@ -76,7 +100,12 @@ namespace FIX50SP1
       class NoMDFeedTypes: public FIX::Group
       {
       public:
-      NoMDFeedTypes() : FIX::Group(1141,1022,FIX::message_order(1022,264,1021,0)) {}
+      NoMDFeedTypes() : FIX::Group(1141,1022,FIX::message_order(fieldOrder(),3)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{264,2},{1021,3},{1022,1}};
+        return order;
+      }
         FIELD_SET(*this, FIX::MDFeedType);
         FIELD_SET(*this, FIX::MarketDepth);
         FIELD_SET(*this, FIX::MDBookType);
@@ -12,7 +12,6 @@ namespace FIX50SP2
     DerivativeSecurityListRequest() : Message(MsgType()) {}
     DerivativeSecurityListRequest(const FIX::Message& m) : Message(m) {}
     DerivativeSecurityListRequest(const Message& m) : Message(m) {}
-    DerivativeSecurityListRequest(const DerivativeSecurityListRequest& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("z"); }
 
     DerivativeSecurityListRequest(
@@ -36,7 +35,12 @@ namespace FIX50SP2
     class NoUnderlyingSecurityAltID: public FIX::Group
     {
     public:
-    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
+    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{458,1},{459,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
     };
@@ -95,7 +99,12 @@ namespace FIX50SP2
     class NoUnderlyingStips: public FIX::Group
     {
     public:
-    NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(888,889,0)) {}
+    NoUnderlyingStips() : FIX::Group(887,888,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{888,1},{889,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UnderlyingStipType);
       FIELD_SET(*this, FIX::UnderlyingStipValue);
     };
@@ -107,7 +116,12 @@ namespace FIX50SP2
     class NoUndlyInstrumentParties: public FIX::Group
     {
     public:
-    NoUndlyInstrumentParties() : FIX::Group(1058,1059,FIX::message_order(1059,1060,1061,1062,0)) {}
+    NoUndlyInstrumentParties() : FIX::Group(1058,1059,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1059,1},{1060,2},{1061,3},{1062,4}};
+      return order;
+    }
       FIELD_SET(*this, FIX::UnderlyingInstrumentPartyID);
       FIELD_SET(*this, FIX::UnderlyingInstrumentPartyIDSource);
       FIELD_SET(*this, FIX::UnderlyingInstrumentPartyRole);
@@ -115,7 +129,12 @@ namespace FIX50SP2
       class NoUndlyInstrumentPartySubIDs: public FIX::Group
       {
       public:
-      NoUndlyInstrumentPartySubIDs() : FIX::Group(1062,1063,FIX::message_order(1063,1064,0)) {}
+      NoUndlyInstrumentPartySubIDs() : FIX::Group(1062,1063,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{1063,1},{1064,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::UnderlyingInstrumentPartySubID);
         FIELD_SET(*this, FIX::UnderlyingInstrumentPartySubIDType);
       };
@@ -138,7 +157,12 @@ namespace FIX50SP2
     class NoDerivativeSecurityAltID: public FIX::Group
     {
     public:
-    NoDerivativeSecurityAltID() : FIX::Group(1218,1219,FIX::message_order(1219,1220,0)) {}
+    NoDerivativeSecurityAltID() : FIX::Group(1218,1219,FIX::message_order(fieldOrder(),2)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1219,1},{1220,2}};
+      return order;
+    }
       FIELD_SET(*this, FIX::DerivativeSecurityAltID);
       FIELD_SET(*this, FIX::DerivativeSecurityAltIDSource);
     };
@@ -199,7 +223,12 @@ namespace FIX50SP2
     class NoDerivativeEvents: public FIX::Group
     {
     public:
-    NoDerivativeEvents() : FIX::Group(1286,1287,FIX::message_order(1287,1288,1289,1290,1291,0)) {}
+    NoDerivativeEvents() : FIX::Group(1286,1287,FIX::message_order(fieldOrder(),5)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1287,1},{1288,2},{1289,3},{1290,4},{1291,5}};
+      return order;
+    }
       FIELD_SET(*this, FIX::DerivativeEventType);
       FIELD_SET(*this, FIX::DerivativeEventDate);
       FIELD_SET(*this, FIX::DerivativeEventTime);
@@ -210,7 +239,12 @@ namespace FIX50SP2
     class NoDerivativeInstrumentParties: public FIX::Group
     {
     public:
-    NoDerivativeInstrumentParties() : FIX::Group(1292,1293,FIX::message_order(1293,1294,1295,1296,0)) {}
+    NoDerivativeInstrumentParties() : FIX::Group(1292,1293,FIX::message_order(fieldOrder(),4)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{1293,1},{1294,2},{1295,3},{1296,4}};
+      return order;
+    }
       FIELD_SET(*this, FIX::DerivativeInstrumentPartyID);
       FIELD_SET(*this, FIX::DerivativeInstrumentPartyIDSource);
       FIELD_SET(*this, FIX::DerivativeInstrumentPartyRole);
@@ -218,7 +252,12 @@ namespace FIX50SP2
       class NoDerivativeInstrumentPartySubIDs: public FIX::Group
       {
       public:
-      NoDerivativeInstrumentPartySubIDs() : FIX::Group(1296,1297,FIX::message_order(1297,1298,0)) {}
+      NoDerivativeInstrumentPartySubIDs() : FIX::Group(1296,1297,FIX::message_order(fieldOrder(),2)) {}
+      static const FIX::message_order::field_position* fieldOrder()
+      {
+        static const FIX::message_order::field_position order[] = {{1297,1},{1298,2}};
+        return order;
+      }
         FIELD_SET(*this, FIX::DerivativeInstrumentPartySubID);
         FIELD_SET(*this, FIX::DerivativeInstrumentPartySubIDType);
       };
@@ -12,7 +12,6 @@ namespace FIX50SP2
     StreamAssignmentReportACK() : Message(MsgType()) {}
     StreamAssignmentReportACK(const FIX::Message& m) : Message(m) {}
     StreamAssignmentReportACK(const Message& m) : Message(m) {}
-    StreamAssignmentReportACK(const StreamAssignmentReportACK& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("CE"); }
 
     StreamAssignmentReportACK(
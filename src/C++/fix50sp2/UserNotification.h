@@ -12,7 +12,6 @@ namespace FIX50SP2
     UserNotification() : Message(MsgType()) {}
     UserNotification(const FIX::Message& m) : Message(m) {}
     UserNotification(const Message& m) : Message(m) {}
-    UserNotification(const UserNotification& m) : Message(m) {}
     static FIX::MsgType MsgType() { return FIX::MsgType("CB"); }
 
     UserNotification(
@@ -26,7 +25,12 @@ namespace FIX50SP2
     class NoUsernames: public FIX::Group
     {
     public:
-    NoUsernames() : FIX::Group(809,553,FIX::message_order(553,0)) {}
+    NoUsernames() : FIX::Group(809,553,FIX::message_order(fieldOrder(),1)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{553,1}};
+      return order;
+    }
       FIELD_SET(*this, FIX::Username);
     };
     FIELD_SET(*this, FIX::UserStatus);
@@ -41,7 +41,12 @@ namespace FIXT11
     class NoHops: public FIX::Group
     {
     public:
-    NoHops() : FIX::Group(627,628,FIX::message_order(628,629,630,0)) {}
+    NoHops() : FIX::Group(627,628,FIX::message_order(fieldOrder(),3)) {}
+    static const FIX::message_order::field_position* fieldOrder()
+    {
+      static const FIX::message_order::field_position order[] = {{628,1},{629,2},{630,3}};
+      return order;
+    }
       FIELD_SET(*this, FIX::HopCompID);
       FIELD_SET(*this, FIX::HopSendingTime);
       FIELD_SET(*this, FIX::HopRefID);
@@ -65,7 +70,6 @@ namespace FIXT11
      {} 
 
     Message(const FIX::Message& m) : FIX::Message(m) {}
-    Message(const Message& m) : FIX::Message(m) {}
     Header& getHeader() { return (Header&)m_header; }
     const Header& getHeader() const { return (Header&)m_header; }
     Trailer& getTrailer() { return (Trailer&)m_trailer; }
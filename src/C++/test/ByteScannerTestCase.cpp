@@ -0,0 +1,112 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <ByteScanner.h>
+#include <string>
+
+using namespace FIX;
+
+SUITE(ByteScannerTests)
+{
+
+struct byteScannerFixture
+{
+  byteScannerFixture() : kernel( ByteScanner::kernel() )
+  {
+    // long enough to exercise the vector loops and their scalar tails
+    for( int i = 0; i < 50; ++i )
+      buffer += "8=FIX.4.4\0019=12\00135=D\00155=\xe9\xe8MSFT\001";
+  }
+
+  ~byteScannerFixture()
+  {
+    ByteScanner::select( kernel );
+  }
+
+  ByteScanner::Kernel kernel;
+  std::string buffer;
+};
+
+TEST_FIXTURE(byteScannerFixture, kernelsAgree)
+{
+  const char* begin = buffer.data();
+  const char* end = begin + buffer.size();
+
+  ByteScanner::Kernel kernels[] = { ByteScanner::SCALAR, ByteScanner::SSE2, ByteScanner::AVX2 };
+  for( int k = 0; k < 3; ++k )
+  {
+    if( !ByteScanner::select( kernels[ k ] ) )
+      continue;
+
+    unsigned long expected = 0;
+    for( std::string::size_type i = 0; i < buffer.size(); ++i )
+      expected += (unsigned char)buffer[ i ];
+
+    for( std::string::size_type offset = 0; offset < 70; ++offset )
+    {
+      CHECK_EQUAL( buffer.find( '\001', offset ), (std::string::size_type)( ByteScanner::findSoh( begin + offset, end ) - begin ) );
+      CHECK_EQUAL( buffer.find( '=', offset ), (std::string::size_type)( ByteScanner::find( begin + offset, end, '=' ) - begin ) );
+      expected -= offset ? (unsigned char)buffer[ offset - 1 ] : 0;
+      CHECK_EQUAL( expected, ByteScanner::sum( begin + offset, end ) );
+    }
+
+    CHECK( end == ByteScanner::find( begin, end, '|' ) );
+    CHECK( end == ByteScanner::find( end, end, '=' ) );
+    CHECK_EQUAL( 0lu, ByteScanner::sum( end, end ) );
+  }
+}
+
+TEST_FIXTURE(byteScannerFixture, findField)
+{
+  const char* begin = buffer.data();
+  const char* equalSign = 0;
+  const char* soh = 0;
+  CHECK( ByteScanner::findField( begin, begin + buffer.size(), equalSign, soh ) );
+  CHECK_EQUAL( 1, equalSign - begin );
+  CHECK_EQUAL( 9, soh - begin );
+  CHECK( !ByteScanner::findField( begin, begin + 5, equalSign, soh ) );
+}
+
+TEST(parseTag)
+{
+  const char* tag = "10=5";
+  int value = 0;
+  CHECK( ByteScanner::parseTag( tag, tag + 2, value ) );
+  CHECK_EQUAL( 10, value );
+  CHECK( !ByteScanner::parseTag( tag, tag, value ) );
+  CHECK( !ByteScanner::parseTag( tag, tag + 3, value ) );
+
+  const char* negative = "-1=HI";
+  CHECK( ByteScanner::parseTag( negative, negative + 2, value ) );
+  CHECK_EQUAL( -1, value );
+  CHECK( !ByteScanner::parseTag( negative, negative + 1, value ) );
+
+  const char* tooLong = "1234567890";
+  CHECK( !ByteScanner::parseTag( tooLong, tooLong + 10, value ) );
+}
+
+}
@@ -0,0 +1,102 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <Clock.h>
+#include <cstdlib>
+
+using namespace FIX;
+
+SUITE(ClockTests)
+{
+
+static bool isClose( int64_t lhs, int64_t rhs, int64_t tolerance )
+{
+  int64_t difference = lhs - rhs;
+  return difference <= tolerance && -difference <= tolerance;
+}
+
+TEST(toTimeStamp)
+{
+  // 2013-05-10 12:34:56.123456789
+  int64_t nanos = (int64_t)1368189296 * DateTime::NANOS_PER_SEC + 123456789;
+  UtcTimeStamp timeStamp = Clock::toTimeStamp( nanos );
+  CHECK_EQUAL( 2013, timeStamp.getYear() );
+  CHECK_EQUAL( 5, timeStamp.getMonth() );
+  CHECK_EQUAL( 10, timeStamp.getDay() );
+  CHECK_EQUAL( 12, timeStamp.getHour() );
+  CHECK_EQUAL( 34, timeStamp.getMinute() );
+  CHECK_EQUAL( 56, timeStamp.getSecond() );
+  CHECK_EQUAL( 123456789, (int)timeStamp.getNanosecond() );
+  CHECK( UtcTimeStamp( (time_t)1368189296, 123456789, 9 ) == timeStamp );
+}
+
+TEST(create)
+{
+  Clock* pClock = Clock::create( "realtime" );
+  CHECK( dynamic_cast<RealtimeClock*>( pClock ) != 0 );
+  delete pClock;
+
+  pClock = Clock::create( "COARSE" );
+  CHECK( dynamic_cast<CoarseClock*>( pClock ) != 0 );
+  delete pClock;
+
+  pClock = Clock::create( "TSC" );
+  CHECK( dynamic_cast<TscClock*>( pClock ) != 0 );
+  delete pClock;
+
+  CHECK_THROW( Clock::create( "SUNDIAL" ), ConfigError );
+}
+
+TEST(realtimeClock)
+{
+  RealtimeClock clock;
+  CHECK( abs( clock.now() - UtcTimeStamp() ) <= 1 );
+  CHECK( clock.nanos() <= clock.nanos() );
+}
+
+TEST(coarseClock)
+{
+  // the coarse clock is only as fine as the kernel tick
+  CoarseClock clock;
+  CHECK( isClose( clock.nanos(), Clock::realtime().nanos(),
+                  DateTime::NANOS_PER_SEC / 10 ) );
+}
+
+TEST(tscClock)
+{
+  TscClock clock( 0.001 );
+  CHECK( isClose( clock.nanos(), Clock::realtime().nanos(),
+                  DateTime::NANOS_PER_SEC / 100 ) );
+
+  // still follows the realtime clock after being re-anchored
+  process_sleep( 0.05 );
+  CHECK( isClose( clock.nanos(), Clock::realtime().nanos(),
+                  DateTime::NANOS_PER_SEC / 100 ) );
+  CHECK( abs( clock.now() - UtcTimeStamp() ) <= 1 );
+}
+
+}
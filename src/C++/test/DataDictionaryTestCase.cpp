@@ -338,6 +338,131 @@ TEST_FIXTURE(checkHasRequiredFixture, checkHasRequired)
   CHECK_THROW( object.validate( message ), RequiredTagMissing );
 }
 
+TEST_FIXTURE(checkHasRequiredFixture, checkHasRequiredCompiled)
+{
+  object.compile();
+  CHECK( object.isCompiled() );
+
+  FIX40::TestRequest message;
+  message.getTrailer().setField( SignatureLength( 1 ) );
+  CHECK_THROW( object.validate( message ), RequiredTagMissing );
+
+  message.getHeader().setField( SenderCompID( "SENDER" ) );
+  CHECK_THROW( object.validate( message ), RequiredTagMissing );
+
+  message.setField( TestReqID( "1" ) );
+  object.validate( message );
+
+  message.getTrailer().removeField( FIELD::SignatureLength );
+  CHECK_THROW( object.validate( message ), RequiredTagMissing );
+}
+
+TEST(compile)
+{
+  DataDictionary object;
+  object.setVersion( "FIX.4.2" );
+  object.addField( 11 );
+  object.addField( 35 );
+  object.addField( 55 );
+  object.addField( 5001 );
+  object.addHeaderField( 35, true );
+  object.addTrailerField( 10, true );
+  object.addFieldType( 11, TYPE::String );
+  object.addFieldType( 18, TYPE::MultipleValueString );
+  object.addFieldType( 95, TYPE::Data );
+  object.addFieldValue( 18, "A" );
+  object.addFieldValue( 18, "B" );
+  object.addMsgType( "D" );
+  object.addMsgField( "D", 11 );
+  object.addMsgField( "D", 5001 );
+  object.addMsgField( "AE", 55 );
+  object.addRequiredField( "D", 11 );
+
+  DataDictionary group;
+  group.addField( 448 );
+  object.addGroup( "D", 453, 448, group );
+  CHECK( !object.isCompiled() );
+
+  DataDictionary compiled( object );
+  compiled.compile();
+  CHECK( compiled.isCompiled() );
+
+  const char* msgTypes[] = { "D", "AE", "8", "" };
+  for( int field = -1; field <= 5002; ++field )
+  {
+    CHECK_EQUAL( object.isField( field ), compiled.isField( field ) );
+    CHECK_EQUAL( object.isHeaderField( field ), compiled.isHeaderField( field ) );
+    CHECK_EQUAL( object.isTrailerField( field ), compiled.isTrailerField( field ) );
+    CHECK_EQUAL( object.isDataField( field ), compiled.isDataField( field ) );
+    CHECK_EQUAL( object.isMultipleValueField( field ), compiled.isMultipleValueField( field ) );
+    CHECK_EQUAL( object.hasFieldValue( field ), compiled.hasFieldValue( field ) );
+
+    TYPE::Type type = TYPE::Unknown;
+    TYPE::Type compiledType = TYPE::Unknown;
+    CHECK_EQUAL( object.getFieldType( field, type ),
+                 compiled.getFieldType( field, compiledType ) );
+    CHECK_EQUAL( type, compiledType );
+
+    for( int i = 0; i < 4; ++i )
+    {
+      CHECK_EQUAL( object.isMsgField( msgTypes[ i ], field ),
+                   compiled.isMsgField( msgTypes[ i ], field ) );
+      CHECK_EQUAL( object.isGroup( msgTypes[ i ], field ),
+                   compiled.isGroup( msgTypes[ i ], field ) );
+    }
+  }
+
+  CHECK( compiled.isFieldValue( 18, "A B" ) );
+  CHECK( !compiled.isFieldValue( 18, "A C" ) );
+
+  int delim;
+  const DataDictionary* pDD = 0;
+  CHECK( compiled.getGroup( "D", 453, delim, pDD ) );
+  CHECK( pDD->isCompiled() );
+  CHECK( pDD->isField( 448 ) );
+
+  // copies of a compiled dictionary are compiled, changes fall back to
+  // the maps until it is compiled again
+  DataDictionary copy( compiled );
+  CHECK( copy.isCompiled() );
+  copy.addMsgField( "D", 55 );
+  CHECK( !copy.isCompiled() );
+  CHECK( copy.isMsgField( "D", 55 ) );
+
+  CHECK( DataDictionary( "../spec/FIX44.xml" ).isCompiled() );
+}
+
+TEST(compiledFieldValues)
+{
+  DataDictionary object;
+  object.addFieldType( 167, TYPE::String );
+  const char* values[] = { "FUT", "OPT", "CS", "PS", "MLEG", "CORP", "TBOND",
+                           "FOR", "WAR", "MF", "CD", "XCN", "SWAP", "NONE" };
+  for( int i = 0; i < 14; ++i )
+    object.addFieldValue( 167, values[ i ] );
+  object.addFieldValue( 54, "1" );
+  object.addFieldValue( 54, "\xff" );
+  object.addFieldValue( 58, "" );
+
+  DataDictionary compiled( object );
+  compiled.compile();
+
+  for( int i = 0; i < 14; ++i )
+  {
+    CHECK( compiled.isFieldValue( 167, values[ i ] ) );
+    CHECK( !compiled.isFieldValue( 167, std::string( values[ i ] ) + "X" ) );
+  }
+  CHECK( !compiled.isFieldValue( 167, "F" ) );
+  CHECK( !compiled.isFieldValue( 167, "" ) );
+  CHECK( compiled.isFieldValue( 54, "1" ) );
+  CHECK( compiled.isFieldValue( 54, "\xff" ) );
+  CHECK( !compiled.isFieldValue( 54, "2" ) );
+  CHECK( !compiled.isFieldValue( 54, "11" ) );
+  CHECK( compiled.isFieldValue( 58, "" ) );
+  CHECK( !compiled.isFieldValue( 58, "A" ) );
+  CHECK( !compiled.isFieldValue( 59, "1" ) );
+}
+
 struct checkValidFormatFixture
 {
   checkValidFormatFixture()
@@ -0,0 +1,138 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <Decimal.h>
+#include <Field.h>
+#include <Fields.h>
+
+using namespace FIX;
+
+SUITE(DecimalTests)
+{
+
+TEST(parse)
+{
+  Decimal result;
+  CHECK( Decimal::parse( "123.45", "123.45" + 6, result ) );
+  CHECK_EQUAL( 12345, result.getMantissa() );
+  CHECK_EQUAL( -2, result.getExponent() );
+
+  result = Decimal( "-0.0012" );
+  CHECK_EQUAL( -12, result.getMantissa() );
+  CHECK_EQUAL( -4, result.getExponent() );
+
+  result = Decimal( "100" );
+  CHECK_EQUAL( 100, result.getMantissa() );
+  CHECK_EQUAL( 0, result.getExponent() );
+
+  result = Decimal( "1." );
+  CHECK_EQUAL( 1, result.getMantissa() );
+  result = Decimal( ".5" );
+  CHECK_EQUAL( 5, result.getMantissa() );
+  CHECK_EQUAL( -1, result.getExponent() );
+
+  // runs long enough to take the eight digit path
+  result = Decimal( "12345678.87654321" );
+  CHECK_EQUAL( 1234567887654321LL, (long long)result.getMantissa() );
+  CHECK_EQUAL( -8, result.getExponent() );
+  result = Decimal( "00000000000000000000123456789" );
+  CHECK_EQUAL( 123456789LL, (long long)result.getMantissa() );
+  result = Decimal( "0.000000000000000000000001" );
+  CHECK_EQUAL( 1, result.getMantissa() );
+  CHECK_EQUAL( -24, result.getExponent() );
+  result = Decimal( "999999999999999999" );
+  CHECK_EQUAL( 999999999999999999LL, (long long)result.getMantissa() );
+  result = Decimal( "-99999999.9999999999" );
+  CHECK_EQUAL( -999999999999999999LL, (long long)result.getMantissa() );
+
+  CHECK_THROW( Decimal( "1999999999999999999" ), FieldConvertError );
+  CHECK_THROW( Decimal( "12345678.12345678901" ), FieldConvertError );
+  CHECK_THROW( Decimal( "" ), FieldConvertError );
+  CHECK_THROW( Decimal( "-" ), FieldConvertError );
+  CHECK_THROW( Decimal( "." ), FieldConvertError );
+  CHECK_THROW( Decimal( "+1" ), FieldConvertError );
+  CHECK_THROW( Decimal( "1e5" ), FieldConvertError );
+  CHECK_THROW( Decimal( "1.2.3" ), FieldConvertError );
+  CHECK_THROW( Decimal( "1234567a90123" ), FieldConvertError );
+}
+
+TEST(format)
+{
+  CHECK_EQUAL( "123.45", Decimal( 12345, -2 ).toString() );
+  CHECK_EQUAL( "-0.0012", Decimal( -12, -4 ).toString() );
+  CHECK_EQUAL( "0.50", Decimal( 50, -2 ).toString() );
+  CHECK_EQUAL( "1500", Decimal( 15, 2 ).toString() );
+  CHECK_EQUAL( "0", Decimal().toString() );
+  CHECK_EQUAL( "0.000", Decimal( 0, -3 ).toString() );
+  CHECK_EQUAL( "-9223372036854775808", Decimal( -9223372036854775807LL - 1, 0 ).toString() );
+  CHECK_EQUAL( "1234567887654321", Decimal( 1234567887654321LL, 0 ).toString() );
+
+  const char* values[] = { "31.25", "-100.000", "0.0001", "99999999.99999999", "7" };
+  for ( int i = 0; i < 5; ++i )
+    CHECK_EQUAL( values[ i ], Decimal( values[ i ] ).toString() );
+}
+
+TEST(compare)
+{
+  CHECK( Decimal( "1.5" ) == Decimal( "1.50" ) );
+  CHECK( Decimal( "1.5" ) != Decimal( "1.05" ) );
+  CHECK( Decimal( "1.05" ) < Decimal( "1.5" ) );
+  CHECK( Decimal( "-2" ) < Decimal( "-1.999" ) );
+  CHECK( Decimal( "-1" ) < Decimal( "0" ) );
+  CHECK( Decimal( "0" ) == Decimal( "0.000" ) );
+  CHECK( Decimal( 1, 30 ) > Decimal( 999999999999999999LL, 0 ) );
+  CHECK( Decimal( -1, 30 ) < Decimal( -999999999999999999LL, 0 ) );
+  CHECK( Decimal( "100" ) >= Decimal( 1, 2 ) );
+  CHECK( Decimal( "100" ) <= Decimal( 1, 2 ) );
+}
+
+TEST(toDouble)
+{
+  CHECK_EQUAL( 123.45, Decimal( "123.45" ).toDouble() );
+  CHECK_EQUAL( -0.0012, Decimal( "-0.0012" ).toDouble() );
+  CHECK_EQUAL( 1500.0, Decimal( 15, 2 ).toDouble() );
+}
+
+TEST(priceField)
+{
+  Price price( Decimal( "31.2500" ) );
+  CHECK_EQUAL( "31.2500", price.getString() );
+  CHECK( Decimal( 3125, -2 ) == price.getDecimal() );
+  CHECK_EQUAL( 31.25, price.getValue() );
+
+  price.setValue( 31.5 );
+  CHECK_EQUAL( 315, price.getDecimal().getMantissa() );
+
+  OrderQty qty;
+  qty.setValue( Decimal( 100, 0 ) );
+  CHECK_EQUAL( "100", qty.getString() );
+
+  qty.setString( "abc" );
+  CHECK_THROW( qty.getDecimal(), IncorrectDataFormat );
+}
+
+}
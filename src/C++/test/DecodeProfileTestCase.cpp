@@ -0,0 +1,136 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <DecodeProfile.h>
+#include <Message.h>
+
+using namespace FIX;
+
+SUITE(DecodeProfileTests)
+{
+
+TEST(addField)
+{
+  DecodeProfile object;
+  CHECK( object.empty() );
+  CHECK( !object.getFields( "D" ) );
+
+  object.addField( "D", 11 );
+  object.addField( "D", 55 );
+  CHECK( !object.empty() );
+  CHECK( !object.getFields( "8" ) );
+
+  const DecodeProfile::Fields* pFields = object.getFields( "D" );
+  CHECK( pFields );
+  CHECK( DecodeProfile::contains( *pFields, 11 ) );
+  CHECK( DecodeProfile::contains( *pFields, 55 ) );
+  CHECK( !DecodeProfile::contains( *pFields, 38 ) );
+  CHECK( !DecodeProfile::contains( *pFields, 5000 ) );
+  CHECK( !DecodeProfile::contains( *pFields, -1 ) );
+}
+
+TEST(read)
+{
+  DecodeProfile object;
+  object.read( "8: 11, 37,39 ; D:11;AE:" );
+
+  const DecodeProfile::Fields* pFields = object.getFields( "8" );
+  CHECK( pFields );
+  CHECK( DecodeProfile::contains( *pFields, 11 ) );
+  CHECK( DecodeProfile::contains( *pFields, 37 ) );
+  CHECK( DecodeProfile::contains( *pFields, 39 ) );
+  CHECK( !DecodeProfile::contains( *pFields, 38 ) );
+  CHECK( DecodeProfile::contains( *object.getFields( "D" ), 11 ) );
+  CHECK( object.getFields( "AE" ) );
+  CHECK( !DecodeProfile::contains( *object.getFields( "AE" ), 11 ) );
+
+  CHECK_THROW( DecodeProfile().read( "8" ), ConfigError );
+  CHECK_THROW( DecodeProfile().read( ":11" ), ConfigError );
+  CHECK_THROW( DecodeProfile().read( "8:11,abc" ), ConfigError );
+  CHECK_THROW( DecodeProfile().read( "8:-5" ), ConfigError );
+}
+
+TEST(setString)
+{
+  DataDictionary dataDictionary( "../spec/FIX43.xml" );
+  static const char* str =
+    "8=FIX.4.3\0019=199\00135=E\00134=126\00149=BUYSIDE\00150=00303\00152"
+    "=20040916-16:19:18.328\00156=SELLSIDE\00166=1095350459\00168=2\00173=2\00111"
+    "=1095350459\00167=1\0011=00303\00155=fred\00154=1\00140=1\00159=3\00111=1095"
+    "350460\00167=2\0011=00303\00155=fred\00154=1\00140=1\00159=3\001394=3\00110="
+    "138\001";
+
+  DecodeProfile profile;
+  profile.addField( "E", 66 );
+  Message object;
+  object.setDecodeProfile( &profile );
+
+  // BodyLength and CheckSum still cover the skipped fields and groups
+  object.setString( str, true, &dataDictionary );
+  CHECK( object.hasSkippedFields() );
+  CHECK_EQUAL( "1095350459", object.getField( 66 ) );
+  CHECK( !object.isSetField( 68 ) );
+  CHECK( !object.isSetField( 73 ) );
+  CHECK_EQUAL( 0U, object.groupCount( 73 ) );
+  CHECK_EQUAL( "SELLSIDE", object.getHeader().getField( 56 ) );
+  CHECK_EQUAL( "138", object.getTrailer().getField( 10 ) );
+  dataDictionary.validate( object );
+
+  // skipped fields count as present, missing ones are still found
+  CHECK_EQUAL( 3U, object.getSkippedFields().size() );
+  CHECK_EQUAL( 68, object.getSkippedFields()[ 0 ] );
+  CHECK_EQUAL( 73, object.getSkippedFields()[ 1 ] );
+  CHECK_EQUAL( 394, object.getSkippedFields()[ 2 ] );
+  Message copy( object );
+  CHECK( copy.getDecodeProfile() == 0 );
+  CHECK_EQUAL( 3U, copy.getSkippedFields().size() );
+  copy.removeField( 66 );
+  CHECK_THROW( dataDictionary.validate( copy ), RequiredTagMissing );
+
+  std::string corrupt( str );
+  corrupt[ corrupt.find( "fred" ) ] = 'g';
+  CHECK_THROW( object.setString( corrupt, true, &dataDictionary ), InvalidMessage );
+
+  // naming a group decodes it
+  profile.addField( "E", 73 );
+  object.setString( str, true, &dataDictionary );
+  CHECK( !object.isSetField( 68 ) );
+  CHECK_EQUAL( 2U, object.groupCount( 73 ) );
+  CHECK_EQUAL( "1095350460", object.getGroupRef( 2, 73 ).getField( 11 ) );
+
+  // other message types decode everything
+  static const char* heartbeat =
+    "8=FIX.4.3\0019=60\00135=0\00134=127\00149=BUYSIDE\00152=20040916-16:19:18.328\001"
+    "56=SELLSIDE\00110=177\001";
+  object.setString( heartbeat, true, &dataDictionary );
+  CHECK( !object.hasSkippedFields() );
+  CHECK( object.getSkippedFields().empty() );
+  CHECK_EQUAL( heartbeat, object.toString() );
+}
+
+}
@@ -0,0 +1,398 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <FastCodec.h>
+#include <fix44/MarketDataIncrementalRefresh.h>
+#include <sstream>
+
+using namespace FIX;
+
+SUITE(FastCodecTests)
+{
+
+struct fastCodecFixture
+{
+  fastCodecFixture()
+  : dataDictionary( "../spec/FIX44.xml" ),
+    templates( dataDictionary, "../spec/FAST44.xml" ) {}
+
+  void readTemplate( const std::string& xml )
+  {
+    std::stringstream stream( "<templates>" + xml + "</templates>" );
+    templates.readFromStream( stream );
+  }
+
+  static bool readsTemplate( const DataDictionary& dataDictionary,
+                             const std::string& xml )
+  {
+    FastTemplates templates( dataDictionary );
+    std::stringstream stream( "<templates>" + xml + "</templates>" );
+    try
+    {
+      templates.readFromStream( stream );
+      return true;
+    }
+    catch( ConfigError& ) { return false; }
+  }
+
+  static Message createExecutionReport()
+  {
+    Message message;
+    message.getHeader().setField( BeginString( "FIX.4.4" ) );
+    message.getHeader().setField( MsgType( MsgType_ExecutionReport ) );
+    return message;
+  }
+
+  static FIX44::MarketDataIncrementalRefresh createMarketData( int seqNum )
+  {
+    FIX44::MarketDataIncrementalRefresh message;
+    message.getHeader().setField( SenderCompID( "EXCHANGE" ) );
+    message.getHeader().setField( TargetCompID( "CLIENT" ) );
+    message.getHeader().setField( MsgSeqNum( seqNum ) );
+    message.getHeader().setField( FieldBase( FIELD::SendingTime,
+      "20141017-10:15:" + IntConvertor::convert( 10 + seqNum ) + ".123" ) );
+
+    FIX44::MarketDataIncrementalRefresh::NoMDEntries entry;
+    for( int i = 1; i <= 5; ++i )
+    {
+      entry.clear();
+      entry.set( MDUpdateAction( i == 5 ? MDUpdateAction_DELETE : MDUpdateAction_CHANGE ) );
+      entry.set( MDEntryType( i % 2 ? MDEntryType_BID : MDEntryType_OFFER ) );
+      entry.set( MDEntryID( "ENTRY" + IntConvertor::convert( 1000 + i * seqNum ) ) );
+      entry.set( Symbol( i < 3 ? "IBM" : "MSFT" ) );
+      if( i != 5 )
+      {
+        entry.setField( FieldBase( FIELD::MDEntryPx,
+          IntConvertor::convert( 120 + i ) + "." + IntConvertor::convert( 10 + seqNum ) ) );
+        entry.setField( FieldBase( FIELD::MDEntrySize, IntConvertor::convert( 100 * i ) ) );
+        entry.set( NumberOfOrders( i + seqNum ) );
+      }
+      entry.set( MDEntryPositionNo( i ) );
+      message.addGroup( entry );
+    }
+    return message;
+  }
+
+  DataDictionary dataDictionary;
+  FastTemplates templates;
+};
+
+/// Template used to check exact encodings of each type
+const char STOP_BIT_TEMPLATE[] =
+  "<template name='StopBit' id='9'>"
+  " <string name='MessageType' id='35'><constant value='8'/></string>"
+  " <uInt32 name='MsgSeqNum' id='34'/>"
+  " <int32 name='TotNumReports' id='911'/>"
+  " <decimal name='LastPx' id='31'/>"
+  " <string name='Text' id='58'/>"
+  " <string name='OrderID' id='37' presence='optional'/>"
+  "</template>";
+
+/// Template using each operator on an ExecutionReport
+const char OPERATOR_TEMPLATE[] =
+  "<template name='Operators' id='10'>"
+  " <string name='MessageType' id='35'><constant value='8'/></string>"
+  " <uInt32 name='MsgSeqNum' id='34'><increment/></uInt32>"
+  " <string name='OrderID' id='37'><copy/></string>"
+  " <string name='ClOrdID' id='11' presence='optional'><delta/></string>"
+  " <string name='ExecID' id='17'><delta/></string>"
+  " <string name='ExecType' id='150' presence='optional'><constant value='F'/></string>"
+  " <string name='OrdStatus' id='39'><copy/></string>"
+  " <string name='Side' id='54'><default value='1'/></string>"
+  " <string name='Symbol' id='55'><copy key='Instrument'/></string>"
+  " <decimal name='OrderQty' id='38' presence='optional'><copy/></decimal>"
+  " <decimal name='Price' id='44' presence='optional'><default/></decimal>"
+  " <decimal name='LastPx' id='31' presence='optional'><delta/></decimal>"
+  " <decimal name='CumQty' id='14'><delta/></decimal>"
+  " <decimal name='LeavesQty' id='151'/>"
+  " <decimal name='AvgPx' id='6'><copy value='0'/></decimal>"
+  " <uInt32 name='TradeDate' id='75' presence='optional'><copy/></uInt32>"
+  " <int64 name='TotNumReports' id='911' presence='optional'><delta/></int64>"
+  " <string name='Text' id='58' presence='optional'/>"
+  "</template>";
+
+TEST_FIXTURE(fastCodecFixture, readTemplates)
+{
+  const FastTemplate* pTemplate = templates.getTemplate( 1 );
+  CHECK( pTemplate );
+  CHECK_EQUAL( "X", pTemplate->msgType );
+  CHECK_EQUAL( "MarketDataIncrementalRefresh", pTemplate->name );
+  CHECK( templates.getTemplate( "X" ) == pTemplate );
+  CHECK_EQUAL( 2, templates.getTemplate( "W" )->id );
+  CHECK( !templates.getTemplate( 3 ) );
+  CHECK( !templates.getTemplate( "D" ) );
+
+  const FastInstruction& sequence = pTemplate->instructions.back();
+  CHECK_EQUAL( FastInstruction::SEQUENCE, sequence.type );
+  CHECK_EQUAL( FIELD::NoMDEntries, sequence.tag );
+  CHECK_EQUAL( FIELD::MDUpdateAction, sequence.delim );
+  CHECK( sequence.hasPresenceMap );
+  CHECK_EQUAL( 9U, sequence.instructions.size() );
+}
+
+TEST_FIXTURE(fastCodecFixture, readTemplatesRejectsUnsupported)
+{
+  const std::string msgType =
+    "<string name='MessageType' id='35'><constant value='8'/></string>";
+  std::string xml = "<template name='T' id='5'>" + msgType;
+
+  CHECK( readsTemplate( dataDictionary, xml + "<string name='Text' id='58'/></template>" ) );
+  CHECK( !readsTemplate( dataDictionary, xml + "<byteVector name='Data' id='96'/></template>" ) );
+  CHECK( !readsTemplate( dataDictionary, xml + "<string name='Text' id='58' charset='unicode'/></template>" ) );
+  CHECK( !readsTemplate( dataDictionary, xml + "<string name='Text' id='58'><tail/></string></template>" ) );
+  CHECK( !readsTemplate( dataDictionary, xml + "<string name='X' id='9999'/></template>" ) );
+  CHECK( !readsTemplate( dataDictionary, xml + "<uInt32 name='Symbol' id='55'/></template>" ) );
+  CHECK( !readsTemplate( dataDictionary, xml + "<decimal name='MsgSeqNum' id='34'/></template>" ) );
+  CHECK( !readsTemplate( dataDictionary, xml + "<string name='Text' id='58'><increment/></string></template>" ) );
+  CHECK( !readsTemplate( dataDictionary, xml + "<string name='Text' id='58'><constant/></string></template>" ) );
+  CHECK( !readsTemplate( dataDictionary, xml + "<uInt32 name='MsgSeqNum' id='34'><copy dictionary='template'/></uInt32></template>" ) );
+  CHECK( !readsTemplate( dataDictionary, xml + "<sequence name='S'><length name='NoMDEntries' id='268'/>"
+                                              "<string name='MDEntryType' id='269'/></sequence></template>" ) );
+  CHECK( !readsTemplate( dataDictionary, "<template name='T' id='5'><string name='Text' id='58'/></template>" ) );
+  CHECK( !readsTemplate( dataDictionary, "<template name='T'>" + msgType + "</template>" ) );
+  CHECK( !readsTemplate( dataDictionary, xml + "<uInt32 name='MsgSeqNum' id='34'><copy key='k'/></uInt32>"
+                                              "<string name='Text' id='58'><copy key='k'/></string></template>" ) );
+  CHECK_THROW( readTemplate( "<template name='Again' id='1'>" + msgType + "</template>" ), ConfigError );
+}
+
+TEST_FIXTURE(fastCodecFixture, encodeStopBitFields)
+{
+  readTemplate( STOP_BIT_TEMPLATE );
+
+  Message message = createExecutionReport();
+  message.getHeader().setField( MsgSeqNum( 942755 ) );
+  message.setField( TotNumReports( -942755 ) );
+  message.setField( FieldBase( FIELD::LastPx, "9427.55" ) );
+  message.setField( Text( "ABC" ) );
+
+  FastEncoder encoder( templates );
+  std::string encoded;
+  encoder.encode( 9, message, encoded );
+
+  const unsigned char expected[] =
+  {
+    0xC0, 0x89,               // presence map and template id 9
+    0x39, 0x45, 0xA3,         // 942755
+    0x46, 0x3A, 0xDD,         // -942755
+    0xFE, 0x39, 0x45, 0xA3,   // exponent -2, mantissa 942755
+    0x41, 0x42, 0xC3,         // "ABC"
+    0x80                      // null OrderID
+  };
+  CHECK_EQUAL( std::string( (const char*)expected, sizeof( expected ) ), encoded );
+
+  // the template id is copied from the previous message
+  encoder.encode( 9, message, encoded );
+  CHECK_EQUAL( 2 * sizeof( expected ) - 1, encoded.size() );
+  CHECK_EQUAL( (char)0x80, encoded[ sizeof( expected ) ] );
+
+  FastDecoder decoder( templates );
+  Message decoded;
+  std::size_t size = decoder.decode( encoded, decoded );
+  CHECK_EQUAL( sizeof( expected ), size );
+  CHECK_EQUAL( "FIX.4.4", decoded.getHeader().getField( FIELD::BeginString ) );
+  CHECK_EQUAL( "8", decoded.getHeader().getField( FIELD::MsgType ) );
+  CHECK_EQUAL( "942755", decoded.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( "-942755", decoded.getField( FIELD::TotNumReports ) );
+  CHECK_EQUAL( "9427.55", decoded.getField( FIELD::LastPx ) );
+  CHECK_EQUAL( "ABC", decoded.getField( FIELD::Text ) );
+  CHECK( !decoded.isSetField( FIELD::OrderID ) );
+
+  size += decoder.decode( encoded.data() + size, encoded.data() + encoded.size(), decoded );
+  CHECK_EQUAL( encoded.size(), size );
+  CHECK_EQUAL( message.toString(), decoded.toString() );
+}
+
+TEST_FIXTURE(fastCodecFixture, roundTripOperators)
+{
+  readTemplate( OPERATOR_TEMPLATE );
+
+  Message message = createExecutionReport();
+  message.getHeader().setField( MsgSeqNum( 10 ) );
+  message.setField( OrderID( "ORDER1" ) );
+  message.setField( ClOrdID( "CLORD-0001" ) );
+  message.setField( ExecID( "EXEC-0001" ) );
+  message.setField( ExecType( ExecType_TRADE ) );
+  message.setField( OrdStatus( OrdStatus_PARTIALLY_FILLED ) );
+  message.setField( Side( Side_BUY ) );
+  message.setField( Symbol( "IBM" ) );
+  message.setField( FieldBase( FIELD::OrderQty, "1000" ) );
+  message.setField( FieldBase( FIELD::Price, "120.50" ) );
+  message.setField( FieldBase( FIELD::LastPx, "120.25" ) );
+  message.setField( FieldBase( FIELD::CumQty, "100" ) );
+  message.setField( FieldBase( FIELD::LeavesQty, "900" ) );
+  message.setField( FieldBase( FIELD::AvgPx, "0" ) );
+  message.setField( FieldBase( FIELD::TradeDate, "20141017" ) );
+  message.setField( TotNumReports( 3 ) );
+
+  FastEncoder encoder( templates );
+  FastDecoder decoder( templates );
+  std::vector < std::string > expected;
+  std::string encoded;
+
+  for( int i = 0; i < 6; ++i )
+  {
+    expected.push_back( message.toString() );
+    std::size_t start = encoded.size();
+    encoder.encode( message, encoded );
+    if( i == 2 )
+    {
+      // unchanged fields take no bytes beyond the presence map
+      CHECK( encoded.size() - start < 30 );
+    }
+
+    message.getHeader().setField( MsgSeqNum( 11 + i ) );
+    message.setField( ExecID( "EXEC-000" + IntConvertor::convert( 2 + i ) ) );
+    message.setField( FieldBase( FIELD::CumQty, IntConvertor::convert( 200 + i * 100 ) ) );
+    message.setField( FieldBase( FIELD::LeavesQty, IntConvertor::convert( 800 - i * 100 ) ) );
+    if( i == 2 )
+    {
+      message.removeField( FIELD::ClOrdID );
+      message.removeField( FIELD::ExecType );
+      message.removeField( FIELD::Price );
+      message.removeField( FIELD::TradeDate );
+      message.setField( Side( Side_SELL ) );
+      message.setField( Text( "partial" ) );
+    }
+    if( i == 3 )
+    {
+      message.setField( ClOrdID( "XCLORD-0001" ) );
+      message.setField( TotNumReports( -5 ) );
+      message.setField( FieldBase( FIELD::LastPx, "121" ) );
+      message.setField( Symbol( "MSFT" ) );
+      message.setField( Side( Side_BUY ) );
+      message.removeField( FIELD::Text );
+    }
+  }
+
+  Message decoded;
+  std::size_t pos = 0;
+  for( std::size_t i = 0; i < expected.size(); ++i )
+  {
+    pos += decoder.decode( encoded.data() + pos, encoded.data() + encoded.size(), decoded );
+    CHECK_EQUAL( expected[ i ], decoded.toString() );
+  }
+  CHECK_EQUAL( encoded.size(), pos );
+
+  // a reset on both ends starts the dictionary over
+  encoder.reset();
+  decoder.reset();
+  encoded.clear();
+  encoder.encode( message, encoded );
+  CHECK_EQUAL( encoded.size(), decoder.decode( encoded, decoded ) );
+  CHECK_EQUAL( message.toString(), decoded.toString() );
+}
+
+TEST_FIXTURE(fastCodecFixture, roundTripMarketData)
+{
+  FastEncoder encoder( templates );
+  FastDecoder decoder( templates );
+  Message decoded;
+
+  for( int seqNum = 1; seqNum <= 4; ++seqNum )
+  {
+    FIX44::MarketDataIncrementalRefresh message = createMarketData( seqNum );
+    std::string encoded;
+    encoder.encode( message, encoded );
+    CHECK( encoded.size() * 3 < message.toString().size() );
+
+    CHECK_EQUAL( encoded.size(), decoder.decode( encoded, decoded ) );
+    CHECK_EQUAL( message.toString(), decoded.toString() );
+    CHECK_EQUAL( 5U, decoded.groupCount( FIELD::NoMDEntries ) );
+
+    Message parsed( decoded.toString(), dataDictionary );
+    CHECK_EQUAL( "MSFT", parsed.getGroupRef( 3, FIELD::NoMDEntries ).getField( FIELD::Symbol ) );
+  }
+}
+
+TEST_FIXTURE(fastCodecFixture, encodeRejectsInvalidFields)
+{
+  readTemplate( STOP_BIT_TEMPLATE );
+  FastEncoder encoder( templates );
+  std::string encoded;
+
+  Message message = createExecutionReport();
+  message.getHeader().setField( MsgSeqNum( 1 ) );
+  message.setField( TotNumReports( 1 ) );
+  message.setField( FieldBase( FIELD::LastPx, "1.5" ) );
+  CHECK_THROW( encoder.encode( 9, message, encoded ), FieldNotFound );
+
+  message.setField( Text( "caf\xc3\xa9" ) );
+  CHECK_THROW( encoder.encode( 9, message, encoded ), IncorrectDataFormat );
+
+  message.setField( Text( "ABC" ) );
+  message.setField( FieldBase( FIELD::TotNumReports, "3000000000" ) );
+  CHECK_THROW( encoder.encode( 9, message, encoded ), IncorrectDataFormat );
+
+  message.setField( TotNumReports( 1 ) );
+  message.getHeader().setField( FieldBase( FIELD::MsgSeqNum, "-1" ) );
+  CHECK_THROW( encoder.encode( 9, message, encoded ), IncorrectDataFormat );
+
+  CHECK_THROW( encoder.encode( 99, message, encoded ), IncorrectDataFormat );
+  message.getHeader().setField( MsgType( "D" ) );
+  CHECK_THROW( encoder.encode( message, encoded ), IncorrectDataFormat );
+}
+
+TEST_FIXTURE(fastCodecFixture, decodeRejectsInvalidMessages)
+{
+  FastEncoder encoder( templates );
+  FastDecoder decoder( templates );
+  Message decoded;
+
+  std::string encoded;
+  encoder.encode( createMarketData( 1 ), encoded );
+  for( std::size_t size = 0; size < encoded.size(); ++size )
+  {
+    decoder.reset();
+    CHECK_THROW( decoder.decode( encoded.data(), encoded.data() + size, decoded ), InvalidMessage );
+  }
+
+  // no previous template id
+  decoder.reset();
+  const char noTemplate[] = { (char)0x80 };
+  CHECK_THROW( decoder.decode( noTemplate, noTemplate + 1, decoded ), InvalidMessage );
+
+  const char unknownTemplate[] = { (char)0xC0, (char)0x83 };
+  CHECK_THROW( decoder.decode( unknownTemplate, unknownTemplate + 2, decoded ), InvalidMessage );
+
+  const char longInteger[] = { (char)0xC0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, (char)0x81 };
+  CHECK_THROW( decoder.decode( longInteger, longInteger + sizeof( longInteger ), decoded ), InvalidMessage );
+
+  // elements that take no bytes are only allowed up to a fixed count
+  readTemplate( "<template name='Empty' id='12'>"
+                " <string name='MessageType' id='35'><constant value='W'/></string>"
+                " <sequence name='MDEntries'><length name='NoMDEntries' id='268'/>"
+                "  <string name='MDEntryType' id='269'><constant value='0'/></string>"
+                " </sequence></template>" );
+  const char fewEmpty[] = { (char)0xC0, (char)0x8C, (char)0x83 };
+  decoder.decode( fewEmpty, fewEmpty + sizeof( fewEmpty ), decoded );
+  CHECK_EQUAL( 3U, decoded.groupCount( FIELD::NoMDEntries ) );
+  const char manyEmpty[] = { (char)0xC0, (char)0x8C, 0x04, 0x22, (char)0xF0 };
+  CHECK_THROW( decoder.decode( manyEmpty, manyEmpty + sizeof( manyEmpty ), decoded ), InvalidMessage );
+}
+
+}
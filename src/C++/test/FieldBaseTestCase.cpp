@@ -49,6 +49,52 @@ TEST(set)
   CHECK_EQUAL( 9lu, object.getLength() );
 }
 
+TEST(appendTo)
+{
+  std::string result( "8=FIX.4.2\001" );
+  FieldBase( 55, "MSFT" ).appendTo( result );
+  FieldBase( 58, "" ).appendTo( result );
+  CHECK_EQUAL( "8=FIX.4.2\00155=MSFT\00158=\001", result );
+
+  FieldBase empty( 58, "" );
+  CHECK_EQUAL( 4lu, empty.getLength() );
+  CHECK_EQUAL( '5' + '8' + '=' + 1, empty.getTotal() );
+}
+
+TEST(appendToTagsOutsidePrefixTable)
+{
+  // tags past the pre-rendered range and negative tags render on demand
+  CHECK_EQUAL( "9999=A\001", FieldBase( FIELD::UserMax, "A" ).getFixString() );
+  CHECK_EQUAL( "10000=A\001", FieldBase( FIELD::UserMax + 1, "A" ).getFixString() );
+  CHECK_EQUAL( "123456=A\001", FieldBase( 123456, "A" ).getFixString() );
+  CHECK_EQUAL( "-1=A\001", FieldBase( -1, "A" ).getFixString() );
+
+  FieldBase internal( 10000, "A" );
+  CHECK_EQUAL( 8lu, internal.getLength() );
+  CHECK_EQUAL( '1' + '0' * 4 + '=' + 'A' + 1, internal.getTotal() );
+
+  FieldBase negative( -1, "A" );
+  CHECK_EQUAL( 5lu, negative.getLength() );
+  CHECK_EQUAL( '-' + '1' + '=' + 'A' + 1, negative.getTotal() );
+}
+
+TEST(tagPrefix)
+{
+  char buffer[ TagPrefix::MAX_LENGTH ];
+  for ( int tag = 0; tag <= TagPrefix::MAX_TAG + 10; ++tag )
+  {
+    std::string expected = IntConvertor::convert( tag ) + "=";
+    std::size_t length = TagPrefix::write( buffer, tag );
+    CHECK_EQUAL( expected, std::string( buffer, length ) );
+    CHECK_EQUAL( expected.length(), TagPrefix::length( tag ) );
+
+    int total = 0;
+    for ( std::size_t i = 0; i < expected.length(); ++i )
+      total += expected[ i ];
+    CHECK_EQUAL( total, TagPrefix::total( tag ) );
+  }
+}
+
 TEST(CharField_getValue_FieldConvertError){
   CharField charField(1);
   CHECK_THROW(charField.getValue(), IncorrectDataFormat);
@@ -355,6 +355,47 @@ TEST(utcTimeStampConvertFromNano)
   CHECK_EQUAL( 26, result2.getDate() );
 }
 
+TEST(utcTimeStampConvertFromInvalid)
+{
+  const char* invalid[] =
+  {
+    "", "20000426-12:05:0", "20000426-12:05:06.5555555555", "20000426 12:05:06",
+    "20000426-12-05:06", "20000426-12:05-06", "2000042a-12:05:06", "20000426-1x:05:06",
+    "20000426-12:05:0/", "20001326-12:05:06", "20000400-12:05:06", "20000432-12:05:06",
+    "20000426-24:05:06", "20000426-12:60:06", "20000426-12:05:61", "20000426-12:05:06,5",
+    "20000426-12:05:06.5x"
+  };
+  for( size_t i = 0; i < sizeof( invalid ) / sizeof( invalid[ 0 ] ); ++i )
+    CHECK_THROW( UtcTimeStampConvertor::convert( std::string( invalid[ i ] ) ), FieldConvertError );
+
+  // a trailing point with no digits has always been accepted
+  UtcTimeStamp result = UtcTimeStampConvertor::convert( std::string( "20000426-12:05:60." ) );
+  CHECK_EQUAL( 0, result.getFraction( 9 ) );
+}
+
+TEST(utcTimeStampCache)
+{
+  UtcTimeStampCache cache;
+  UtcTimeStamp input( 12, 5, 6, 555555555, 26, 4, 2000, 9 );
+  CHECK_EQUAL( "20000426-12:05:06.555", cache.convert( input, 3 ) );
+
+  // same second, only the fraction changes
+  input.setNanosecond( 1 );
+  CHECK_EQUAL( "20000426-12:05:06.000000001", cache.convert( input, 9 ) );
+  CHECK_EQUAL( "20000426-12:05:06", cache.convert( input ) );
+
+  input.setSecond( 7 );
+  CHECK_EQUAL( "20000426-12:05:07.000000", cache.convert( input, 6 ) );
+
+  // same time of day on another date
+  UtcTimeStamp other( 12, 5, 7, 0, 27, 4, 2000 );
+  CHECK_EQUAL( "20000427-12:05:07", cache.convert( other ) );
+
+  char buffer[ UtcTimeStampConvertor::MAX_LENGTH ];
+  CHECK_EQUAL( UtcTimeStampConvertor::convert( input, 9 ),
+               std::string( buffer, cache.format( buffer, input, 9 ) ) );
+}
+
 TEST(utcTimeOnlyConvertToSecond)
 {
   UtcTimeOnly input;
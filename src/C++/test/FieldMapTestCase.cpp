@@ -154,7 +154,84 @@ TEST(setField_16FieldsAlreadyExist_fieldSet)
     CHECK_EQUAL("field18_new", actualTag18.getString());
 }
 
+TEST(directIndex_insertAndRemove)
+{
+  FieldMap fieldMap;
+  for( int tag = 40; tag > 0; tag -= 2 )
+    fieldMap.setField(tag, "even");
+  fieldMap.setField(2000, "large");
+  fieldMap.setField(1, "odd");
+  fieldMap.setField(21, "odd");
+
+  for( int tag = 2; tag <= 40; tag += 2 )
+    CHECK_EQUAL("even", fieldMap.getField(tag));
+  CHECK_EQUAL("odd", fieldMap.getField(1));
+  CHECK_EQUAL("odd", fieldMap.getField(21));
+  CHECK_EQUAL("large", fieldMap.getField(2000));
+  CHECK(!fieldMap.isSetField(3));
+  CHECK(!fieldMap.isSetField(1023));
+
+  fieldMap.removeField(1);
+  fieldMap.removeField(22);
+  CHECK(!fieldMap.isSetField(1));
+  CHECK(!fieldMap.isSetField(22));
+  CHECK_EQUAL("odd", fieldMap.getField(21));
+  CHECK_EQUAL("even", fieldMap.getField(40));
+
+  FieldMap copy(fieldMap);
+  CHECK_EQUAL("even", copy.getField(2));
+  CHECK_EQUAL("large", copy.getField(2000));
+
+  fieldMap.clear();
+  CHECK(!fieldMap.isSetField(2));
+  fieldMap.setField(2, "again");
+  CHECK_EQUAL("again", fieldMap.getField(2));
+}
+
+TEST(directIndex_repeatedTag)
+{
+  FieldMap fieldMap;
+  for( int tag = 1; tag <= 20; ++tag )
+    fieldMap.setField(tag, "first");
+  fieldMap.setField(FieldBase(10, "second"), false);
+
+  CHECK_EQUAL("first", fieldMap.getField(10));
+  fieldMap.removeField(10);
+  CHECK_EQUAL("second", fieldMap.getField(10));
+  fieldMap.removeField(10);
+  CHECK(!fieldMap.isSetField(10));
+  CHECK_EQUAL("first", fieldMap.getField(11));
 }
 
+TEST(groupArena)
+{
+  GroupArena arena;
+  std::vector<FieldMap*> groups;
+  {
+    FieldMap fieldMap;
+    for( int i = 0; i < 40; ++i )
+    {
+      FieldMap* group = arena.allocate( message_order( 1, 2, 0 ) );
+      group->setField( 2, "value" );
+      group->setField( 1, "first" );
+      fieldMap.addGroupPtr( 100, group );
+      groups.push_back( group );
+    }
+    CHECK_EQUAL( 40U, arena.size() );
+    CHECK_EQUAL( 40U, fieldMap.groupCount( 100 ) );
+    CHECK_EQUAL( 1, fieldMap.getGroupRef( 40, 100 ).begin()->getTag() );
+
+    // removing or clearing leaves the groups to the arena
+    fieldMap.removeGroup( 1, 100 );
+    CHECK_EQUAL( "value", groups[ 0 ]->getField( 2 ) );
+    fieldMap.clear();
+    CHECK_EQUAL( "value", groups[ 39 ]->getField( 2 ) );
+  }
 
+  arena.reset();
+  CHECK_EQUAL( 0U, arena.size() );
+  CHECK( !groups[ 0 ]->isSetField( 2 ) );
+  CHECK( arena.allocate( message_order( message_order::normal ) ) == groups[ 0 ] );
+}
 
+}
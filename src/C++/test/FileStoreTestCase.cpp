@@ -100,6 +100,11 @@ TEST_FIXTURE(resetBeforeAndAfterFileStoreFixture, setGet)
   CHECK_MESSAGE_STORE_SET_GET;
 }
 
+TEST_FIXTURE(resetBeforeAndAfterFileStoreFixture, setBatch)
+{
+  CHECK_MESSAGE_STORE_SET_BATCH;
+}
+
 TEST_FIXTURE(resetBeforeAndAfterFileStoreFixture, setGetWithQuote)
 {
   CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
@@ -0,0 +1,128 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <HeaderPeek.h>
+#include <Message.h>
+#include "TestHelper.h"
+
+using namespace FIX;
+
+SUITE(HeaderPeekTests)
+{
+
+TEST(peekHeaderFields)
+{
+  std::string string =
+    "8=FIXT.1.1\0019=112\00135=D\00134=12\00143=Y\00149=TW\00150=DESK\001"
+    "52=20000426-12:05:06\00156=ISLD\00157=ALGO\0011128=9\001"
+    "11=ID\00121=1\00149=BODY\00110=000\001";
+  HeaderPeek object( string );
+
+  CHECK( object.isValid() );
+  CHECK_EQUAL( "FIXT.1.1", object.getField( FIELD::BeginString ) );
+  CHECK_EQUAL( "112", object.getField( FIELD::BodyLength ) );
+  CHECK_EQUAL( "D", object.getField( FIELD::MsgType ) );
+  CHECK_EQUAL( "TW", object.getField( FIELD::SenderCompID ) );
+  CHECK_EQUAL( "ISLD", object.getField( FIELD::TargetCompID ) );
+  CHECK_EQUAL( "DESK", object.getField( FIELD::SenderSubID ) );
+  CHECK_EQUAL( "ALGO", object.getField( FIELD::TargetSubID ) );
+  CHECK_EQUAL( MsgTypeId_NewOrderSingle, object.getMsgTypeId() );
+  CHECK_EQUAL( 12, object.getMsgSeqNum() );
+  CHECK( object.isPossDup() );
+
+  ApplVerID applVerID;
+  CHECK( object.getFieldIfSet( applVerID ) );
+  CHECK_EQUAL( ApplVerID_FIX50SP2, applVerID.getString() );
+
+  const char* value = 0;
+  std::size_t length = 0;
+  CHECK( object.getValue( FIELD::SenderCompID, value, length ) );
+  CHECK_EQUAL( string.data() + string.find( "TW" ), value );
+  CHECK_EQUAL( 2U, length );
+
+  CHECK( !object.isSetField( FIELD::SendingTime ) );
+  CHECK( !object.isSetField( FIELD::ClOrdID ) );
+  CHECK_THROW( object.getField( FIELD::ClOrdID ), FieldNotFound );
+}
+
+TEST(peekStopsAtBody)
+{
+  HeaderPeek object( "8=FIX.4.2\0019=12\00135=0\00134=2\00110=000\00149=TW\001" );
+
+  CHECK( object.isValid() );
+  CHECK_EQUAL( 2, object.getMsgSeqNum() );
+  CHECK( !object.isPossDup() );
+  CHECK( !object.isSetField( FIELD::SenderCompID ) );
+  CHECK( !object.isSetField( FIELD::ApplVerID ) );
+}
+
+TEST(peekSkipsHeaderDataFields)
+{
+  HeaderPeek object( "8=FIX.4.2\0019=12\00135=A\00190=5\00191=A\001B=C\00149=TW\001"
+                     "56=ISLD\00110=000\001" );
+
+  CHECK( object.isValid() );
+  CHECK_EQUAL( "TW", object.getField( FIELD::SenderCompID ) );
+  CHECK_EQUAL( "ISLD", object.getField( FIELD::TargetCompID ) );
+}
+
+TEST(peekInvalidHeader)
+{
+  HeaderPeek object;
+  CHECK( !object.isValid() );
+  CHECK( !object.peek( "" ) );
+  CHECK( !object.peek( "9=12\0018=FIX.4.2\00135=A\001" ) );
+  CHECK( !object.peek( "8=FIX.4.2\0019=12\001" ) );
+  CHECK( !object.peek( "8=FIX.4.2\0019=12\00135=A" ) );
+  CHECK( !object.peek( "8=FIX.4.2\0019=12\001X5=A\001" ) );
+  CHECK_EQUAL( 0, object.getMsgTypeId() );
+  CHECK_EQUAL( 0, object.getMsgSeqNum() );
+  CHECK( !object.isPossDup() );
+
+  CHECK( object.peek( "8=FIX.4.2\0019=12\00135=A\00134=X\001" ) );
+  CHECK_EQUAL( 0, object.getMsgSeqNum() );
+}
+
+#ifdef HAVE_RVALUE_REFERENCES
+TEST(peekDoesNotAllocate)
+{
+  std::string string =
+    "8=FIX.4.4\0019=112\00135=8\00134=12\00149=TW\00156=ISLD\001"
+    "52=20000426-12:05:06\00137=ID\00110=000\001";
+
+  AllocationCounter counter;
+  HeaderPeek object( string );
+  const int msgTypeId = object.getMsgTypeId();
+  const int msgSeqNum = object.getMsgSeqNum();
+  CHECK_EQUAL( 0U, counter.count() );
+
+  CHECK_EQUAL( MsgTypeId_ExecutionReport, msgTypeId );
+  CHECK_EQUAL( 12, msgSeqNum );
+}
+#endif
+
+}
@@ -0,0 +1,139 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <HeaderTemplate.h>
+#include "fix42/NewOrderSingle.h"
+#include "fix42/Heartbeat.h"
+
+using namespace FIX;
+
+SUITE(HeaderTemplateTests)
+{
+
+struct headerTemplateFixture
+{
+  headerTemplateFixture()
+  : sessionID( BeginString( "FIX.4.2" ), SenderCompID( "SENDER" ), TargetCompID( "TARGET" ) ),
+    sendingTime( "20161017-12:30:15.250" ),
+    seqNum( 0 ),
+    object( sessionID )
+  {}
+
+  // what Session::fill leaves on a message that has no identity fields
+  void fill( FIX::Message& message, int msgSeqNum )
+  {
+    seqNum = msgSeqNum;
+    Header& header = message.getHeader();
+    header.setField( MsgSeqNum( seqNum ) );
+    header.setField( FieldBase( FIELD::SendingTime, sendingTime ) );
+  }
+
+  bool serialize( const FIX::Message& message, std::string& result )
+  {
+    return object.serialize( message, seqNum, sendingTime.data(), sendingTime.size(), result );
+  }
+
+  std::string toString( const FIX::Message& message )
+  {
+    FIX::Message copy( message );
+    copy.getHeader().setField( sessionID.getBeginString() );
+    copy.getHeader().setField( sessionID.getSenderCompID() );
+    copy.getHeader().setField( sessionID.getTargetCompID() );
+    return copy.toString();
+  }
+
+  SessionID sessionID;
+  std::string sendingTime;
+  int seqNum;
+  HeaderTemplate object;
+};
+
+TEST_FIXTURE(headerTemplateFixture, serializeMatchesToString)
+{
+  FIX42::NewOrderSingle message( ClOrdID( "ORDERID" ), HandlInst( '1' ), Symbol( "LNUX" ),
+                                 Side( Side_BUY ), TransactTime(), OrdType( OrdType_MARKET ) );
+  fill( message, 1 );
+
+  std::string expected = toString( message );
+  std::string result;
+  CHECK( serialize( message, result ) );
+  CHECK_EQUAL( expected, result );
+  CHECK( !message.getHeader().isSetField( FIELD::SenderCompID ) );
+
+  FIX::Message parsed( result );
+  CHECK_EQUAL( parsed.getHeader().getField( FIELD::BodyLength ),
+               message.getHeader().getField( FIELD::BodyLength ) );
+  CHECK_EQUAL( parsed.getTrailer().getField( FIELD::CheckSum ),
+               message.getTrailer().getField( FIELD::CheckSum ) );
+
+  // a stale BodyLength of the wrong width is patched the same way
+  message.getHeader().setField( BodyLength( 7 ) );
+  fill( message, 1000000 );
+  expected = toString( message );
+  CHECK( serialize( message, result ) );
+  CHECK_EQUAL( expected, result );
+
+  // identity fields are allowed when they match the session
+  message.getHeader().setField( sessionID.getSenderCompID() );
+  CHECK( serialize( message, result ) );
+  CHECK_EQUAL( expected, result );
+}
+
+TEST_FIXTURE(headerTemplateFixture, serializeRejectsChangedHeaders)
+{
+  FIX42::Heartbeat message;
+  std::string result;
+
+  CHECK( !serialize( message, result ) );
+
+  fill( message, 2 );
+  CHECK( serialize( message, result ) );
+
+  message.getHeader().setField( PossDupFlag( true ) );
+  CHECK( !serialize( message, result ) );
+  message.getHeader().removeField( FIELD::PossDupFlag );
+
+  message.getHeader().setField( OnBehalfOfCompID( "CLIENT" ) );
+  CHECK( !serialize( message, result ) );
+  message.getHeader().removeField( FIELD::OnBehalfOfCompID );
+
+  message.getHeader().setField( SenderCompID( "OTHER" ) );
+  CHECK( !serialize( message, result ) );
+  message.getHeader().removeField( FIELD::SenderCompID );
+
+  message.getHeader().setField( MsgSeqNum( 3 ) );
+  CHECK( !serialize( message, result ) );
+  message.getHeader().setField( MsgSeqNum( 2 ) );
+
+  message.getHeader().setField( FieldBase( FIELD::SendingTime, "20161017-12:30:16.000" ) );
+  CHECK( !serialize( message, result ) );
+
+  message.getHeader().removeField( FIELD::SendingTime );
+  CHECK( !serialize( message, result ) );
+}
+
+}
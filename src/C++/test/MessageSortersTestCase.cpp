@@ -152,4 +152,31 @@ TEST(groupOrder)
   CHECK( sorter(49, 51) );
 }
 
+TEST(staticGroupOrder)
+{
+  int order[6] = { 50, 12, 100, 11, 49, 0 };
+  static const message_order::field_position table[5] =
+    { {11,4}, {12,2}, {49,5}, {50,1}, {100,3} };
+  message_order sorter( order );
+  message_order staticSorter( table, 5 );
+
+  int large[13] = { 60, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 1, 0 };
+  static const message_order::field_position largeTable[12] =
+    { {1,12}, {2,2}, {4,3}, {6,4}, {8,5}, {10,6},
+      {12,7}, {14,8}, {16,9}, {18,10}, {20,11}, {60,1} };
+  message_order largeSorter( large );
+  message_order staticLargeSorter( largeTable, 12 );
+  message_order copy( staticLargeSorter );
+
+  for( int x = 0; x <= 110; ++x )
+  {
+    for( int y = 0; y <= 110; ++y )
+    {
+      CHECK_EQUAL( sorter(x, y), staticSorter(x, y) );
+      CHECK_EQUAL( largeSorter(x, y), staticLargeSorter(x, y) );
+      CHECK_EQUAL( largeSorter(x, y), copy(x, y) );
+    }
+  }
+}
+
 }
@@ -52,6 +52,24 @@
   CHECK_EQUAL( heartbeat.toString(), messages[ 0 ] );       \
   CHECK_EQUAL( newOrderSingle.toString(), messages[ 1 ] );
 
+#define CHECK_MESSAGE_STORE_SET_BATCH                       \
+  object->set( 1, "first" );                                \
+                                                            \
+  std::vector < std::string > batch;                        \
+  batch.push_back( "second" );                              \
+  batch.push_back( "third" );                               \
+  batch.push_back( "fourth" );                              \
+  CHECK( object->setBatch( 2, batch ) );                    \
+  batch.clear();                                            \
+  CHECK( object->setBatch( 5, batch ) );                    \
+                                                            \
+  std::vector < std::string > messages;                     \
+  object->get( 1, 5, messages );                            \
+  CHECK_EQUAL( 4U, messages.size() );                       \
+  CHECK_EQUAL( "first", messages[ 0 ] );                    \
+  CHECK_EQUAL( "second", messages[ 1 ] );                   \
+  CHECK_EQUAL( "fourth", messages[ 3 ] );
+
 #define CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE        \
   FIX42::ExecutionReport singleQuote;                 \
   singleQuote.setField( Text("Some Text") );          \
@@ -0,0 +1,175 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <MessageView.h>
+#include <DataDictionary.h>
+#include <Values.h>
+
+using namespace FIX;
+
+SUITE(MessageViewTests)
+{
+
+struct messageViewFixture
+{
+  messageViewFixture()
+  : dataDictionary( "../spec/FIX42.xml" )
+  {
+    order = "8=FIX.4.2\0019=95\00135=D\00134=3\00149=TW\00152=20000426-12:05:06\00156=ISLD\001"
+            "11=ID\00121=1\00140=1\00154=1\00155=INTC\00160=20000426-12:05:06\00110=116\001";
+  }
+
+  DataDictionary dataDictionary;
+  std::string order;
+};
+
+TEST_FIXTURE(messageViewFixture, getField)
+{
+  MessageView object( order, &dataDictionary, &dataDictionary );
+
+  CHECK_EQUAL( 7U, object.getHeader().totalFields() );
+  CHECK_EQUAL( 6U, object.totalFields() );
+  CHECK_EQUAL( 1U, object.getTrailer().totalFields() );
+
+  MsgType msgType;
+  object.getHeader().getField( msgType );
+  CHECK_EQUAL( "D", msgType.getString() );
+  CHECK_EQUAL( "TW", object.getHeader().getField( FIELD::SenderCompID ) );
+
+  ClOrdID clOrdID;
+  CHECK( object.getFieldIfSet( clOrdID ) );
+  CHECK_EQUAL( "ID", clOrdID.getValue() );
+
+  Symbol symbol;
+  CHECK_EQUAL( "INTC", object.getField( symbol ).getString() );
+
+  Price price;
+  CHECK( !object.isSetField( price ) );
+  CHECK( !object.getFieldIfSet( price ) );
+  CHECK_THROW( object.getField( price ), FieldNotFound );
+  CHECK_THROW( object.getField( FIELD::Price ), FieldNotFound );
+
+  CHECK( object.isApp() );
+  CHECK( !object.isAdmin() );
+  CHECK_EQUAL( MsgTypeId_NewOrderSingle, object.getMsgTypeId() );
+}
+
+TEST_FIXTURE(messageViewFixture, getValue)
+{
+  MessageView object( order );
+
+  const char* value = 0;
+  std::size_t length = 0;
+  CHECK( object.getValue( FIELD::Symbol, value, length ) );
+  CHECK_EQUAL( order.data() + order.find( "INTC" ), value );
+  CHECK_EQUAL( 4U, length );
+  CHECK( !object.getValue( FIELD::Price, value, length ) );
+}
+
+TEST_FIXTURE(messageViewFixture, findFirstOfRepeatedTag)
+{
+  // group members repeat; lookups return their first occurrence
+  std::string raw = "8=FIX.4.2\0019=40\00135=V\001146=2\00155=INTC\00155=MSFT\001"
+                    "262=REQ\00110=000\001";
+  MessageView object( raw );
+
+  CHECK_EQUAL( "INTC", object.getField( FIELD::Symbol ) );
+  CHECK_EQUAL( "REQ", object.getField( FIELD::MDReqID ) );
+  CHECK_EQUAL( "2", object.getField( FIELD::NoRelatedSym ) );
+  CHECK( !object.isSetField( FIELD::SecurityID ) );
+
+  // the index is rebuilt when the view is reused
+  object.setString( order );
+  CHECK_EQUAL( "INTC", object.getField( FIELD::Symbol ) );
+  CHECK( !object.isSetField( FIELD::MDReqID ) );
+  CHECK_EQUAL( "ISLD", object.getHeader().getField( FIELD::TargetCompID ) );
+}
+
+TEST_FIXTURE(messageViewFixture, validate)
+{
+  MessageView object( order );
+  CHECK_EQUAL( 95, object.bodyLength() );
+  CHECK_EQUAL( 116, object.checkSum() );
+  object.validate();
+
+  std::string badCheckSum = order;
+  badCheckSum.replace( badCheckSum.find( "10=116" ), 6, "10=117" );
+  object.setString( badCheckSum );
+  CHECK_THROW( object.validate(), InvalidMessage );
+
+  std::string badLength = order;
+  badLength.replace( badLength.find( "9=95" ), 4, "9=94" );
+  object.setString( badLength );
+  CHECK_THROW( object.validate(), InvalidMessage );
+
+  std::string outOfOrder = "9=95\0018=FIX.4.2\00135=D\00110=000\001";
+  object.setString( outOfOrder );
+  CHECK_THROW( object.validate(), InvalidMessage );
+}
+
+TEST_FIXTURE(messageViewFixture, dataField)
+{
+  std::string raw = "8=FIX.4.2\0019=26\00135=D\00195=5\00196=a\001b=c\00155=INTC\00110=000\001";
+  MessageView object( raw, &dataDictionary, &dataDictionary );
+
+  CHECK_EQUAL( "a\001b=c", object.getField( FIELD::RawData ) );
+  CHECK_EQUAL( "INTC", object.getField( FIELD::Symbol ) );
+
+  std::string noLength = "8=FIX.4.2\0019=26\00135=D\00196=a\001b=c\00110=000\001";
+  CHECK_THROW( MessageView( noLength, &dataDictionary, &dataDictionary ), InvalidMessage );
+}
+
+TEST_FIXTURE(messageViewFixture, hasValidStructure)
+{
+  std::string raw = "8=FIX.4.2\0019=26\00135=D\00155=INTC\00110=000\00149=TW\001";
+  MessageView object( raw, &dataDictionary, &dataDictionary );
+
+  int tag = 0;
+  CHECK( !object.hasValidStructure( tag ) );
+  CHECK_EQUAL( FIELD::SenderCompID, tag );
+
+  object.setString( order, &dataDictionary, &dataDictionary );
+  CHECK( object.hasValidStructure( tag ) );
+}
+
+TEST_FIXTURE(messageViewFixture, toMessage)
+{
+  MessageView object( order, &dataDictionary, &dataDictionary );
+  FIX::Message message;
+  object.toMessage( message, true );
+  CHECK_EQUAL( order, message.toString() );
+  CHECK_EQUAL( order, object.toString() );
+}
+
+TEST_FIXTURE(messageViewFixture, invalidMessage)
+{
+  CHECK_THROW( MessageView( "8=FIX.4.2\0019=26\00135" ), InvalidMessage );
+  CHECK_THROW( MessageView( "8=FIX.4.2\0019=26\00135=D" ), InvalidMessage );
+  CHECK_THROW( MessageView( "8=FIX.4.2\0019=26\001A5=D\001" ), InvalidMessage );
+}
+
+}
@@ -27,6 +27,7 @@
 #include <UnitTest++.h>
 #include <Values.h>
 #include <Utility.h>
+#include <set>
 #include <fix44/MarketDataRequest.h>
 #include <fix42/News.h>
 #include <fix42/NewOrderList.h>
@@ -46,6 +47,7 @@
 #include <fix42/MassQuote.h>
 #include <fix44/NewOrderCross.h>
 #include <fix44/AllocationInstruction.h>
+#include "TestHelper.h"
 
 using namespace FIX;
 using namespace FIX42;
@@ -211,6 +213,161 @@ TEST(setStringWithGroup)
   CHECK_EQUAL( str, object.toString() );
 }
 
+TEST(setStringReusesGroups)
+{
+  FIX::Message object;
+  DataDictionary dataDictionary( "../spec/FIX43.xml" );
+  static const char* str =
+    "8=FIX.4.3\0019=199\00135=E\00134=126\00149=BUYSIDE\00150=00303\00152"
+    "=20040916-16:19:18.328\00156=SELLSIDE\00166=1095350459\00168=2\00173=2\00111"
+    "=1095350459\00167=1\0011=00303\00155=fred\00154=1\00140=1\00159=3\00111=1095"
+    "350460\00167=2\0011=00303\00155=fred\00154=1\00140=1\00159=3\001394=3\00110="
+    "138\001";
+  static const char* heartbeat =
+    "8=FIX.4.3\0019=60\00135=0\00134=127\00149=BUYSIDE\00152=20040916-16:19:18.328\001"
+    "56=SELLSIDE\00110=177\001";
+
+  object.setString( str, true, &dataDictionary );
+  FieldMap* first = object.getGroupPtr( 1, FIELD::NoOrders );
+  FieldMap* second = object.getGroupPtr( 2, FIELD::NoOrders );
+
+  object.setString( heartbeat, true, &dataDictionary );
+  CHECK_THROW( object.getGroupPtr( 1, FIELD::NoOrders ), FieldNotFound );
+  CHECK_EQUAL( heartbeat, object.toString() );
+
+  // the cleared groups are decoded into again
+  object.setString( str, true, &dataDictionary );
+  CHECK_EQUAL( str, object.toString() );
+  CHECK( object.getGroupPtr( 1, FIELD::NoOrders ) == first );
+  CHECK( object.getGroupPtr( 2, FIELD::NoOrders ) == second );
+
+  // groups stay valid in copies of the message
+  FIX::Message copy( object );
+  object.clear();
+  CHECK_EQUAL( str, copy.toString() );
+}
+
+TEST(setStringWithLazyGroups)
+{
+  FIX::Message object;
+  object.setLazyGroups( true );
+  DataDictionary dataDictionary( "../spec/FIX43.xml" );
+  static const char* str =
+    "8=FIX.4.3\0019=199\00135=E\00134=126\00149=BUYSIDE\00150=00303\00152"
+    "=20040916-16:19:18.328\00156=SELLSIDE\00166=1095350459\00168=2\00173=2\00111"
+    "=1095350459\00167=1\0011=00303\00155=fred\00154=1\00140=1\00159=3\00111=1095"
+    "350460\00167=2\0011=00303\00155=fred\00154=1\00140=1\00159=3\001394=3\00110="
+    "138\001";
+
+  object.setString( str, true, &dataDictionary );
+  CHECK( object.hasDeferredGroups() );
+  CHECK_EQUAL( 2U, object.groupCount( FIELD::NoOrders ) );
+  CHECK( object.FieldMap::hasGroup( FIELD::NoOrders ) );
+  CHECK( object.isSetField( FIELD::BidType ) );
+  CHECK_EQUAL( str, object.toString() );
+  dataDictionary.validate( object );
+  CHECK( object.hasDeferredGroups() );
+
+  // the groups are built on first access
+  FieldMap& second = object.getGroupRef( 2, FIELD::NoOrders );
+  CHECK( !object.hasDeferredGroups() );
+  CHECK_EQUAL( "1095350460", second.getField( FIELD::ClOrdID ) );
+  CHECK_EQUAL( str, object.toString() );
+
+  // copies keep the groups deferred without decoding the original,
+  // and do not depend on it
+  object.setString( str, true, &dataDictionary );
+  const FIX::Message& source = object;
+  FIX::Message copy( source );
+  FieldMap body( source );
+  CHECK( object.hasDeferredGroups() );
+  CHECK( copy.hasDeferredGroups() );
+  CHECK( !body.hasDeferredGroups() );
+  object.clear();
+  CHECK_EQUAL( "1095350460", body.getGroupRef( 2, FIELD::NoOrders ).getField( FIELD::ClOrdID ) );
+  CHECK_EQUAL( "1095350459", copy.getGroupRef( 1, FIELD::NoOrders ).getField( FIELD::ClOrdID ) );
+  CHECK_EQUAL( str, copy.toString() );
+}
+
+#ifdef HAVE_RVALUE_REFERENCES
+TEST(moveMessageWithGroups)
+{
+  DataDictionary dataDictionary( "../spec/FIX43.xml" );
+  static const char* str =
+    "8=FIX.4.3\0019=199\00135=E\00134=126\00149=BUYSIDE\00150=00303\00152"
+    "=20040916-16:19:18.328\00156=SELLSIDE\00166=1095350459\00168=2\00173=2\00111"
+    "=1095350459\00167=1\0011=00303\00155=fred\00154=1\00140=1\00159=3\00111=1095"
+    "350460\00167=2\0011=00303\00155=fred\00154=1\00140=1\00159=3\001394=3\00110="
+    "138\001";
+
+  // groups decoded into the arena move along with it
+  FIX::Message object;
+  object.setString( str, true, &dataDictionary );
+  FieldMap* second = object.getGroupPtr( 2, FIELD::NoOrders );
+  FIX::Message moved( std::move( object ) );
+  CHECK( object.isEmpty() );
+  CHECK( moved.getGroupPtr( 2, FIELD::NoOrders ) == second );
+  object.setString( str, true, &dataDictionary );
+  CHECK_EQUAL( str, moved.toString() );
+
+  // deferred groups are decoded by the message they moved to
+  FIX::Message lazy;
+  lazy.setLazyGroups( true );
+  lazy.setString( str, true, &dataDictionary );
+  FIX::Message assigned;
+  assigned = std::move( lazy );
+  lazy.setString( "8=FIX.4.3\0019=5\00135=0\00110=162\001", true, &dataDictionary );
+  CHECK( assigned.hasDeferredGroups() );
+  CHECK_EQUAL( "1095350460",
+    assigned.getGroupRef( 2, FIELD::NoOrders ).getField( FIELD::ClOrdID ) );
+  CHECK_EQUAL( str, assigned.toString() );
+
+  // groups of a standalone map leave the arena they came from
+  FieldMap group( std::move( moved.getGroupRef( 1, FIELD::NoOrders ) ) );
+  moved.clear();
+  CHECK_EQUAL( "1095350459", group.getField( FIELD::ClOrdID ) );
+}
+#endif
+
+TEST(setStringWithLazyNestedAndDataGroups)
+{
+  DataDictionary dataDictionary( "../spec/FIX42.xml" );
+  MassQuote object;
+  object.setLazyGroups( true );
+  static const char* str =
+    "8=FIX.4.2\0019=54\00135=i\001117=1\001296=1\001302=A\001"
+    "311=DELL\001364=10\001365=DELL\001COMP\001\00110=152\001";
+
+  object.setString( str, true, &dataDictionary );
+  CHECK( object.hasDeferredGroups() );
+  CHECK_EQUAL( str, object.toString() );
+
+  MassQuote::NoQuoteSets group;
+  object.getGroup( 1, group );
+  CHECK_EQUAL( "DELL\001COMP\001", group.getField( FIELD::EncodedUnderlyingSecurityDesc ) );
+
+  DataDictionary dataDictionary44( "../spec/FIX44.xml" );
+  static const char* cross =
+    "8=FIX.4.4\0019=130\00135=s\001548=1\001549=1\001550=1\001552=2\001"
+    "54=1\00111=A\001453=2\001448=P1\001447=D\001452=1\001448=P2\001447=D\001452=3\00138=100\001"
+    "54=2\00111=B\00138=100\00155=X\00160=20040916-16:19:18\00140=1\00110=000\001";
+  FIX::Message message;
+  message.setLazyGroups( true );
+  message.setString( cross, false, &dataDictionary44 );
+  CHECK( message.hasDeferredGroups() );
+  CHECK_EQUAL( "X", message.getField( FIELD::Symbol ) );
+  CHECK_EQUAL( 2U, message.groupCount( FIELD::NoSides ) );
+
+  FieldMap& side = message.getGroupRef( 1, FIELD::NoSides );
+  CHECK_EQUAL( 2U, side.groupCount( FIELD::NoPartyIDs ) );
+  CHECK_EQUAL( "P2", side.getGroupRef( 2, FIELD::NoPartyIDs ).getField( FIELD::PartyID ) );
+  CHECK_EQUAL( "B", message.getGroupRef( 2, FIELD::NoSides ).getField( FIELD::ClOrdID ) );
+
+  FIX::Message eager;
+  eager.setString( cross, false, &dataDictionary44 );
+  CHECK_EQUAL( eager.toString(), message.toString() );
+}
+
 TEST(setStringWithGroupWithoutDelimiter)
 {
   FIX::Message object;
@@ -375,6 +532,47 @@ TEST(checkSum)
   CHECK_EQUAL( chksum, object.checkSum() );
 }
 
+TEST(toStringBackpatchesBodyLength)
+{
+  FIX::Message object;
+  object.getHeader().setField( BeginString( "FIX.4.2" ) );
+  object.getHeader().setField( MsgType( "0" ) );
+  object.getHeader().setField( BodyLength( 5 ) );
+  object.setField( TestReqID( "ID" ) );
+
+  std::string str;
+  object.toString( str );
+  CHECK_EQUAL( "8=FIX.4.2\0019=12\00135=0\001112=ID\00110=046\001", str );
+
+  // length grows by a digit, then shrinks again reusing the buffer
+  object.setField( Text( std::string( 100, 'x' ) ) );
+  object.toString( str );
+  CHECK_EQUAL( "116", object.getHeader().getField( FIELD::BodyLength ) );
+  CHECK_EQUAL( object.checkSum(), (int)FIELD_GET_REF( object.getTrailer(), CheckSum ) );
+  FIX::Message parsed( str );
+  CHECK_EQUAL( str, parsed.toString() );
+
+  object.removeField( FIELD::Text );
+  object.toString( str );
+  CHECK_EQUAL( "8=FIX.4.2\0019=12\00135=0\001112=ID\00110=046\001", str );
+}
+
+TEST(toStringCustomTags)
+{
+  FIX::Message object;
+  object.getHeader().setField( BeginString( "FIX.4.2" ) );
+  object.getHeader().setField( MsgType( "0" ) );
+  object.getHeader().setField( FieldBase( 9000, "BEGIN" ) );
+  object.setField( TestReqID( "ID" ) );
+
+  // BodyLength is not second in the header and BeginString not first
+  std::string str;
+  object.toString( str, 9000, 9001, FIELD::CheckSum );
+  CHECK_EQUAL( object.bodyLength( 9000, 9001, FIELD::CheckSum ),
+               IntConvertor::convert( object.getHeader().getField( 9001 ) ) );
+  CHECK_EQUAL( object.checkSum(), (int)FIELD_GET_REF( object.getTrailer(), CheckSum ) );
+}
+
 TEST(headerFieldsFirst)
 {
   FIX::Message object;
@@ -791,6 +989,64 @@ TEST(newOrderSingleGetString)
                object.toString() );
 }
 
+#ifdef HAVE_RVALUE_REFERENCES
+TEST(newOrderSingleBuildFromTemporaries)
+{
+  const std::string clOrdID( 40, 'C' );
+  const std::string account( 40, 'A' );
+  const std::string text( 200, 'T' );
+
+  std::size_t copies = 0;
+  NewOrderSingle copied;
+  {
+    AllocationCounter counter;
+    ClOrdID clOrdIDField( clOrdID );
+    Account accountField( account );
+    Symbol symbol( "MSFT" );
+    Text textField( text );
+    copied.set( clOrdIDField );
+    copied.set( accountField );
+    copied.set( symbol );
+    copied.set( textField );
+    copied.setField( FIELD::DeliverToCompID, text );
+    copies = counter.count();
+  }
+
+  std::size_t moves = 0;
+  NewOrderSingle moved;
+  {
+    AllocationCounter counter;
+    moved.set( ClOrdID( clOrdID ) );
+    moved.set( Account( account ) );
+    moved.set( Symbol( "MSFT" ) );
+    moved.set( Text( text ) );
+    moved.setField( FIELD::DeliverToCompID, std::string( text ) );
+    moves = counter.count();
+  }
+
+  CHECK( moves < copies );
+  CHECK_EQUAL( copied.toString(), moved.toString() );
+
+  std::size_t copyingMessage = 0;
+  {
+    AllocationCounter counter;
+    NewOrderSingle copy( copied );
+    copyingMessage = counter.count();
+  }
+
+  std::size_t movingMessage = 0;
+  {
+    AllocationCounter counter;
+    NewOrderSingle other( std::move( moved ) );
+    movingMessage = counter.count();
+    CHECK_EQUAL( copied.toString(), other.toString() );
+  }
+
+  CHECK( movingMessage < copyingMessage );
+  CHECK( moved.isEmpty() );
+}
+#endif
+
 TEST(newOrderSingleSetString)
 {
   NewOrderSingle object;
@@ -1481,4 +1737,58 @@ TEST(BeginStringToApplVerID) {
 
 }
 
+TEST(msgTypeId)
+{
+  const char chars[] =
+    "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+  std::set<int> ids;
+  for( int i = 0; i < 62; ++i )
+  {
+    ids.insert( FIX::Message::msgTypeId( std::string( 1, chars[i] ) ) );
+    for( int j = 0; j < 62; ++j )
+      ids.insert( FIX::Message::msgTypeId( std::string( 1, chars[i] ) + chars[j] ) );
+  }
+  CHECK_EQUAL( 62U + 62U * 62U, ids.size() );
+  CHECK_EQUAL( 1, *ids.begin() );
+  CHECK_EQUAL( 3906, *ids.rbegin() );
+
+  CHECK_EQUAL( MsgTypeId_Heartbeat, FIX::Message::msgTypeId( MsgType_Heartbeat ) );
+  CHECK_EQUAL( MsgTypeId_Logon, FIX::Message::msgTypeId( MsgType_Logon ) );
+  CHECK_EQUAL( MsgTypeId_TradeCaptureReport,
+               FIX::Message::msgTypeId( MsgType_TradeCaptureReport ) );
+  CHECK_EQUAL( MsgTypeId_StreamAssignmentReportACK,
+               FIX::Message::msgTypeId( MsgType_StreamAssignmentReportACK ) );
+
+  CHECK_EQUAL( 0, FIX::Message::msgTypeId( "" ) );
+  CHECK_EQUAL( 0, FIX::Message::msgTypeId( "ABC" ) );
+  CHECK_EQUAL( 0, FIX::Message::msgTypeId( "A=" ) );
+  CHECK_EQUAL( 0, FIX::Message::msgTypeId( "\001" ) );
+
+  CHECK( FIX::Message::isAdminMsgTypeId( MsgTypeId_Logon ) );
+  CHECK( FIX::Message::isAdminMsgTypeId( MsgTypeId_Logout ) );
+  CHECK( !FIX::Message::isAdminMsgTypeId( MsgTypeId_IOI ) );
+  CHECK( !FIX::Message::isAdminMsgTypeId( 0 ) );
+
+  FIX::Message message;
+  CHECK_EQUAL( 0, message.getMsgTypeId() );
+  message.getHeader().setField( MsgType( "AE" ) );
+  CHECK_EQUAL( MsgTypeId_TradeCaptureReport, message.getMsgTypeId() );
+}
+
+TEST(versionId)
+{
+  CHECK_EQUAL( FIX::Message::VERSION_FIX40, FIX::Message::versionId( BeginString( BeginString_FIX40 ) ) );
+  CHECK_EQUAL( FIX::Message::VERSION_FIX44, FIX::Message::versionId( BeginString( BeginString_FIX44 ) ) );
+  CHECK_EQUAL( FIX::Message::VERSION_FIX50, FIX::Message::versionId( BeginString( BeginString_FIX50 ) ) );
+  CHECK_EQUAL( FIX::Message::VERSION_FIX50SP2, FIX::Message::versionId( BeginString( "FIX.5.0SP2" ) ) );
+  CHECK_EQUAL( FIX::Message::VERSION_FIXT11, FIX::Message::versionId( BeginString( BeginString_FIXT11 ) ) );
+  CHECK_EQUAL( FIX::Message::VERSION_UNKNOWN, FIX::Message::versionId( BeginString( "FIX.4.5" ) ) );
+  CHECK_EQUAL( FIX::Message::VERSION_UNKNOWN, FIX::Message::versionId( BeginString( "Custom" ) ) );
+
+  CHECK_EQUAL( FIX::Message::VERSION_FIX40, FIX::Message::versionId( ApplVerID( ApplVerID_FIX40 ) ) );
+  CHECK_EQUAL( FIX::Message::VERSION_FIX50SP2, FIX::Message::versionId( ApplVerID( ApplVerID_FIX50SP2 ) ) );
+  CHECK_EQUAL( FIX::Message::VERSION_UNKNOWN, FIX::Message::versionId( ApplVerID( ApplVerID_FIX27 ) ) );
+  CHECK_EQUAL( FIX::Message::VERSION_UNKNOWN, FIX::Message::versionId( ApplVerID( "10" ) ) );
+}
+
 }
@@ -85,6 +85,11 @@ TEST_FIXTURE(resetMySQLStoreFixture, setGet)
   CHECK_MESSAGE_STORE_SET_GET;
 }
 
+TEST_FIXTURE(resetMySQLStoreFixture, setBatch)
+{
+  CHECK_MESSAGE_STORE_SET_BATCH;
+}
+
 TEST_FIXTURE(resetMySQLStoreFixture, setGetWithQuote)
 {
   CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
@@ -85,6 +85,11 @@ TEST_FIXTURE(resetOdbcStoreFixture, setGet)
   CHECK_MESSAGE_STORE_SET_GET;
 }
 
+TEST_FIXTURE(resetOdbcStoreFixture, setBatch)
+{
+  CHECK_MESSAGE_STORE_SET_BATCH;
+}
+
 TEST_FIXTURE(resetOdbcStoreFixture, setGetWithQuote)
 {
   //CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
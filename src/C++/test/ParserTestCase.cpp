@@ -160,6 +160,49 @@ TEST(readMessagesByteByByte)
   }
 }
 
+TEST_FIXTURE(readFixMessageFixture, readFixMessageSpan)
+{
+  const char* data = 0;
+  std::size_t length = 0;
+  CHECK( object.readFixMessage( data, length ) );
+  CHECK_EQUAL( fixMsg1, std::string( data, length ) );
+
+  CHECK( object.readFixMessage( data, length ) );
+  CHECK_EQUAL( fixMsg2, std::string( data, length ) );
+  const char* second = data;
+
+  CHECK( object.readFixMessage( data, length ) );
+  CHECK_EQUAL( fixMsg3, std::string( data, length ) );
+  CHECK( second + fixMsg2.size() == data );
+
+  CHECK_THROW( object.readFixMessage( data, length ), MessageParseError );
+}
+
+TEST(readFromBuffer)
+{
+  Parser object;
+  std::string fixMsg = "8=FIX.4.2\0019=17\00135=4\00136=88\001123=Y\00110=34\001";
+  std::string readFixMsg;
+
+  for( int i = 0; i < 1000; ++i )
+  {
+    // write in two pieces so that a partial message is left behind
+    std::size_t length = 0;
+    char* buffer = object.getBuffer( length, 64 );
+    CHECK( length >= 64 );
+    std::copy( fixMsg.begin(), fixMsg.begin() + 20, buffer );
+    object.commit( 20 );
+    CHECK( !object.readFixMessage( readFixMsg ) );
+
+    buffer = object.getBuffer( length, 64 );
+    std::copy( fixMsg.begin() + 20, fixMsg.end(), buffer );
+    object.commit( fixMsg.size() - 20 );
+    CHECK( object.readFixMessage( readFixMsg ) );
+    CHECK_EQUAL( fixMsg, readFixMsg );
+    CHECK_EQUAL( 0U, object.size() );
+  }
+}
+
 struct readMessageWithBadLengthFixture
 {
   readMessageWithBadLengthFixture()
@@ -85,6 +85,11 @@ TEST_FIXTURE(resetPostgreSQLStoreFixture, setGet)
   CHECK_MESSAGE_STORE_SET_GET;
 }
 
+TEST_FIXTURE(resetPostgreSQLStoreFixture, setBatch)
+{
+  CHECK_MESSAGE_STORE_SET_BATCH;
+}
+
 TEST_FIXTURE(resetPostgreSQLStoreFixture, setGetWithQuote)
 {
   //CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
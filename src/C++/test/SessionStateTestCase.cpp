@@ -29,6 +29,7 @@
 #include <string>
 #include <sstream>
 #include "Log.h"
+#include "TestHelper.h"
 
 using namespace FIX;
 
@@ -105,4 +106,47 @@ SUITE(SessionStateTests)
 
     CHECK_EQUAL(0, log.eventsBackup);
   }
+
+#ifdef HAVE_RVALUE_REFERENCES
+  FIX::Message createOutOfOrderMessage()
+  {
+    FIX::Message message;
+    message.getHeader().setField( BeginString( "FIX.4.2" ) );
+    message.getHeader().setField( MsgType( "D" ) );
+    message.getHeader().setField( MsgSeqNum( 5 ) );
+    message.setField( ClOrdID( std::string( 40, 'C' ) ) );
+    message.setField( Account( std::string( 40, 'A' ) ) );
+    message.setField( Text( std::string( 200, 'T' ) ) );
+    return message;
+  }
+
+  TEST(QueueMessage_MovedMessage_FieldsNotCopied)
+  {
+    SessionState state;
+    FIX::Message copied = createOutOfOrderMessage();
+    FIX::Message moved = createOutOfOrderMessage();
+
+    std::size_t copies = 0;
+    {
+      AllocationCounter counter;
+      state.queue( 5, copied );
+      copies = counter.count();
+    }
+
+    std::size_t moves = 0;
+    {
+      AllocationCounter counter;
+      state.queue( 6, std::move( moved ) );
+      moves = counter.count();
+    }
+
+    CHECK( moves < copies );
+    CHECK( moved.isEmpty() );
+
+    FIX::Message retrieved;
+    CHECK( state.retrieve( 6, retrieved ) );
+    CHECK_EQUAL( copied.toString(), retrieved.toString() );
+    CHECK( !state.retrieve( 6, retrieved ) );
+  }
+#endif
 }
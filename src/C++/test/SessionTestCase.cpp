@@ -32,6 +32,7 @@
 #include <SessionID.h>
 #include <TimeRange.h>
 #include <Message.h>
+#include <MessageCracker.h>
 #include <DataDictionaryProvider.h>
 #include <fix42/Logon.h>
 #include <fix42/Logout.h>
@@ -85,10 +86,17 @@ public:
     fromReject( 0 ),
     fromSequenceReset( 0 ),
     resent( 0 ),
-    disconnected( 0 )
+    disconnected( 0 ),
+    fromView( 0 ),
+    sends( 0 )
     {}
 
-  bool send( const std::string& ) { return true; }
+  bool send( const std::string& string )
+  {
+    sends++;
+    lastSent = string;
+    return true;
+  }
 
   virtual void toAdmin( FIX::Message& message, const SessionID& )
   {
@@ -141,9 +149,23 @@ public:
       throw UnsupportedMessageType();
   }
 
-  void toApp( FIX::Message& message, const SessionID& )
+  void fromAppView( const FIX::MessageView& view, const SessionID& sessionID )
+  EXCEPT( FieldNotFound, IncorrectDataFormat, IncorrectTagValue, UnsupportedMessageType )
+  {
+    fromView++;
+    Application::fromAppView( view, sessionID );
+  }
+
+  void toApp( FIX::Message& message, const SessionID& sessionID )
   EXCEPT( DoNotSend )
   {
+    if( pSendFromApp && message.isSetField( FIELD::Text )
+        && message.getField( FIELD::Text ) == "SendFromApp" ) {
+      FIX::Message* pMessage = pSendFromApp;
+      pSendFromApp = 0;
+      Session::lookupSession( sessionID )->send( *pMessage );
+    }
+
     if(checkForDoNotSend) {
       FIX::Text text;
       if(message.getFieldIfSet(text) && text == "DoNotSend") {
@@ -188,8 +210,13 @@ public:
   int fromSequenceReset;
   int resent;
   int disconnected;
+  int fromView;
+  int sends;
+  std::string lastSent;
 
   int checkForDoNotSend = false;
+  // sent from toApp of the next message with Text SendFromApp
+  FIX::Message* pSendFromApp = 0;
 
   MemoryStoreFactory factory;
 };
@@ -631,8 +658,10 @@ TEST_FIXTURE(acceptorFixture, nextLogon)
   HeartBtInt heartBtInt;
   EncryptMethod encryptMethod;
 
-  sentLogon.getHeader().getField( senderCompID );
-  sentLogon.getHeader().getField( targetCompID );
+  // the identity fields are written when the message is serialized
+  FIX::Message sent( lastSent );
+  sent.getHeader().getField( senderCompID );
+  sent.getHeader().getField( targetCompID );
   sentLogon.getField( heartBtInt );
   sentLogon.getField( encryptMethod );
 
@@ -658,8 +687,10 @@ TEST_FIXTURE(acceptorFixture, nextLogonNoEncryptMethod)
   HeartBtInt heartBtInt;
   EncryptMethod encryptMethod;
 
-  sentLogon.getHeader().getField( senderCompID );
-  sentLogon.getHeader().getField( targetCompID );
+  // the identity fields are written when the message is serialized
+  FIX::Message sent( lastSent );
+  sent.getHeader().getField( senderCompID );
+  sent.getHeader().getField( targetCompID );
   sentLogon.getField( heartBtInt );
   sentLogon.getField( encryptMethod );
 
@@ -1227,6 +1258,68 @@ TEST_FIXTURE(acceptorFixture, nextResendRequest)
   CHECK_EQUAL( 11, resent );
 }
 
+TEST_FIXTURE(acceptorFixture, sendBatch)
+{
+  checkForDoNotSend = true;
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+  int sendsBefore = sends;
+
+  FIX::Message first = createNewOrderSingle( "ISLD", "TW", 0 );
+  FIX::Message second = createNewOrderSingle( "ISLD", "TW", 0 );
+  FIX::Message skipped = createNewOrderSingle( "ISLD", "TW", 0 );
+  skipped.setField( Text( "DoNotSend" ) );
+  FIX::Message third = createNewOrderSingle( "ISLD", "TW", 0 );
+  std::vector < FIX::Message* > messages;
+  messages.push_back( &first );
+  messages.push_back( &second );
+  messages.push_back( &skipped );
+  messages.push_back( &third );
+
+  // the skipped message does not take a sequence number
+  CHECK( !object->send( messages ) );
+  CHECK_EQUAL( "2", first.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( "3", second.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( "4", third.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( 5, object->getExpectedSenderNum() );
+
+  CHECK_EQUAL( sendsBefore + 1, sends );
+  CHECK_EQUAL( first.toString() + second.toString() + third.toString(), lastSent );
+
+  // an admin message goes out on its own between the batches
+  FIX::Message heartbeat = createHeartbeat( "ISLD", "TW", 0 );
+  messages.clear();
+  messages.push_back( &first );
+  messages.push_back( &heartbeat );
+  messages.push_back( &second );
+  CHECK( object->send( messages ) );
+  CHECK_EQUAL( "5", first.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( "6", heartbeat.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( "7", second.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( sendsBefore + 4, sends );
+
+  // the batches were persisted
+  object->next( createResendRequest( "ISLD", "TW", 2, 2, 7 ), UtcTimeStamp() );
+  CHECK_EQUAL( 5, resent );
+
+  // a message sent from toApp follows the messages batched before it
+  FIX::Message fromApp = createNewOrderSingle( "ISLD", "TW", 0 );
+  messages.clear();
+  messages.push_back( &first );
+  messages.push_back( &second );
+  messages.push_back( &third );
+  second.setField( Text( "SendFromApp" ) );
+  pSendFromApp = &fromApp;
+  resent = 0;
+  CHECK( object->send( messages ) );
+  CHECK_EQUAL( "8", first.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( "9", fromApp.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( "10", second.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( "11", third.getHeader().getField( FIELD::MsgSeqNum ) );
+  CHECK_EQUAL( 12, object->getExpectedSenderNum() );
+  object->next( createResendRequest( "ISLD", "TW", 3, 8, 11 ), UtcTimeStamp() );
+  CHECK_EQUAL( 4, resent );
+}
+
 TEST_FIXTURE(acceptorFixture, nextResendRequestRepeatingGroup)
 {
   object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
@@ -1351,6 +1444,123 @@ TEST_FIXTURE(acceptorFixture, unsupportedMsgType)
   CHECK_EQUAL( 1, toBusinessMessageReject );
 }
 
+TEST_FIXTURE(acceptorFixture, nextMessageView)
+{
+  object->setResponder( this );
+  object->setUseMessageView( true );
+  object->next( createLogon( "ISLD", "TW", 1 ).toString(), UtcTimeStamp() );
+  CHECK( object->receivedLogon() );
+  CHECK_EQUAL( 0, fromView );
+
+  object->next( createNewOrderSingle( "ISLD", "TW", 2 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 1, fromView );
+  CHECK_EQUAL( 3, object->getExpectedTargetNum() );
+
+  // bodies with repeating groups are validated and delivered decoded
+  object->next( createExecutionReport( "ISLD", "TW", 3 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 1, fromView );
+  CHECK_EQUAL( 1, toBusinessMessageReject );
+
+  // messages that have to be queued are fully decoded
+  object->next( createNewOrderSingle( "ISLD", "TW", 10 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 1, fromView );
+  CHECK_EQUAL( 1, toResendRequest );
+}
+
+TEST_FIXTURE(acceptorFixture, nextMessageViewValidatesBody)
+{
+  object->setResponder( this );
+  object->setUseMessageView( true );
+  object->next( createLogon( "ISLD", "TW", 1 ).toString(), UtcTimeStamp() );
+  CHECK( object->receivedLogon() );
+
+  FIX42::NewOrderSingle missingRequired = createNewOrderSingle( "ISLD", "TW", 2 );
+  missingRequired.removeField( FIELD::Symbol );
+  object->next( missingRequired.toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 1, toReject );
+
+  FIX42::NewOrderSingle badValue = createNewOrderSingle( "ISLD", "TW", 3 );
+  badValue.setField( Side( 'Z' ) );
+  object->next( badValue.toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 2, toReject );
+
+  FIX42::NewOrderSingle notInMessage = createNewOrderSingle( "ISLD", "TW", 4 );
+  notInMessage.setField( LeavesQty( 100 ) );
+  object->next( notInMessage.toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 3, toReject );
+
+  FIX::Message unknownType = createNewOrderSingle( "ISLD", "TW", 5 );
+  unknownType.getHeader().setField( MsgType( "ZZ" ) );
+  object->next( unknownType.toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 4, toReject );
+
+  CHECK_EQUAL( 0, fromView );
+  CHECK_EQUAL( 6, object->getExpectedTargetNum() );
+}
+
+TEST_FIXTURE(acceptorFixture, nextReuseInboundMessage)
+{
+  object->setResponder( this );
+  object->setReuseInboundMessage( true );
+  object->next( createLogon( "ISLD", "TW", 1 ).toString(), UtcTimeStamp() );
+  CHECK( object->receivedLogon() );
+
+  object->next( createNewOrderSingle( "ISLD", "TW", 2 ).toString(), UtcTimeStamp() );
+  object->next( createExecutionReport( "ISLD", "TW", 3 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 1, toBusinessMessageReject );
+
+  // a queued message must survive the inbound message being decoded into again
+  object->next( createNewOrderSingle( "ISLD", "TW", 5 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 1, toResendRequest );
+  CHECK_EQUAL( 4, object->getExpectedTargetNum() );
+  object->next( createExecutionReport( "ISLD", "TW", 4 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 2, toBusinessMessageReject );
+  CHECK_EQUAL( 6, object->getExpectedTargetNum() );
+}
+
+class OffsetClock : public Clock
+{
+public:
+  OffsetClock( int64_t offset ) : m_offset( offset ) {}
+  int64_t nanos() { return Clock::realtime().nanos() + m_offset; }
+
+private:
+  int64_t m_offset;
+};
+
+TEST_FIXTURE(acceptorFixture, nextUsesSessionClock)
+{
+  // ten minutes ahead, further than the default MaxLatency
+  OffsetClock clock( 600 * DateTime::NANOS_PER_SEC );
+  object->setClock( clock );
+  object->setResponder( this );
+
+  // the timestamp passed in is used for the latency check
+  FIX42::Logon logon = createLogon( "ISLD", "TW", 1 );
+  logon.getHeader().setField( SendingTime( clock.now() ) );
+  object->next( logon, clock.now() );
+  CHECK( object->receivedLogon() );
+
+  // and the session's clock for outgoing messages
+  SendingTime sendingTime;
+  sentLogon.getHeader().getField( sendingTime );
+  CHECK( sendingTime.getValue() - UtcTimeStamp() >= 599 );
+}
+
+TEST_FIXTURE(acceptorFixture, nextLazyGroupDecoding)
+{
+  object->setResponder( this );
+  object->setLazyGroupDecoding( true );
+  object->next( createLogon( "ISLD", "TW", 1 ).toString(), UtcTimeStamp() );
+  CHECK( object->receivedLogon() );
+
+  object->next( createNewOrderSingle( "ISLD", "TW", 2 ).toString(), UtcTimeStamp() );
+  object->next( createNewOrderSingle( "ISLD", "TW", 4 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 1, toResendRequest );
+  object->next( createNewOrderSingle( "ISLD", "TW", 3 ).toString(), UtcTimeStamp() );
+  CHECK_EQUAL( 5, object->getExpectedTargetNum() );
+}
+
 TEST_FIXTURE(acceptorFixture, doNotRespondToLogonWhenDisabled)
 {
   object->setResponder( this );
@@ -2736,4 +2946,54 @@ TEST_FIXTURE(initiatorFixture, LookUpSession_SessionFound)
   CHECK(nullptr != actualSession);
 }
 
+class TestCracker : public FIX::MessageCracker
+{
+public:
+  void onMessage( const FIX42::Heartbeat&, const SessionID& )
+  { cracked = "FIX42::Heartbeat"; }
+  void onMessage( const FIX44::NewOrderSingle&, const SessionID& )
+  { cracked = "FIX44::NewOrderSingle"; }
+  void onMessage( const FIX44::TradeCaptureReport&, const SessionID& )
+  { cracked = "FIX44::TradeCaptureReport"; }
+  void onMessage( const FIX50SP2::NewOrderSingle&, const SessionID& )
+  { cracked = "FIX50SP2::NewOrderSingle"; }
+
+  std::string cracked;
+};
+
+static FIX::Message createCrackerMessage( const char* beginString, const char* msgType )
+{
+  FIX::Message message;
+  message.getHeader().setField( BeginString( beginString ) );
+  message.getHeader().setField( MsgType( msgType ) );
+  return message;
+}
+
+TEST(crack)
+{
+  TestCracker cracker;
+  SessionID sessionID;
+
+  cracker.crack( createCrackerMessage( BeginString_FIX42, MsgType_Heartbeat ), sessionID );
+  CHECK_EQUAL( "FIX42::Heartbeat", cracker.cracked );
+  cracker.crack( createCrackerMessage( BeginString_FIX44, MsgType_NewOrderSingle ), sessionID );
+  CHECK_EQUAL( "FIX44::NewOrderSingle", cracker.cracked );
+  cracker.crack( createCrackerMessage( BeginString_FIX44, MsgType_TradeCaptureReport ), sessionID );
+  CHECK_EQUAL( "FIX44::TradeCaptureReport", cracker.cracked );
+
+  FIX::Message message = createCrackerMessage( BeginString_FIXT11, MsgType_NewOrderSingle );
+  message.getHeader().setField( ApplVerID( ApplVerID_FIX50SP2 ) );
+  const FIX::Message& constMessage = message;
+  cracker.crack( constMessage, sessionID );
+  CHECK_EQUAL( "FIX50SP2::NewOrderSingle", cracker.cracked );
+
+  cracker.cracked = "";
+  CHECK_THROW( cracker.crack( createCrackerMessage( BeginString_FIX44, "ZZ" ), sessionID ),
+               UnsupportedMessageType );
+  CHECK_THROW( cracker.crack( createCrackerMessage( BeginString_FIX44, "AE1" ), sessionID ),
+               UnsupportedMessageType );
+  cracker.crack( createCrackerMessage( "FIX.4.5", MsgType_NewOrderSingle ), sessionID );
+  CHECK_EQUAL( "", cracker.cracked );
+}
+
 }
@@ -107,4 +107,44 @@ TEST(Unsignal_SocketDoesNotExist_WriteSocketErased)
   socket_close(socket);
 }
 
+TEST(block_Epoll_OnlyReadySocketsDispatched)
+{
+  SocketMonitor monitor;
+  if( !monitor.useEpoll() )
+    return;
+  CHECK(monitor.isEpoll());
+
+  TestStrategy strategy;
+  std::pair<socket_handle, socket_handle> ready = socket_createpair();
+  std::pair<socket_handle, socket_handle> idle = socket_createpair();
+  monitor.addRead(ready.first);
+  monitor.addRead(idle.first);
+
+  monitor.block(strategy, true);
+  CHECK_EQUAL(1, strategy.timeoutCount);
+  CHECK_EQUAL(0, strategy.eventCount);
+
+  socket_send(ready.second, "x", 1);
+  monitor.block(strategy, true);
+  CHECK_EQUAL(1, strategy.eventCount);
+  char buffer[1];
+  socket_recv(ready.first, buffer, 1);
+
+  monitor.signal(idle.first);
+  monitor.block(strategy, true);
+  monitor.block(strategy, true);
+  CHECK_EQUAL(1, strategy.writeCount);
+
+  monitor.unsignal(idle.first);
+  CHECK(monitor.drop(ready.first));
+  monitor.block(strategy, true);
+  CHECK_EQUAL(1, strategy.errorCount);
+  monitor.block(strategy, true);
+  CHECK_EQUAL(1, strategy.eventCount);
+  CHECK_EQUAL(1, strategy.writeCount);
+
+  socket_close(ready.second);
+  socket_close(idle.second);
+}
+
 }
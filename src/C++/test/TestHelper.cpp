@@ -5,3 +5,52 @@ namespace FIX
   short TestSettings::port = 0;
   FIX::SessionSettings TestSettings::sessionSettings;
 }
+
+#ifdef HAVE_RVALUE_REFERENCES
+#include <new>
+
+namespace
+{
+  thread_local bool s_countAllocations = false;
+  thread_local std::size_t s_allocations = 0;
+}
+
+void* operator new( std::size_t size )
+{
+  if ( s_countAllocations ) ++s_allocations;
+  void* p = std::malloc( size ? size : 1 );
+  if ( !p ) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete( void* p ) NOEXCEPT
+{
+  std::free( p );
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete( void* p, std::size_t ) NOEXCEPT
+{
+  std::free( p );
+}
+#endif
+
+namespace FIX
+{
+  AllocationCounter::AllocationCounter()
+  : m_start( s_allocations ), m_counting( s_countAllocations )
+  {
+    s_countAllocations = true;
+  }
+
+  AllocationCounter::~AllocationCounter()
+  {
+    s_countAllocations = m_counting;
+  }
+
+  std::size_t AllocationCounter::count() const
+  {
+    return s_allocations - m_start;
+  }
+}
+#endif
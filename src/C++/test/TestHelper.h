@@ -16,6 +16,22 @@ struct TestSettings
   static FIX::SessionSettings sessionSettings;
 };
 
+#ifdef HAVE_RVALUE_REFERENCES
+/// Counts the allocations made by the current thread while it is alive
+class AllocationCounter
+{
+public:
+  AllocationCounter();
+  ~AllocationCounter();
+
+  std::size_t count() const;
+
+private:
+  std::size_t m_start;
+  bool m_counting;
+};
+#endif
+
 class TestApplication : public NullApplication
 {
 public:
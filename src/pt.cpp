@@ -42,14 +42,23 @@
 #include "SocketInitiator.h"
 #include "ThreadedSocketAcceptor.h"
 #include "ThreadedSocketInitiator.h"
+#include "SocketMonitor.h"
 #include "fix42/Heartbeat.h"
 #include "fix42/NewOrderSingle.h"
 #include "fix42/QuoteRequest.h"
+#include "fix42/MarketDataIncrementalRefresh.h"
+#include "fix44/NewOrderSingle.h"
+#include "fix44/ExecutionReport.h"
+#include "fix44/MarketDataIncrementalRefresh.h"
+#include "ByteScanner.h"
+#include "FastCodec.h"
 
 long testIntegerToString( int );
 long testStringToInteger( int );
 long testDoubleToString( int );
 long testStringToDouble( int );
+long testDecimalToString( int );
+long testStringToDecimal( int );
 long testCreateHeartbeat( int );
 long testIdentifyType( int );
 long testSerializeToStringHeartbeat( int );
@@ -61,16 +70,29 @@ long testSerializeFromStringNewOrderSingle( int );
 long testSerializeFromStringAndValidateNewOrderSingle( int );
 long testCreateQuoteRequest( int );
 long testReadFromQuoteRequest( int );
+long testGetField( int, int );
+long testScanFIX44Traffic( int, FIX::ByteScanner::Kernel );
+long testSerializeToStringFIX44NewOrderSingle( int );
+long testSerializeToStringFIX44ExecutionReport( int );
 long testSerializeToStringQuoteRequest( int );
 long testSerializeFromStringQuoteRequest( int );
+long testSerializeFromStringMarketDataIncrementalRefresh( int, bool );
 long testSerializeFromStringAndValidateQuoteRequest( int );
 long testFileStoreNewOrderSingle( int );
 long testValidateNewOrderSingle( int );
 long testValidateDictNewOrderSingle( int );
 long testValidateQuoteRequest( int );
 long testValidateDictQuoteRequest( int );
+long testValidateDictFIX44ExecutionReport( int );
+long testSerializeFromStringAndValidateFIX44ExecutionReport( int );
+long testSerializeFromStringFIX44ExecutionReportWithProfile( int, bool );
+long testSerializeToStringFIX44MarketDataIncrementalRefresh( int );
+long testSerializeFromStringFIX44MarketDataIncrementalRefresh( int );
+long testEncodeFASTMarketDataIncrementalRefresh( int );
+long testDecodeFASTMarketDataIncrementalRefresh( int );
 long testSendOnSocket( int, short );
 long testSendOnThreadedSocket( int, short );
+long testBlockOnSockets( int, int, bool, bool );
 void report( long, int );
 
 #ifndef _MSC_VER
@@ -87,6 +109,7 @@ long GetTickCount()
 #endif
 
 SmartPtr<FIX::DataDictionary> s_dataDictionary;
+SmartPtr<FIX::DataDictionary> s_dataDictionary44;
 const bool VALIDATE = true;
 const bool DONT_VALIDATE = false;
 
@@ -115,6 +138,7 @@ int main( int argc, char** argv )
   }
 
   s_dataDictionary.reset( new FIX::DataDictionary( "../spec/FIX42.xml" ) );
+  s_dataDictionary44.reset( new FIX::DataDictionary( "../spec/FIX44.xml" ) );
 
   std::cout << "Converting integers to strings: ";
   report( testIntegerToString( count ), count );
@@ -128,6 +152,12 @@ int main( int argc, char** argv )
   std::cout << "Converting strings to doubles: ";
   report( testStringToDouble( count ), count );
 
+  std::cout << "Converting decimals to strings: ";
+  report( testDecimalToString( count ), count );
+
+  std::cout << "Converting strings to decimals: ";
+  report( testStringToDecimal( count ), count );
+
   std::cout << "Creating Heartbeat messages: ";
   report( testCreateHeartbeat( count ), count );
 
@@ -164,12 +194,42 @@ int main( int argc, char** argv )
   std::cout << "Serializing QuoteRequest messages from strings: ";
   report( testSerializeFromStringQuoteRequest( count ), count );
 
+  std::cout << "Serializing MarketDataIncrementalRefresh messages with 50 entries from strings: ";
+  report( testSerializeFromStringMarketDataIncrementalRefresh( count, false ), count );
+
+  std::cout << "Serializing MarketDataIncrementalRefresh messages with 50 entries from strings with lazy groups: ";
+  report( testSerializeFromStringMarketDataIncrementalRefresh( count, true ), count );
+
   std::cout << "Serializing QuoteRequest messages from strings and validation: ";
   report( testSerializeFromStringAndValidateQuoteRequest( count ), count );
 
   std::cout << "Reading fields from QuoteRequest message: ";
   report( testReadFromQuoteRequest( count ), count );
 
+  std::cout << "Getting fields from 10 field messages: ";
+  report( testGetField( count, 10 ), count );
+
+  std::cout << "Getting fields from 50 field messages: ";
+  report( testGetField( count, 50 ), count );
+
+  std::cout << "Getting fields from 200 field messages: ";
+  report( testGetField( count, 200 ), count );
+
+  FIX::ByteScanner::Kernel kernel = FIX::ByteScanner::kernel();
+  std::cout << "Scanning and checksumming FIX44 traffic with scalar kernel: ";
+  report( testScanFIX44Traffic( count, FIX::ByteScanner::SCALAR ), count );
+
+  std::cout << "Scanning and checksumming FIX44 traffic with "
+            << ( kernel == FIX::ByteScanner::AVX2 ? "AVX2" : kernel == FIX::ByteScanner::SSE2 ? "SSE2" : "scalar" )
+            << " kernel: ";
+  report( testScanFIX44Traffic( count, kernel ), count );
+
+  std::cout << "Serializing FIX44 NewOrderSingle messages to strings: ";
+  report( testSerializeToStringFIX44NewOrderSingle( count ), count );
+
+  std::cout << "Serializing FIX44 ExecutionReport messages to strings: ";
+  report( testSerializeToStringFIX44ExecutionReport( count ), count );
+
   std::cout << "Storing NewOrderSingle messages: ";
   report( testFileStoreNewOrderSingle( count ), count );
 
@@ -185,12 +245,56 @@ int main( int argc, char** argv )
   std::cout << "Validating QuoteRequest messages with data dictionary: ";
   report( testValidateDictQuoteRequest( count ), count );
 
+  std::cout << "Validating FIX44 ExecutionReport messages with data dictionary: ";
+  report( testValidateDictFIX44ExecutionReport( count ), count );
+
+  std::cout << "Serializing FIX44 ExecutionReport messages from strings and validating: ";
+  report( testSerializeFromStringAndValidateFIX44ExecutionReport( count ), count );
+
+  std::cout << "Serializing FIX44 ExecutionReport messages from strings: ";
+  report( testSerializeFromStringFIX44ExecutionReportWithProfile( count, false ), count );
+
+  std::cout << "Serializing FIX44 ExecutionReport messages from strings with a 6 field decode profile: ";
+  report( testSerializeFromStringFIX44ExecutionReportWithProfile( count, true ), count );
+
+  std::cout << "Serializing FIX44 MarketDataIncrementalRefresh messages with 50 entries to strings: ";
+  report( testSerializeToStringFIX44MarketDataIncrementalRefresh( count ), count );
+
+  std::cout << "Serializing FIX44 MarketDataIncrementalRefresh messages with 50 entries from strings: ";
+  report( testSerializeFromStringFIX44MarketDataIncrementalRefresh( count ), count );
+
+  std::cout << "Encoding FIX44 MarketDataIncrementalRefresh messages with 50 entries as FAST: ";
+  report( testEncodeFASTMarketDataIncrementalRefresh( count ), count );
+
+  std::cout << "Decoding FIX44 MarketDataIncrementalRefresh messages with 50 entries from FAST: ";
+  report( testDecodeFASTMarketDataIncrementalRefresh( count ), count );
+
   std::cout << "Sending/Receiving NewOrderSingle/ExecutionReports on Socket";
   report( testSendOnSocket( count, port ), count );
 
   std::cout << "Sending/Receiving NewOrderSingle/ExecutionReports on ThreadedSocket";
   report( testSendOnThreadedSocket( count, port ), count );
 
+  const int connections[] = { 10, 100, 1000, 5000 };
+  for ( int i = 0; i < 4; ++i )
+  {
+    for ( int active = 0; active < 2; ++active )
+    {
+      for ( int epoll = 0; epoll < 2; ++epoll )
+      {
+        std::cout << "Blocking on " << connections[ i ]
+                  << ( active ? " active" : " idle" )
+                  << " loopback connections with "
+                  << ( epoll ? "epoll" : "select" ) << ": ";
+        long time = testBlockOnSockets( count, connections[ i ], epoll != 0, active != 0 );
+        if ( time < 0 )
+          std::cout << std::endl << "    skipped" << std::endl;
+        else
+          report( time, count );
+      }
+    }
+  }
+
   return 0;
 }
 
@@ -253,6 +357,32 @@ long testStringToDouble( int count )
   return GetTickCount() - start;
 }
 
+long testDecimalToString( int count )
+{
+  FIX::Decimal value( 12345, -2 );
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    FIX::DecimalConvertor::convert( value );
+  }
+  return GetTickCount() - start;
+}
+
+long testStringToDecimal( int count )
+{
+  std::string value( "123.45" );
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    FIX::DecimalConvertor::convert( value );
+  }
+  return GetTickCount() - start;
+}
+
 long testCreateHeartbeat( int count )
 {
   count = count - 1;
@@ -507,6 +637,34 @@ long testSerializeFromStringQuoteRequest( int count )
   return GetTickCount() - start;
 }
 
+long testSerializeFromStringMarketDataIncrementalRefresh( int count, bool lazyGroups )
+{
+  FIX42::MarketDataIncrementalRefresh message;
+  FIX42::MarketDataIncrementalRefresh::NoMDEntries noMDEntries;
+
+  for( int i = 1; i <= 50; ++i )
+  {
+    noMDEntries.set( FIX::MDUpdateAction(FIX::MDUpdateAction_CHANGE) );
+    noMDEntries.set( FIX::MDEntryType(i % 2 ? FIX::MDEntryType_BID : FIX::MDEntryType_OFFER) );
+    noMDEntries.set( FIX::Symbol("IBM") );
+    noMDEntries.set( FIX::MDEntryPx(120 + i) );
+    noMDEntries.set( FIX::MDEntrySize(100 * i) );
+    noMDEntries.set( FIX::MDEntryPositionNo(i) );
+    message.addGroup( noMDEntries );
+  }
+  std::string string = message.toString();
+  message.setLazyGroups( lazyGroups );
+
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int j = 0; j <= count; ++j )
+  {
+    message.setString( string, DONT_VALIDATE, s_dataDictionary.get() );
+  }
+  return GetTickCount() - start;
+}
+
 long testSerializeFromStringAndValidateQuoteRequest( int count )
 {
   FIX42::QuoteRequest message( FIX::QuoteReqID("1") );
@@ -597,6 +755,128 @@ long testReadFromQuoteRequest( int count )
   return GetTickCount() - start;
 }
 
+long testGetField( int count, int fields )
+{
+  // user defined style tags spread over the range a message body uses
+  std::vector<int> tags;
+  FIX::Message message;
+  for ( int i = 0; i < fields; ++i )
+  {
+    int tag = 1 + ( i * 997 ) % 1000;
+    tags.push_back( tag );
+    message.setField( tag, "value" );
+  }
+
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    message.getField( tags[ i % fields ] );
+  }
+  return GetTickCount() - start;
+}
+
+long testScanFIX44Traffic( int count, FIX::ByteScanner::Kernel kernel )
+{
+  FIX::ByteScanner::Kernel previous = FIX::ByteScanner::kernel();
+  FIX::ByteScanner::select( kernel );
+
+  // a typical order/fill exchange as it appears on the wire
+  FIX44::NewOrderSingle order( FIX::ClOrdID( "ORDER-000001" ), FIX::Side( FIX::Side_BUY ),
+                               FIX::TransactTime(), FIX::OrdType( FIX::OrdType_LIMIT ) );
+  order.set( FIX::Symbol( "MSFT" ) );
+  order.set( FIX::OrderQty( 100 ) );
+  order.set( FIX::Price( 31.25 ) );
+  order.set( FIX::Account( "ACCOUNT-1" ) );
+  FIX44::ExecutionReport fill( FIX::OrderID( "EX-000001" ), FIX::ExecID( "EXEC-000001" ),
+                               FIX::ExecType( FIX::ExecType_TRADE ), FIX::OrdStatus( FIX::OrdStatus_FILLED ),
+                               FIX::Side( FIX::Side_BUY ), FIX::LeavesQty( 0 ), FIX::CumQty( 100 ), FIX::AvgPx( 31.25 ) );
+  fill.set( FIX::Symbol( "MSFT" ) );
+  fill.set( FIX::LastQty( 100 ) );
+  fill.set( FIX::LastPx( 31.25 ) );
+  fill.set( FIX::Text( "filled at the limit price on the primary exchange" ) );
+
+  FIX::Message* messages[] = { &order, &fill };
+  std::string traffic;
+  for ( int i = 0; i < 2; ++i )
+  {
+    FIX::Header& header = messages[ i ]->getHeader();
+    header.setField( FIX::SenderCompID( "SENDER" ) );
+    header.setField( FIX::TargetCompID( "TARGET" ) );
+    header.setField( FIX::MsgSeqNum( 1000 + i ) );
+    header.setField( FIX::SendingTime() );
+    traffic += messages[ i ]->toString();
+  }
+
+  const char* begin = traffic.data();
+  const char* end = begin + traffic.size();
+  int checkSum = 0;
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    for ( const char* soh = begin; soh != end; soh = FIX::ByteScanner::findSoh( soh + 1, end ) ) {}
+    checkSum += FIX::ByteScanner::checkSum( begin, end );
+  }
+  long result = GetTickCount() - start;
+
+  FIX::ByteScanner::select( previous );
+  return checkSum < 0 ? 0 : result;
+}
+
+long testSerializeToStringFIX44NewOrderSingle( int count )
+{
+  FIX44::NewOrderSingle message( FIX::ClOrdID( "ORDER-000001" ), FIX::Side( FIX::Side_BUY ),
+                                 FIX::TransactTime(), FIX::OrdType( FIX::OrdType_LIMIT ) );
+  message.set( FIX::Symbol( "MSFT" ) );
+  message.set( FIX::OrderQty( 100 ) );
+  message.set( FIX::Price( 31.25 ) );
+  message.set( FIX::Account( "ACCOUNT-1" ) );
+  FIX::Header& header = message.getHeader();
+  header.setField( FIX::SenderCompID( "SENDER" ) );
+  header.setField( FIX::TargetCompID( "TARGET" ) );
+  header.setField( FIX::MsgSeqNum( 1000 ) );
+  header.setField( FIX::SendingTime() );
+
+  std::string result;
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    message.toString( result );
+  }
+  return GetTickCount() - start;
+}
+
+long testSerializeToStringFIX44ExecutionReport( int count )
+{
+  FIX44::ExecutionReport message( FIX::OrderID( "EX-000001" ), FIX::ExecID( "EXEC-000001" ),
+                                  FIX::ExecType( FIX::ExecType_TRADE ), FIX::OrdStatus( FIX::OrdStatus_FILLED ),
+                                  FIX::Side( FIX::Side_BUY ), FIX::LeavesQty( 0 ), FIX::CumQty( 100 ), FIX::AvgPx( 31.25 ) );
+  message.set( FIX::Symbol( "MSFT" ) );
+  message.set( FIX::LastQty( 100 ) );
+  message.set( FIX::LastPx( 31.25 ) );
+  message.set( FIX::Text( "filled at the limit price on the primary exchange" ) );
+  FIX::Header& header = message.getHeader();
+  header.setField( FIX::SenderCompID( "SENDER" ) );
+  header.setField( FIX::TargetCompID( "TARGET" ) );
+  header.setField( FIX::MsgSeqNum( 1001 ) );
+  header.setField( FIX::SendingTime() );
+
+  std::string result;
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    message.toString( result );
+  }
+  return GetTickCount() - start;
+}
+
 long testFileStoreNewOrderSingle( int count )
 {
   FIX::BeginString beginString( FIX::BeginString_FIX42 );
@@ -735,6 +1015,171 @@ long testValidateDictQuoteRequest( int count )
   return GetTickCount() - start;
 }
 
+FIX44::ExecutionReport createFIX44ExecutionReport()
+{
+  FIX44::ExecutionReport message( FIX::OrderID( "EX-000001" ), FIX::ExecID( "EXEC-000001" ),
+                                  FIX::ExecType( FIX::ExecType_TRADE ), FIX::OrdStatus( FIX::OrdStatus_FILLED ),
+                                  FIX::Side( FIX::Side_BUY ), FIX::LeavesQty( 0 ), FIX::CumQty( 100 ), FIX::AvgPx( 31.25 ) );
+  message.set( FIX::Symbol( "MSFT" ) );
+  message.set( FIX::OrderQty( 100 ) );
+  message.set( FIX::OrdType( FIX::OrdType_LIMIT ) );
+  message.set( FIX::Price( 31.25 ) );
+  message.set( FIX::TimeInForce( FIX::TimeInForce_DAY ) );
+  message.set( FIX::LastQty( 100 ) );
+  message.set( FIX::LastPx( 31.25 ) );
+  message.set( FIX::TransactTime() );
+  message.set( FIX::Text( "filled at the limit price on the primary exchange" ) );
+
+  FIX44::ExecutionReport::NoPartyIDs party;
+  for( int i = 1; i <= 3; ++i )
+  {
+    party.set( FIX::PartyID( "PARTY" ) );
+    party.set( FIX::PartyIDSource( FIX::PartyIDSource_PROPRIETARY_CUSTOM_CODE ) );
+    party.set( FIX::PartyRole( FIX::PartyRole_EXECUTING_FIRM ) );
+    message.addGroup( party );
+  }
+
+  FIX::Header& header = message.getHeader();
+  header.setField( FIX::SenderCompID( "SENDER" ) );
+  header.setField( FIX::TargetCompID( "TARGET" ) );
+  header.setField( FIX::MsgSeqNum( 1001 ) );
+  header.setField( FIX::SendingTime() );
+  return message;
+}
+
+long testValidateDictFIX44ExecutionReport( int count )
+{
+  FIX44::ExecutionReport message = createFIX44ExecutionReport();
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    s_dataDictionary44->validate( message );
+  }
+  return GetTickCount() - start;
+}
+
+long testSerializeFromStringAndValidateFIX44ExecutionReport( int count )
+{
+  FIX44::ExecutionReport message = createFIX44ExecutionReport();
+  std::string string = message.toString();
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    message.setString( string, VALIDATE, s_dataDictionary44.get() );
+  }
+  return GetTickCount() - start;
+}
+
+long testSerializeFromStringFIX44ExecutionReportWithProfile( int count, bool useProfile )
+{
+  FIX44::ExecutionReport message = createFIX44ExecutionReport();
+  std::string string = message.toString();
+
+  FIX::DecodeProfile profile;
+  profile.read( "8:11,37,39,150,14,151" );
+  if ( useProfile )
+    message.setDecodeProfile( &profile );
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    message.setString( string, VALIDATE, s_dataDictionary44.get() );
+  }
+  return GetTickCount() - start;
+}
+
+FIX44::MarketDataIncrementalRefresh createFIX44MarketDataIncrementalRefresh()
+{
+  FIX44::MarketDataIncrementalRefresh message;
+  message.getHeader().set( FIX::SenderCompID( "EXCHANGE" ) );
+  message.getHeader().set( FIX::TargetCompID( "CLIENT" ) );
+  message.getHeader().set( FIX::MsgSeqNum( 1 ) );
+  message.getHeader().setField( FIX::FieldBase( FIX::FIELD::SendingTime, "20141017-10:15:30.123" ) );
+  FIX44::MarketDataIncrementalRefresh::NoMDEntries noMDEntries;
+
+  for( int i = 1; i <= 50; ++i )
+  {
+    noMDEntries.set( FIX::MDUpdateAction(FIX::MDUpdateAction_CHANGE) );
+    noMDEntries.set( FIX::MDEntryType(i % 2 ? FIX::MDEntryType_BID : FIX::MDEntryType_OFFER) );
+    noMDEntries.set( FIX::Symbol("IBM") );
+    noMDEntries.set( FIX::MDEntryPx(120 + i) );
+    noMDEntries.set( FIX::MDEntrySize(100 * i) );
+    noMDEntries.set( FIX::MDEntryPositionNo(i) );
+    message.addGroup( noMDEntries );
+  }
+  return message;
+}
+
+long testSerializeToStringFIX44MarketDataIncrementalRefresh( int count )
+{
+  FIX44::MarketDataIncrementalRefresh message = createFIX44MarketDataIncrementalRefresh();
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    message.toString();
+  }
+  return GetTickCount() - start;
+}
+
+long testSerializeFromStringFIX44MarketDataIncrementalRefresh( int count )
+{
+  FIX44::MarketDataIncrementalRefresh message = createFIX44MarketDataIncrementalRefresh();
+  std::string string = message.toString();
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    message.setString( string, DONT_VALIDATE, s_dataDictionary44.get() );
+  }
+  return GetTickCount() - start;
+}
+
+long testEncodeFASTMarketDataIncrementalRefresh( int count )
+{
+  FIX44::MarketDataIncrementalRefresh message = createFIX44MarketDataIncrementalRefresh();
+  FIX::FastTemplates templates( *s_dataDictionary44, "../spec/FAST44.xml" );
+  FIX::FastEncoder encoder( templates );
+  std::string encoded;
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    // every message is encoded as if it were the first of the stream
+    encoder.reset();
+    encoded.clear();
+    encoder.encode( message, encoded );
+  }
+  return GetTickCount() - start;
+}
+
+long testDecodeFASTMarketDataIncrementalRefresh( int count )
+{
+  FIX44::MarketDataIncrementalRefresh message = createFIX44MarketDataIncrementalRefresh();
+  FIX::FastTemplates templates( *s_dataDictionary44, "../spec/FAST44.xml" );
+  FIX::FastEncoder encoder( templates );
+  FIX::FastDecoder decoder( templates );
+  std::string encoded;
+  encoder.encode( message, encoded );
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    decoder.reset();
+    decoder.decode( encoded, message );
+  }
+  return GetTickCount() - start;
+}
+
 class TestApplication : public FIX::NullApplication
 {
 public:
@@ -875,3 +1320,77 @@ long testSendOnThreadedSocket( int count, short port )
 
   return ticks;
 }
+
+class BlockStrategy : public FIX::SocketMonitor::Strategy
+{
+public:
+  void onConnect( FIX::SocketMonitor&, socket_handle ) {}
+  void onEvent( FIX::SocketMonitor&, socket_handle socket )
+  {
+    char buffer[ 64 ];
+    FIX::socket_recv( socket, buffer, sizeof(buffer) );
+  }
+  void onWrite( FIX::SocketMonitor& monitor, socket_handle socket )
+  { monitor.unsignal( socket ); }
+  void onError( FIX::SocketMonitor&, socket_handle ) {}
+  void onError( FIX::SocketMonitor& ) {}
+};
+
+// Polls a monitor holding a number of accepted loopback connections.
+// Active connections receive one byte per poll, round robin.  Returns -1
+// if the backend is not available or the connections cannot be opened.
+long testBlockOnSockets( int count, int connections, bool epoll, bool active )
+{
+  FIX::SocketMonitor monitor;
+  if ( epoll && !monitor.useEpoll() )
+    return -1;
+
+  socket_handle acceptor = FIX::socket_createAcceptor( 0, true );
+  if ( acceptor < 0 )
+    return -1;
+  short port = FIX::socket_hostport( acceptor );
+
+  std::vector<socket_handle> clients;
+  bool opened = true;
+  for ( int i = 0; opened && i < connections; ++i )
+  {
+    socket_handle client = FIX::socket_createConnector();
+    if ( client < 0 )
+    {
+      opened = false;
+      break;
+    }
+    clients.push_back( client );
+
+    socket_handle server = -1;
+    if ( FIX::socket_connect( client, "127.0.0.1", port ) >= 0 )
+      server = FIX::socket_accept( acceptor );
+    if ( server < 0 )
+      opened = false;
+    else
+      monitor.addRead( server );
+    // select cannot watch descriptors past FD_SETSIZE
+    if ( !epoll && server >= FD_SETSIZE )
+      opened = false;
+  }
+  FIX::socket_close( acceptor );
+
+  long time = -1;
+  if ( opened )
+  {
+    BlockStrategy strategy;
+    long start = GetTickCount();
+    for ( int i = 0; i < count; ++i )
+    {
+      if ( active )
+        FIX::socket_send( clients[ i % connections ], "x", 1 );
+      monitor.block( strategy, true );
+    }
+    time = GetTickCount() - start;
+  }
+
+  std::vector<socket_handle>::iterator i;
+  for ( i = clients.begin(); i != clients.end(); ++i )
+    FIX::socket_close( *i );
+  return time;
+}
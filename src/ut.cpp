@@ -27,9 +27,14 @@
 #include "C++/Utility.h"
 #include "C++/SessionSettings.h"
 #ifndef _MSC_VER
+#include <ByteScannerTestCase.cpp>
+#include <ClockTestCase.cpp>
 #include <DataDictionaryProviderTestCase.cpp>
 #include <DataDictionaryTestCase.cpp>
+#include <DecimalTestCase.cpp>
+#include <DecodeProfileTestCase.cpp>
 #include <DictionaryTestCase.cpp>
+#include <FastCodecTestCase.cpp>
 #include <FieldBaseTestCase.cpp>
 #include <FieldConvertorsTestCase.cpp>
 #include <FieldMapTestCase.cpp>
@@ -38,12 +43,15 @@
 #include <FileStoreFactoryTestCase.cpp>
 #include <FileStoreTestCase.cpp>
 #include <FileUtilitiesTestCase.cpp>
+#include <HeaderPeekTestCase.cpp>
+#include <HeaderTemplateTestCase.cpp>
 #include <HttpMessageTestCase.cpp>
 #include <HttpParserTestCase.cpp>
 #include <GroupTestCase.cpp>
 #include <MemoryStoreTestCase.cpp>
 #include <MessageSortersTestCase.cpp>
 #include <MessagesTestCase.cpp>
+#include <MessageViewTestCase.cpp>
 #include <MySQLStoreTestCase.cpp>
 #include <NullStoreTestCase.cpp>
 #include <OdbcStoreTestCase.cpp>